@@ -1,5 +1,6 @@
 ﻿#include "Affine2D.h"
 #include <cmath>
+#include "Affine2x3.h"
 
 AffineMatrix2D AffineMatrix2D::MakeScaleMatrix(const Vector2 scale) {
 	AffineMatrix2D matrix;
@@ -65,9 +66,8 @@ AffineMatrix2D AffineMatrix2D::MakeAffineMatrix(const AffineMatrix2D& scaleMatri
 }
 
 AffineMatrix2D AffineMatrix2D::MakeAffine(const Vector2& scale, float theta, const Vector2& translate) {
-	AffineMatrix2D scaleMatrix = AffineMatrix2D::MakeScaleMatrix(scale);
-	AffineMatrix2D rotateMatrix = AffineMatrix2D::MakeRotationMatrix(theta);
-	AffineMatrix2D translateMatrix = AffineMatrix2D::MakeTranslateMatrix(translate);
-
-	return AffineMatrix2D::MakeAffineMatrix(scaleMatrix, rotateMatrix, translateMatrix);
+	// S * R * T を行列積3回ではなく直接求める（sin/cos も1回ずつ）
+	AffineMatrix2D matrix;
+	static_cast<Matrix3x3&>(matrix) = Affine2x3::MakeAffine(scale, theta, translate).ToMatrix();
+	return matrix;
 }
\ No newline at end of file
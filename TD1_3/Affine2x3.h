@@ -0,0 +1,139 @@
+﻿#pragma once
+#include <cmath>
+#include <type_traits>
+#include "Vector2.h"
+#include "Matrix3x3.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define AFFINE2X3_USE_SSE
+#endif
+
+/// <summary>
+/// 2Dアフィン変換（2x3）
+/// Matrix3x3 と同じ行ベクトル形式で、3列目（0,0,1）を持たない
+///   x' = x * m[0][0] + y * m[1][0] + m[2][0]
+///   y' = x * m[0][1] + y * m[1][1] + m[2][1]
+/// 合成・逆行列・頂点変換を 6 要素だけで計算する（w 除算なし）
+/// </summary>
+struct Affine2x3 {
+	float m[3][2] = {
+		{ 1.0f, 0.0f },
+		{ 0.0f, 1.0f },
+		{ 0.0f, 0.0f }
+	};
+
+	static Affine2x3 Identity() { return Affine2x3{}; }
+
+	/// <summary>
+	/// 拡大縮小 → 回転 → 平行移動 の順に合成した行列（AffineMatrix2D::MakeAffine と同じ）
+	/// </summary>
+	static Affine2x3 MakeAffine(const Vector2& scale, float theta, const Vector2& translate) {
+		const float c = std::cos(theta);
+		const float s = std::sin(theta);
+		Affine2x3 result;
+		result.m[0][0] = scale.x * c;
+		result.m[0][1] = scale.x * s;
+		result.m[1][0] = -scale.y * s;
+		result.m[1][1] = scale.y * c;
+		result.m[2][0] = translate.x;
+		result.m[2][1] = translate.y;
+		return result;
+	}
+
+	/// <summary>
+	/// Matrix3x3 から変換（3列目が (0,0,1) のアフィン行列であること）
+	/// </summary>
+	static Affine2x3 FromMatrix(const Matrix3x3& matrix) {
+		Affine2x3 result;
+		for (int row = 0; row < 3; ++row) {
+			result.m[row][0] = matrix.m[row][0];
+			result.m[row][1] = matrix.m[row][1];
+		}
+		return result;
+	}
+
+	/// <summary>
+	/// 3列目が (0,0,1) か（射影成分を持つ行列はこの型では扱えない）
+	/// </summary>
+	static bool IsAffine(const Matrix3x3& matrix) {
+		return matrix.m[0][2] == 0.0f && matrix.m[1][2] == 0.0f && matrix.m[2][2] == 1.0f;
+	}
+
+	Matrix3x3 ToMatrix() const {
+		Matrix3x3 result;
+		for (int row = 0; row < 3; ++row) {
+			result.m[row][0] = m[row][0];
+			result.m[row][1] = m[row][1];
+			result.m[row][2] = 0.0f;
+		}
+		result.m[2][2] = 1.0f;
+		return result;
+	}
+
+	/// <summary>
+	/// m1 → m2 の順に適用する行列（Matrix3x3::Multiply(m1, m2) と同じ）
+	/// </summary>
+	static Affine2x3 Multiply(const Affine2x3& m1, const Affine2x3& m2) {
+		Affine2x3 result;
+		result.m[0][0] = m1.m[0][0] * m2.m[0][0] + m1.m[0][1] * m2.m[1][0];
+		result.m[0][1] = m1.m[0][0] * m2.m[0][1] + m1.m[0][1] * m2.m[1][1];
+		result.m[1][0] = m1.m[1][0] * m2.m[0][0] + m1.m[1][1] * m2.m[1][0];
+		result.m[1][1] = m1.m[1][0] * m2.m[0][1] + m1.m[1][1] * m2.m[1][1];
+		result.m[2][0] = m1.m[2][0] * m2.m[0][0] + m1.m[2][1] * m2.m[1][0] + m2.m[2][0];
+		result.m[2][1] = m1.m[2][0] * m2.m[0][1] + m1.m[2][1] * m2.m[1][1] + m2.m[2][1];
+		return result;
+	}
+
+	/// <summary>
+	/// 逆行列（2x2 部分の逆行列と平行移動の打ち消し）
+	/// </summary>
+	static Affine2x3 Inverse(const Affine2x3& matrix) {
+		const float det = matrix.m[0][0] * matrix.m[1][1] - matrix.m[0][1] * matrix.m[1][0];
+		const float invDet = 1.0f / det;
+
+		Affine2x3 result;
+		result.m[0][0] = matrix.m[1][1] * invDet;
+		result.m[0][1] = -matrix.m[0][1] * invDet;
+		result.m[1][0] = -matrix.m[1][0] * invDet;
+		result.m[1][1] = matrix.m[0][0] * invDet;
+		result.m[2][0] = -(matrix.m[2][0] * result.m[0][0] + matrix.m[2][1] * result.m[1][0]);
+		result.m[2][1] = -(matrix.m[2][0] * result.m[0][1] + matrix.m[2][1] * result.m[1][1]);
+		return result;
+	}
+
+	static Vector2 Transform(const Vector2& vector, const Affine2x3& matrix) {
+		return {
+			vector.x * matrix.m[0][0] + vector.y * matrix.m[1][0] + matrix.m[2][0],
+			vector.x * matrix.m[0][1] + vector.y * matrix.m[1][1] + matrix.m[2][1]
+		};
+	}
+
+	/// <summary>
+	/// 複数の頂点をまとめて変換（SSE2 が使えるときは2頂点ずつ）
+	/// src と dst は同じ配列でもよい
+	/// </summary>
+	static void TransformPoints(const Vector2* src, Vector2* dst, int count, const Affine2x3& matrix) {
+		int i = 0;
+#ifdef AFFINE2X3_USE_SSE
+		static_assert(sizeof(Vector2) == sizeof(float) * 2 && std::is_standard_layout_v<Vector2>,
+			"Vector2 must be two packed floats");
+
+		const __m128 row0 = _mm_setr_ps(matrix.m[0][0], matrix.m[0][1], matrix.m[0][0], matrix.m[0][1]);
+		const __m128 row1 = _mm_setr_ps(matrix.m[1][0], matrix.m[1][1], matrix.m[1][0], matrix.m[1][1]);
+		const __m128 row2 = _mm_setr_ps(matrix.m[2][0], matrix.m[2][1], matrix.m[2][0], matrix.m[2][1]);
+
+		for (; i + 2 <= count; i += 2) {
+			// [x0 y0 x1 y1] → [x0 x0 x1 x1] と [y0 y0 y1 y1]
+			const __m128 xy = _mm_loadu_ps(&src[i].x);
+			const __m128 xx = _mm_shuffle_ps(xy, xy, _MM_SHUFFLE(2, 2, 0, 0));
+			const __m128 yy = _mm_shuffle_ps(xy, xy, _MM_SHUFFLE(3, 3, 1, 1));
+			const __m128 result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(xx, row0), _mm_mul_ps(yy, row1)), row2);
+			_mm_storeu_ps(&dst[i].x, result);
+		}
+#endif
+		for (; i < count; ++i) {
+			dst[i] = Transform(src[i], matrix);
+		}
+	}
+};
@@ -0,0 +1,68 @@
+﻿#include "AnimationClip.h"
+#include <algorithm>
+#include <Novice.h>
+
+const AnimationClip* AnimationClipRegistry::GetClip(TextureId textureId, int divX, int divY, int totalFrames, float speed, bool isLoop) {
+	return GetClip(TextureManager::GetInstance().GetTexture(textureId), divX, divY, totalFrames, speed, isLoop);
+}
+
+const AnimationClip* AnimationClipRegistry::GetClip(int graphHandle, int divX, int divY, int totalFrames, float speed, bool isLoop) {
+	// ゼロチェック（ゼロ除算回避）
+	divX = std::max(1, divX);
+	divY = std::max(1, divY);
+	totalFrames = std::max(1, totalFrames);
+	speed = std::max(0.001f, speed);
+
+	const ClipKey key{ graphHandle, divX, divY, totalFrames, speed, isLoop };
+	auto it = clips_.find(key);
+	if (it != clips_.end()) {
+		return it->second.get();
+	}
+
+	auto clip = CreateClip(graphHandle, divX, divY, totalFrames, speed, isLoop);
+	const AnimationClip* result = clip.get();
+	clips_.emplace(key, std::move(clip));
+	return result;
+}
+
+std::unique_ptr<AnimationClip> AnimationClipRegistry::CreateClip(int graphHandle, int divX, int divY, int totalFrames, float speed, bool isLoop) const {
+	auto clip = std::make_unique<AnimationClip>();
+	clip->graphHandle = graphHandle;
+	clip->divX = divX;
+	clip->divY = divY;
+	clip->totalFrames = totalFrames;
+	clip->frameDuration = speed;
+	clip->isLoop = isLoop;
+
+	// 画像全体のサイズから1フレーム分のサイズを求める
+	if (graphHandle >= 0) {
+		int fullWidth = 0, fullHeight = 0;
+		Novice::GetTextureSize(graphHandle, &fullWidth, &fullHeight);
+
+		if (fullWidth > 0 && fullHeight > 0) {
+			clip->frameSize.x = static_cast<float>(fullWidth) / divX;
+			clip->frameSize.y = static_cast<float>(fullHeight) / divY;
+		}
+#ifdef _DEBUG
+		else {
+			Novice::ConsolePrintf("AnimationClipRegistry::CreateClip - Invalid texture size: %d x %d (handle: %d)\n",
+				fullWidth, fullHeight, graphHandle);
+		}
+#endif
+	}
+
+	// 各フレームのソース矩形を事前計算
+	const int frameWidth = std::max(1, static_cast<int>(clip->frameSize.x));
+	const int frameHeight = std::max(1, static_cast<int>(clip->frameSize.y));
+
+	clip->frames.resize(totalFrames);
+	for (int i = 0; i < totalFrames; ++i) {
+		AnimationFrameRect& rect = clip->frames[i];
+		rect.x = (i % divX) * frameWidth;
+		rect.y = (i / divX) * frameHeight;
+		rect.w = frameWidth;
+		rect.h = frameHeight;
+	}
+
+	return clip;
+}
@@ -0,0 +1,74 @@
+﻿#pragma once
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+#include "Vector2.h"
+#include "TextureManager.h"
+
+/// <summary>
+/// 1フレーム分のソース矩形
+/// </summary>
+struct AnimationFrameRect {
+	int x = 0;
+	int y = 0;
+	int w = 0;
+	int h = 0;
+};
+
+/// <summary>
+/// 共有アニメーションクリップ（生成後は変更しない）
+/// テクスチャ・分割数・各フレームのソース矩形・再生速度をまとめて持つ
+/// </summary>
+struct AnimationClip {
+	int graphHandle = -1;
+	int divX = 1;
+	int divY = 1;
+	int totalFrames = 1;
+	float frameDuration = 0.1f; // 1フレームの表示時間
+	bool isLoop = true;
+	Vector2 frameSize = { 0.0f, 0.0f }; // 1フレーム分のサイズ
+	std::vector<AnimationFrameRect> frames;
+};
+
+/// <summary>
+/// AnimationClip のレジストリ
+/// 同じテクスチャ・同じ分割設定のクリップは1つだけ作り、全 DrawComponent2D で共有する
+/// </summary>
+class AnimationClipRegistry {
+public:
+	static AnimationClipRegistry& GetInstance() {
+		static AnimationClipRegistry instance;
+		return instance;
+	}
+
+	AnimationClipRegistry(const AnimationClipRegistry&) = delete;
+	AnimationClipRegistry& operator=(const AnimationClipRegistry&) = delete;
+
+	/// <summary>
+	/// クリップを取得（無ければ作成）
+	/// </summary>
+	/// <param name="textureId">TextureId</param>
+	/// <param name="divX">横分割数</param>
+	/// <param name="divY">縦分割数</param>
+	/// <param name="totalFrames">総フレーム数</param>
+	/// <param name="speed">アニメーション速度（1フレームの表示時間）</param>
+	/// <param name="isLoop">ループ再生するか</param>
+	const AnimationClip* GetClip(TextureId textureId, int divX, int divY, int totalFrames, float speed, bool isLoop);
+
+	// 画像ハンドル指定版（TextureId とハンドルは1対1なので同じクリップになる）
+	const AnimationClip* GetClip(int graphHandle, int divX, int divY, int totalFrames, float speed, bool isLoop);
+
+	// 登録済みクリップ数（デバッグ用）
+	int GetClipCount() const { return static_cast<int>(clips_.size()); }
+
+private:
+	AnimationClipRegistry() = default;
+	~AnimationClipRegistry() = default;
+
+	std::unique_ptr<AnimationClip> CreateClip(int graphHandle, int divX, int divY, int totalFrames, float speed, bool isLoop) const;
+
+	// (ハンドル, 横分割, 縦分割, 総フレーム, 速度, ループ) → クリップ
+	using ClipKey = std::tuple<int, int, int, int, float, bool>;
+	std::map<ClipKey, std::unique_ptr<AnimationClip>> clips_;
+};
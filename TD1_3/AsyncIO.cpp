@@ -0,0 +1,265 @@
+﻿#include "AsyncIO.h"
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include "DebugStats.h"
+#include "FileWatcher.h"
+
+AsyncIO::AsyncIO() {
+	runningWorkers_.store(kWorkerCount);
+	workers_.reserve(kWorkerCount);
+	for (int i = 0; i < kWorkerCount; ++i) {
+		workers_.emplace_back([this]() { WorkerLoop(); });
+	}
+}
+
+AsyncIO::~AsyncIO() {
+	// 実行中の書き込みの後ろに溜まっている最新版は、完了通知からしか出せない。
+	// 終了時は呼び出し側のコールバックは呼ばず、後続の書き込みだけを出して全部書き終えるまで待つ
+	while (!writesInFlight_.empty()) {
+		Job* raw = nullptr;
+		while (completions_.TryPop(raw)) {
+			std::unique_ptr<Job> job(raw);
+			--pendingCount_;
+			if (job->onShutdown) {
+				job->onShutdown();
+			}
+		}
+		std::this_thread::yield();
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(jobMutex_);
+		isStopping_ = true;
+	}
+	jobCondition_.notify_all();
+
+	// 残りのジョブ（保存など）は最後まで実行させる。
+	// 終了時はコールバックを呼べないので、完了キューは捨てながら空け続ける
+	while (runningWorkers_.load() > 0) {
+		Job* job = nullptr;
+		while (completions_.TryPop(job)) {
+			delete job;
+		}
+		std::this_thread::yield();
+	}
+
+	for (std::thread& worker : workers_) {
+		worker.join();
+	}
+
+	Job* job = nullptr;
+	while (completions_.TryPop(job)) {
+		delete job;
+	}
+}
+
+void AsyncIO::WorkerLoop() {
+	for (;;) {
+		std::unique_ptr<Job> job;
+		{
+			std::unique_lock<std::mutex> lock(jobMutex_);
+			jobCondition_.wait(lock, [this]() { return isStopping_ || !jobs_.empty(); });
+			if (jobs_.empty()) {
+				break; // 停止要求かつ仕事が残っていない
+			}
+			job = std::move(jobs_.front());
+			jobs_.pop_front();
+		}
+
+		if (job->work) {
+			job->work();
+		}
+
+		// 完了キューが満杯なら、メインスレッドが取り出すまで待つ
+		Job* done = job.release();
+		while (!completions_.TryPush(done)) {
+			std::this_thread::yield();
+		}
+	}
+
+	runningWorkers_.fetch_sub(1);
+}
+
+void AsyncIO::Submit(Work work, Completion complete) {
+	auto job = std::make_unique<Job>();
+	job->work = std::move(work);
+	job->complete = std::move(complete);
+	Enqueue(std::move(job));
+}
+
+void AsyncIO::Enqueue(std::unique_ptr<Job> job) {
+	++pendingCount_;
+	{
+		std::lock_guard<std::mutex> lock(jobMutex_);
+		jobs_.push_back(std::move(job));
+	}
+	jobCondition_.notify_one();
+}
+
+void AsyncIO::DispatchCompletions() {
+	Job* raw = nullptr;
+	while (completions_.TryPop(raw)) {
+		std::unique_ptr<Job> job(raw);
+		--pendingCount_;
+
+		// コールバック内から次のジョブを積んでもよい
+		if (job->complete) {
+			job->complete();
+		}
+	}
+
+	DebugStats::GetInstance().SetCounter(DebugCounter::AsyncJobs, pendingCount_);
+}
+
+// ========== 読み込み ==========
+
+void AsyncIO::ReadText(const std::string& path, ReadTextCallback onDone) {
+	struct Result {
+		bool isSuccess = false;
+		std::string text;
+	};
+	auto result = std::make_shared<Result>();
+
+	Submit(
+		[path, result]() {
+			std::ifstream file(path, std::ios::binary);
+			if (!file.is_open()) {
+				return;
+			}
+			result->text.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+			result->isSuccess = !file.bad();
+		},
+		[result, onDone = std::move(onDone)]() {
+			if (onDone) {
+				onDone(result->isSuccess, result->text);
+			}
+		});
+}
+
+void AsyncIO::ReadJson(const std::string& path, ReadJsonCallback onDone) {
+	struct Result {
+		bool isSuccess = false;
+		nlohmann::json data;
+		std::string error;
+	};
+	auto result = std::make_shared<Result>();
+
+	Submit(
+		[path, result]() {
+			std::ifstream file(path);
+			if (!file.is_open()) {
+				result->error = "File not found: " + path;
+				return;
+			}
+
+			// ワーカーで例外を投げっぱなしにしない（失敗は is_discarded で判定）
+			result->data = nlohmann::json::parse(file, nullptr, false);
+			if (result->data.is_discarded()) {
+				result->data = nlohmann::json();
+				result->error = "Parse error: " + path;
+				return;
+			}
+			result->isSuccess = true;
+		},
+		[result, onDone = std::move(onDone)]() {
+			if (onDone) {
+				onDone(result->isSuccess, result->data, result->error);
+			}
+		});
+}
+
+// ========== 書き込み ==========
+
+void AsyncIO::WriteText(const std::string& path, std::string text, WriteCallback onDone) {
+	QueueWrite(path,
+		[text = std::move(text)](const std::string& target) { return WriteFileReplace(target, text); },
+		std::move(onDone));
+}
+
+void AsyncIO::WriteJson(const std::string& path, nlohmann::json data, int indent, WriteCallback onDone) {
+	QueueWrite(path,
+		[data = std::move(data), indent](const std::string& target) { return WriteFileReplace(target, data.dump(indent)); },
+		std::move(onDone));
+}
+
+void AsyncIO::QueueWrite(const std::string& path, FileWriter writer, WriteCallback onDone) {
+	auto it = writesInFlight_.find(path);
+	if (it != writesInFlight_.end()) {
+		// 書き込み中なら次に書く内容を最新のものに差し替える（間の版は書かない）
+		it->second.queuedWriter = std::move(writer);
+		if (onDone) {
+			it->second.queuedCallbacks.push_back(std::move(onDone));
+		}
+		return;
+	}
+
+	writesInFlight_.emplace(path, PathWrite{});
+
+	std::vector<WriteCallback> callbacks;
+	if (onDone) {
+		callbacks.push_back(std::move(onDone));
+	}
+	StartWrite(path, std::move(writer), std::move(callbacks));
+}
+
+void AsyncIO::StartWrite(const std::string& path, FileWriter writer, std::vector<WriteCallback> callbacks) {
+	auto isSuccess = std::make_shared<bool>(false);
+
+	auto job = std::make_unique<Job>();
+	job->work = [path, writer = std::move(writer), isSuccess]() {
+		*isSuccess = writer(path);
+	};
+	job->complete = [this, path, isSuccess, callbacks = std::move(callbacks)]() {
+		// 自分で書いた更新をホットリロードの対象にしない
+		if (*isSuccess) {
+			FileWatcher::GetInstance().Acknowledge(path);
+		}
+
+		for (const WriteCallback& callback : callbacks) {
+			callback(*isSuccess);
+		}
+
+		ContinueWrite(path);
+	};
+	job->onShutdown = [this, path]() { ContinueWrite(path); };
+	Enqueue(std::move(job));
+}
+
+void AsyncIO::ContinueWrite(const std::string& path) {
+	auto it = writesInFlight_.find(path);
+	if (it == writesInFlight_.end()) {
+		return;
+	}
+	if (it->second.queuedWriter) {
+		FileWriter next = std::move(it->second.queuedWriter);
+		std::vector<WriteCallback> nextCallbacks = std::move(it->second.queuedCallbacks);
+		it->second = PathWrite{};
+		StartWrite(path, std::move(next), std::move(nextCallbacks));
+	}
+	else {
+		writesInFlight_.erase(it);
+	}
+}
+
+bool AsyncIO::WriteFileReplace(const std::string& path, const std::string& text) {
+	const std::string tempPath = path + ".tmp";
+	{
+		std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+		if (!file.is_open()) {
+			return false;
+		}
+		file.write(text.data(), static_cast<std::streamsize>(text.size()));
+		if (!file) {
+			return false;
+		}
+	}
+
+	std::error_code error;
+	std::filesystem::rename(tempPath, path, error);
+	if (error) {
+		std::filesystem::remove(tempPath, error);
+		return false;
+	}
+	return true;
+}
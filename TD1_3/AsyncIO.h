@@ -0,0 +1,184 @@
+﻿#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "json.hpp"
+
+/// <summary>
+/// 複数スレッドから積み、1スレッドだけが取り出す固定長のロックフリーキュー
+/// セルごとの通し番号で「書き込み済み / 空き」を判定する。満杯なら TryPush が false を返す
+/// </summary>
+template <typename T, size_t Capacity>
+class MpscQueue {
+	static_assert((Capacity & (Capacity - 1)) == 0, "Capacity は2の累乗にする");
+
+public:
+	MpscQueue() {
+		for (size_t i = 0; i < Capacity; ++i) {
+			cells_[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	MpscQueue(const MpscQueue&) = delete;
+	MpscQueue& operator=(const MpscQueue&) = delete;
+
+	// どのスレッドからでも呼べる
+	bool TryPush(T value) {
+		size_t pos = tail_.load(std::memory_order_relaxed);
+		for (;;) {
+			Cell& cell = cells_[pos & (Capacity - 1)];
+			const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+			const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+			if (diff == 0) {
+				// このセルの書き込み権を取れたら値を置いて公開する
+				if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+					cell.value = std::move(value);
+					cell.sequence.store(pos + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (diff < 0) {
+				return false; // 満杯（取り出し側がまだ1周前の値を読んでいない）
+			}
+			else {
+				pos = tail_.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	// 取り出しは1スレッド（メインスレッド）からだけ呼ぶ
+	bool TryPop(T& out) {
+		Cell& cell = cells_[head_ & (Capacity - 1)];
+		const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+		if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(head_ + 1) < 0) {
+			return false; // 空
+		}
+
+		out = std::move(cell.value);
+		cell.sequence.store(head_ + Capacity, std::memory_order_release);
+		++head_;
+		return true;
+	}
+
+private:
+	struct Cell {
+		std::atomic<size_t> sequence{ 0 };
+		T value{};
+	};
+
+	Cell cells_[Capacity];
+	alignas(64) std::atomic<size_t> tail_{ 0 };
+	alignas(64) size_t head_ = 0;
+};
+
+/// <summary>
+/// ファイルの読み書き・JSONの解析をワーカースレッドで行うサービス
+/// 結果は DispatchCompletions（フレーム開始時の同期点）でメインスレッドのコールバックに返す。
+/// 登録・完了通知ともメインスレッドから使う（ワーカーでは Novice の API を呼ばない）
+/// </summary>
+class AsyncIO {
+public:
+	// ワーカーで実行する処理 / メインスレッドで受け取る処理
+	using Work = std::function<void()>;
+	using Completion = std::function<void()>;
+
+	using ReadTextCallback = std::function<void(bool isSuccess, std::string& text)>;
+	using ReadJsonCallback = std::function<void(bool isSuccess, nlohmann::json& data, const std::string& error)>;
+	using WriteCallback = std::function<void(bool isSuccess)>;
+
+	static AsyncIO& GetInstance() {
+		static AsyncIO instance;
+		return instance;
+	}
+
+	AsyncIO(const AsyncIO&) = delete;
+	AsyncIO& operator=(const AsyncIO&) = delete;
+
+	/// <summary>
+	/// 任意の処理をワーカーに積む（complete は完了後の同期点でメインスレッドから呼ばれる）
+	/// </summary>
+	void Submit(Work work, Completion complete = nullptr);
+
+	// ファイルを丸ごと文字列として読む
+	void ReadText(const std::string& path, ReadTextCallback onDone);
+
+	// ファイルを読んで JSON として解析する（解析もワーカーで行う）
+	void ReadJson(const std::string& path, ReadJsonCallback onDone);
+
+	/// <summary>
+	/// 文字列を書き出す（一時ファイルに書いてから置き換えるので、途中で落ちても元のファイルは壊れない）
+	/// 同じパスへの書き込みが実行中なら、その完了後に最新の内容だけを書く
+	/// </summary>
+	void WriteText(const std::string& path, std::string text, WriteCallback onDone = nullptr);
+
+	// JSON を書き出す（文字列化もワーカーで行う）
+	void WriteJson(const std::string& path, nlohmann::json data, int indent, WriteCallback onDone = nullptr);
+
+	/// <summary>
+	/// 完了したジョブのコールバックを呼ぶ（メインスレッドで1フレームに1回）
+	/// </summary>
+	void DispatchCompletions();
+
+	// 完了通知をまだ受け取っていないジョブ数
+	int GetPendingCount() const { return pendingCount_; }
+
+private:
+	AsyncIO();
+	~AsyncIO();
+
+	struct Job {
+		Work work;
+		Completion complete;
+		Completion onShutdown; // 終了処理中に完了したときは complete の代わりにこちらを呼ぶ
+	};
+
+	// ワーカーで実行する書き込み処理（path を受け取って成否を返す）
+	using FileWriter = std::function<bool(const std::string& path)>;
+
+	// パスごとの書き込み状況（実行中に来た書き込みは最新の1件だけ残す）
+	struct PathWrite {
+		FileWriter queuedWriter;
+		std::vector<WriteCallback> queuedCallbacks;
+	};
+
+	void WorkerLoop();
+	void Enqueue(std::unique_ptr<Job> job);
+
+	void QueueWrite(const std::string& path, FileWriter writer, WriteCallback onDone);
+	void StartWrite(const std::string& path, FileWriter writer, std::vector<WriteCallback> callbacks);
+
+	// 書き込みが終わったパスに待っている書き込みがあれば出し、なければ空きにする
+	void ContinueWrite(const std::string& path);
+
+	// 一時ファイルに書いてから差し替える（ワーカーから呼ぶ）
+	static bool WriteFileReplace(const std::string& path, const std::string& text);
+
+	static constexpr int kWorkerCount = 2;
+	static constexpr size_t kCompletionCapacity = 256;
+
+	std::vector<std::thread> workers_;
+	std::atomic<int> runningWorkers_{ 0 };
+
+	// 投入側はワーカーを眠らせておくために mutex + 条件変数を使う
+	std::mutex jobMutex_;
+	std::condition_variable jobCondition_;
+	std::deque<std::unique_ptr<Job>> jobs_;
+	bool isStopping_ = false;
+
+	// 完了側（ワーカー → メインスレッド）
+	MpscQueue<Job*, kCompletionCapacity> completions_;
+
+	// 以下はメインスレッドだけが触る
+	int pendingCount_ = 0;
+	std::unordered_map<std::string, PathWrite> writesInFlight_;
+};
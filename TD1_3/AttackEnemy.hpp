@@ -1,19 +1,8 @@
 ﻿#pragma once
 #include "PhysicsObject.hpp"
 #include "DrawComponentManager.hpp"
-
-enum class AttackEnemyPhase {
-	Patrolling,
-	Battle,
-};
-
-enum class AttackEnemyBattleState {
-	Idle,
-	Running,
-	Windup,
-	Attacking,
-	Attacking2,
-};
+#include "EnemyBehaviorSystem.h"
+#include <cassert>
 
 class AttackEnemyHitBox : public PhysicsObject {
 	float lifetime_ = 15.f;
@@ -92,11 +81,11 @@ public:
 
 class AttackEnemy : public PhysicsObject {
 protected:
-	int direction_ = 1;         // 移動方向（1: 右, -1: 左）
+	// 挙動定義の種類（派生クラスで差し替える）
+	EnemyKind kind_ = EnemyKind::AttackKinoko;
 
-	// 移動速度
-	float moveSpeed_ = 2.0f;
-	float runSpeed_ = 6.5f;
+	// 挙動は EnemyBehaviorSystem が一括で更新する
+	int brainId_ = -1;
 
 	// damaged handling
 	float damagedShakingDuration_ = 20.0f; // ダメージ時の揺れ時間
@@ -105,44 +94,7 @@ protected:
 	Vector2 damagedShakeOffset_ = { 0.0f, 0.0f };
 	bool isDamaged_ = false;
 
-	// states
-	AttackEnemyPhase state_ = AttackEnemyPhase::Patrolling;
-	Vector2 initialPosition_;    // 初期位置
-	bool stunned_ = false;
-
-	// プレイヤー参照
-	GameObject2D* playerRef_ = nullptr; // プレイヤー参照
-	Vector2 playerPos_ = { 0.0f, 0.0f };
-	float distanceToPlayer_ = 0.0f;
-	float detectionRange_ = 500.0f; // プレイヤー検知範囲
-
-	// stun state
-	float stunDuration_ = 60.0f; // スタン状態の持続時間（フレーム数）
-	float stunTimer_ = 0.0f;    // スタン状態のタイマー
-
-	// patrol state
-	float patrolRange_ = 200.0f; // パトロール範囲
-
-	// battle state
-	float attackRange_ = 140.0f; // 攻撃範囲
-	float keepDistance_ = 110.0f; // プレイヤーとの距離維持
-	float battleRange_ = 200.0f; // 戦闘維持範囲
-	float escapeRange_ = 600.0f; // 戦闘離脱範囲
-
-	float attackCooldown_ = 50.0f; // 攻撃クールダウン時間
-	float attackTimer_ = 0.0f; // 攻撃タイマー
-
-	float windDownDuration_ = 45.0f; // 攻撃後のクールダウン時間
-	float windDownTimer_ = 0.0f; // クールダウンタイマー
-
-	float windupDuration_ = 60.0f; // 攻撃の溜め時間
-	float windupTimer_ = 0.0f; // 溜めタイマー
-	float windupShakeMagnitude_ = 0.0f; // 溜め時の画面揺れの大きさ
-	float windupShakeIncrement_ = 0.1f; // 画面揺れの増加量
-	bool emitedCanAttackEffect_ = false;
-	AttackEnemyBattleState battleState_ = AttackEnemyBattleState::Idle;
-
-	// 描画マネージャー（全てのDrawComponent2Dを管理）
+	// 描画マネージャー（全てのDrawComponent2Dを管理、キーは EnemyAnim）
 	DrawComponentManager drawManager_;
 
 	Vector2 DrawOffset_ = { -28.f, 45.f };
@@ -152,23 +104,20 @@ protected:
 	SeId AttackSound = SeId::EnemyAttack1;
 	SeId DamagedSound = SeId::EnemyDamage1;
 
-	// 描画コンポーネント
-	//DrawComponent2D* StunnedComp_ = nullptr;
-	//DrawComponent2D* PatrolComp_ = nullptr;
-	//DrawComponent2D* AttackComp_ = nullptr;
-	//DrawComponent2D* runComp_ = nullptr;
-	//DrawComponent2D* windupComp_ = nullptr;
-	//DrawComponent2D* battleIdleComp_ = nullptr;
-	enum AttackEnemyDrawState {
-		ePatrol,
-		eStunned,
-		eAttack,
-		eRun,
-		eWindup,
-		eBattleIdle
-	};
-public:
+	EnemyBrain& Brain() {
+		assert(brainId_ != -1 && "Initialize 前にブレインを参照しました");
+		return EnemyBehaviorSystem::GetInstance().GetBrain(brainId_);
+	}
+	int Direction() { return Brain().direction; }
+
+	void RegisterDrawComponent(EnemyAnim anim, DrawComponent2D* component) {
+		drawManager_.RegisterComponent(static_cast<int>(anim), component);
+		component->Initialize();
+	}
 
+public:
+	// 挙動システム上のID（未登録なら -1）
+	int GetBrainId() const { return brainId_; }
 
 	AttackEnemy() {
 		// 親クラスのdrawComp_を削除して無効化
@@ -179,6 +128,7 @@ public:
 	}
 
 	~AttackEnemy() {
+		EnemyBehaviorSystem::GetInstance().Unregister(brainId_);
 		drawComp_ = nullptr;
 	}
 
@@ -188,304 +138,127 @@ public:
 		collider_.size = { 64.f, 80.f };
 		collider_.offset = { 0.f, 0.f };
 
-		// マネージャーにコンポーネントを登録
-		drawManager_.RegisterComponent(AttackEnemyDrawState::ePatrol,
+		RegisterDrawComponents();
+		RegisterBrain();
+
+		status_.maxHP = 15;
+		status_.currentHP = status_.maxHP;
+	}
+
+	// EnemyAnim ごとの描画コンポーネントを登録
+	virtual void RegisterDrawComponents() {
+		RegisterDrawComponent(EnemyAnim::Patrol,
 			new DrawComponent2D(Tex().GetTexture(TextureId::AttackKinokoWalk), 10, 1, 10, 5.f, true));
-		drawManager_.RegisterComponent(AttackEnemyDrawState::eStunned,
+		RegisterDrawComponent(EnemyAnim::Stunned,
 			new DrawComponent2D(Tex().GetTexture(TextureId::AttackKinokoStun), 4, 1, 4, 5.f, false));
-		drawManager_.RegisterComponent(AttackEnemyDrawState::eAttack,
+		RegisterDrawComponent(EnemyAnim::Attack,
 			new DrawComponent2D(Tex().GetTexture(TextureId::AttackKinokoAttack), 9, 1, 9, 5.f, false));
-		drawManager_.RegisterComponent(AttackEnemyDrawState::eRun,
+		RegisterDrawComponent(EnemyAnim::Run,
 			new DrawComponent2D(Tex().GetTexture(TextureId::AttackKinokoRun), 4, 1, 4, 5.f, true));
-		drawManager_.RegisterComponent(AttackEnemyDrawState::eWindup,
+		RegisterDrawComponent(EnemyAnim::Windup,
 			new DrawComponent2D(Tex().GetTexture(TextureId::AttackKinokoWindup), 4, 1, 4, 5.f, false));
-		drawManager_.RegisterComponent(AttackEnemyDrawState::eBattleIdle,
+		RegisterDrawComponent(EnemyAnim::BattleIdle,
 			new DrawComponent2D(Tex().GetTexture(TextureId::AttackKinokoBattleIdle), 6, 1, 6, 5.f, true));
-
-		// 全コンポーネントを初期化
-		auto compNames = { AttackEnemyDrawState::ePatrol, AttackEnemyDrawState::eStunned, AttackEnemyDrawState::eAttack, AttackEnemyDrawState::eRun, AttackEnemyDrawState::eWindup, AttackEnemyDrawState::eBattleIdle };
-		for (const auto& name : compNames) {
-			if (auto* comp = drawManager_.GetComponent(name)) {
-				comp->Initialize();
-			}
-		}
-
-		initialPosition_ = transform_.translate;
-		status_.maxHP = 15;
-		status_.currentHP = status_.maxHP;
 	}
 
-	bool IsFacingPlayer() {
-		if (!playerRef_) return false;
-		return (direction_ == 1 && playerPos_.x >= transform_.translate.x) ||
-			(direction_ == -1 && playerPos_.x <= transform_.translate.x);
-	}
-
-	void FindPlayer() {
-		if (!playerRef_) {
-			if (manager_) {
-				playerRef_ = manager_->GetPlayerObject();
-			}
-		}
-
-		if (playerRef_) {
-			playerPos_ = playerRef_->GetPosition();
-			distanceToPlayer_ = Vector2::Length(Vector2::Subtract(playerPos_, transform_.translate));
-			if (state_ != AttackEnemyPhase::Battle) {
-				if (IsFacingPlayer()) {
-					if (distanceToPlayer_ <= detectionRange_) {
-						SoundManager::GetInstance().PlaySe(foundPlayerSound);
-						state_ = AttackEnemyPhase::Battle;
-
-					}
-				}
-			}
-		}
-		else {
-			ReturnToPatrol();
+	void RegisterBrain() {
+		// 明示的に Initialize し直された場合も、ブレインは二重登録せず状態だけ戻す
+		auto& behavior = EnemyBehaviorSystem::GetInstance();
+		if (brainId_ == -1) {
+			brainId_ = behavior.Register(kind_, &transform_.translate, collider_.size, collider_.offset);
 		}
+		behavior.ResetBrain(brainId_);
 	}
 
-
-
 	virtual void UpdateDrawComponent(float deltaTime) override {
-		drawManager_.SetFlipX(direction_ == 1);
+		const EnemyBrain& brain = Brain();
+
+		drawManager_.SetFlipX(brain.direction == 1);
 		Vector2 renderPos;
-		renderPos.x = transform_.translate.x + float(rand() % 100) / 100.f * windupShakeMagnitude_;
-		renderPos.y = transform_.translate.y + float(rand() % 100) / 100.f * windupShakeMagnitude_;
+		renderPos.x = transform_.translate.x + float(rand() % 100) / 100.f * brain.shakeMagnitude;
+		renderPos.y = transform_.translate.y + float(rand() % 100) / 100.f * brain.shakeMagnitude;
 
 		Vector2 DrawOffset = DrawOffset_;
-		DrawOffset.x = DrawOffset.x * (direction_ == 1 ? -1.f : 1.f);
+		DrawOffset.x = DrawOffset.x * (brain.direction == 1 ? -1.f : 1.f);
 
 		drawManager_.SetTransform(transform_);
 		drawManager_.SetPosition(renderPos + damagedShakeOffset_ + DrawOffset);
 		drawManager_.Update(deltaTime);
 	}
 
-	virtual void Stunning(float deltaTime) {
-		stunTimer_ -= deltaTime;
-		if (stunTimer_ <= 0) {
-			stunned_ = false;
-		}
-	}
+	virtual void Update(float deltaTime) override {
 
-	virtual void Attack(float deltaTime) {
-		// 攻撃処理
-		windDownTimer_ += deltaTime;
-		if (windDownTimer_ >= windDownDuration_) {
-			windDownTimer_ = 0.0f;
-			battleState_ = AttackEnemyBattleState::Idle;
-		}
+		ApplyBehavior();
+		Move(deltaTime);
+		damageHandling(deltaTime);
+		UpdateDrawComponent(deltaTime);
 
 	}
 
-	virtual void BattleIdle(float deltaTime) {
-		// 待機処理
-		if (distanceToPlayer_ > battleRange_) {
-			battleState_ = AttackEnemyBattleState::Running;
-			return;
-		}
-
-		attackTimer_ += deltaTime;
+	/// <summary>
+	/// EnemyBehaviorSystem の結果（移動量・イベント・描画状態）を反映する
+	/// </summary>
+	void ApplyBehavior() {
+		// イベント処理中に Spawn されても参照が無効にならないよう、値でコピーしておく
+		const EnemyBrain brain = Brain();
 
-		direction_ = (playerPos_.x >= transform_.translate.x) ? 1 : -1;		
+		transform_.translate.x += brain.moveX;
 
-		if (distanceToPlayer_ > attackRange_) {
-			// プレイヤーに近づく処理
-			Vector2 directionToPlayer = Vector2::Subtract(playerPos_, transform_.translate);
-			directionToPlayer = Vector2::Normalize(directionToPlayer);
-			transform_.translate.x += directionToPlayer.x * moveSpeed_;
-			return;
+		if (brain.heal > 0) {
+			OnHealed(brain.heal);
 		}
 
-		if (distanceToPlayer_ < keepDistance_) {
-			// プレイヤーから離れる処理
-			Vector2 directionAwayFromPlayer = Vector2::Subtract(transform_.translate, playerPos_);
-			directionAwayFromPlayer = Vector2::Normalize(directionAwayFromPlayer);
-			transform_.translate.x += directionAwayFromPlayer.x * moveSpeed_;
+		if (brain.events & kEnemyEventFoundPlayer) {
+			SoundManager::GetInstance().PlaySe(foundPlayerSound, transform_.translate);
 		}
 
-		if (distanceToPlayer_ <= attackRange_) {
-			// 攻撃範囲内
-			if (attackTimer_ >= attackCooldown_) {
-				attackTimer_ = 0.0f;
-				battleState_ = AttackEnemyBattleState::Windup;
-				windupTimer_ = 0.0f;
-			}
-		}
-
-	}
-
-	virtual void Windup(float deltaTime) {
-		windupTimer_ += deltaTime;
-
-		if (!emitedCanAttackEffect_) {
+		if (brain.events & kEnemyEventTelegraph) {
 			ParticleManager::GetInstance().Emit(ParticleType::Enemy_CanStan, transform_.translate);
-			emitedCanAttackEffect_ = true;
 
-			// エフェクトを開始
-			drawManager_.StartFlashBlink(0xFFFFFFFF, 4, windupDuration_ / 8.f / 60.f, BlendMode::kBlendModeAdd, 2);
+			// 前のエフェクトを明示的に停止してから新しいエフェクトを開始
+			const EnemyBehaviorDef& def = EnemyBehaviorSystem::GetInstance().GetDef(kind_);
+			const float windupDuration = def.attackSequence.empty() ? 60.0f : def.attackSequence[brain.step].duration;
+			drawManager_.StopFlashBlink();
+			drawManager_.StartFlashBlink(0xFFFFFFFF, 4, windupDuration / 8.f / 60.f, BlendMode::kBlendModeAdd, 2);
 		}
 
-		if (windupTimer_ >= windupDuration_ / 2) {
-			windupShakeMagnitude_ += windupShakeIncrement_ * deltaTime;
+		if (brain.events & kEnemyEventAddForce) {
+			rigidbody_.AddForce(brain.pendingForce);
 		}
 
-		if (windupTimer_ >= windupDuration_) {
-			battleState_ = AttackEnemyBattleState::Attacking;
-			windupTimer_ = 0.0f;
-			windupShakeMagnitude_ = 0.0f;
-			emitedCanAttackEffect_ = false;
-
-			rigidbody_.AddForce({ direction_ * 8.0f, 0.0f });
-			// Create and position the hitbox
+		if (brain.events & kEnemyEventSpawnHitBox) {
 			SpawnHitBox(15.f);
-			SoundManager::GetInstance().PlaySe(AttackSound);
-		}
-	}
-
-	virtual void RunTowardsPlayer(float deltaTime) {
-		// プレイヤーに向かって走る
-		Vector2 directionToPlayer = Vector2::Subtract(playerPos_, transform_.translate);
-		directionToPlayer = Vector2::Normalize(directionToPlayer);
-		transform_.translate.x += directionToPlayer.x * runSpeed_ * deltaTime;
-
-		direction_ = (directionToPlayer.x >= 0) ? 1 : -1;
-
-		attackTimer_ += deltaTime;
-
-		if (distanceToPlayer_ <= battleRange_) {
-			battleState_ = AttackEnemyBattleState::Idle;
-		}
-	}
-
-	virtual void ChangeDrawComponent(DrawComponent2D* newComp) {
-		if (drawComp_ != newComp) {
-			drawComp_ = newComp;
-			drawComp_->PlayAnimation();
-		}
-	}
-
-	virtual void Update(float deltaTime) override {
-
-		Behavior(deltaTime);
-		Move(deltaTime);
-		damageHandling(deltaTime);
-		UpdateDrawComponent(deltaTime);
-
-	}
-
-	virtual void Behavior(float deltaTime) {
-		//drawManager_.SetFlipX(direction_ == 1);
-		FindPlayer();
-
-		if (stunned_) {
-			drawManager_.ChangeComponent(AttackEnemyDrawState::eStunned);
-			Stunning(deltaTime);
-			return;
 		}
 
-		if (state_ == AttackEnemyPhase::Patrolling) {
-			Patrol(deltaTime);
+		if (brain.events & kEnemyEventAttackSe) {
+			SoundManager::GetInstance().PlaySe(AttackSound, transform_.translate);
 		}
-		else if (state_ == AttackEnemyPhase::Battle) {
-			BattleBehavior(deltaTime);
-		}
-	}
-
 
-	virtual void ReturnToPatrol() {
-		state_ = AttackEnemyPhase::Patrolling;
-		battleState_ = AttackEnemyBattleState::Idle;
-		attackTimer_ = 0.0f;
-	}
-
-	virtual void BattleBehavior(float deltaTime) {
-		if (distanceToPlayer_ > escapeRange_) {
-			ReturnToPatrol();
-			return;
+		if (brain.events & kEnemyEventStunEnd) {
+			OnStunEnd();
 		}
 
-		switch (battleState_) {
-		case AttackEnemyBattleState::Idle:
-			drawManager_.ChangeComponent(AttackEnemyDrawState::eBattleIdle);
-			BattleIdle(deltaTime);
-			break;
-		case AttackEnemyBattleState::Running:
-			drawManager_.ChangeComponent(AttackEnemyDrawState::eRun);
-			RunTowardsPlayer(deltaTime);
-			break;
-		case AttackEnemyBattleState::Windup:
-			drawManager_.ChangeComponent(AttackEnemyDrawState::eWindup);
-			Windup(deltaTime);
-			break;
-		case AttackEnemyBattleState::Attacking:
-			drawManager_.ChangeComponent(AttackEnemyDrawState::eAttack);
-			Attack(deltaTime);
-			break;
-		}
+		drawManager_.ChangeComponent(static_cast<int>(brain.anim));
 	}
 
 	virtual void Stun() {
-		stunned_ = true;
-		stunTimer_ = stunDuration_;
+		EnemyBehaviorSystem::GetInstance().Stun(brainId_);
+		drawManager_.ChangeComponent(static_cast<int>(EnemyAnim::Stunned));
+
 		// 前のエフェクトを明示的に停止してから新しいエフェクトを開始
 		drawManager_.StopFlashBlink();
 		drawManager_.StartFlashBlink(0x0000FFCC, 2, 0.1f,BlendMode::kBlendModeNormal, 1);
 		ParticleManager::GetInstance().Emit(ParticleType::Charge, transform_.translate);
 
-		attackTimer_ = 0.0f;
-		battleState_ = AttackEnemyBattleState::Idle;
-		SoundManager::GetInstance().PlaySe(DamagedSound);
-		emitedCanAttackEffect_ = false;
-
+		SoundManager::GetInstance().PlaySe(DamagedSound, transform_.translate);
 	}
 
-	virtual void Patrol(float deltaTime) {
-		drawManager_.ChangeComponent(AttackEnemyDrawState::ePatrol);
-
-		OnHealed(1);
-
-		// パトロール範囲内で移動
-		transform_.translate.x += direction_ * moveSpeed_ * deltaTime;
-		//Novice::ConsolePrintf( "id: %d ,Enemy Pos X: %.2f ", info_.id,transform_.translate.x);
-		//Novice::ConsolePrintf("Initial Pos X: %.2f, overPatrol: %d\n", initialPosition_.x, transform_.translate.x > initialPosition_.x + patrolRange_ || transform_.translate.x < initialPosition_.x - patrolRange_);
-		if (transform_.translate.x > initialPosition_.x + patrolRange_) {
-			direction_ = -1; // 左に移動
-		}
-		else if (transform_.translate.x < initialPosition_.x - patrolRange_) {
-			direction_ = 1; // 右に移動
-		}
-
-		//find the bottomRight and bottomLeft haveing blocks
-		auto& mapData = MapData::GetInstance();
-		float tileSize = 64.0f; // Adjust this to your actual tile size (e.g. 64.f)
-
-		Vector2 bottomLeft = { transform_.translate.x - collider_.offset.x - collider_.size.x, transform_.translate.y - collider_.offset.y - collider_.size.y * 1.25f };
-		Vector2 bottomRight = { transform_.translate.x - collider_.offset.x + collider_.size.x, transform_.translate.y - collider_.offset.y - collider_.size.y * 1.25f };
-
-
-		int leftTileX = static_cast<int>(bottomLeft.x / tileSize);
-		int rightTileX = static_cast<int>(bottomRight.x / tileSize);
-		int bottomTileY = static_cast<int>(bottomLeft.y / tileSize);
-
-		//check if cornor tile dont have block, change direction
-		int LBtileID = mapData.GetTile(leftTileX, bottomTileY, TileLayer::Block);
-		const TileDefinition* LBDef = TileRegistry::GetTile(LBtileID);
-		if (LBDef == nullptr || !LBDef->isSolid) {
-			direction_ = 1; // Change direction to right
-		}
-
-		int RBtileID = mapData.GetTile(rightTileX, bottomTileY, TileLayer::Block);
-		const TileDefinition* RBDef = TileRegistry::GetTile(RBtileID);
-		if (RBDef == nullptr || !RBDef->isSolid) {
-			direction_ = -1; // Change direction to left
-		}
-	}
+	// スタン終了時（見た目や当たり判定を戻す用）
+	virtual void OnStunEnd() {}
 
 	virtual void SpawnHitBox(float lifetime) {
 		AttackEnemyHitBox* hitbox = manager_->Spawn<AttackEnemyHitBox>(this, "EnemyHitBox");
-		hitbox->SetPosition(transform_.translate + Vector2(64.f, 0.f) * float(direction_));
+		hitbox->SetPosition(transform_.translate + Vector2(64.f, 0.f) * float(Direction()));
 		hitbox->setLifetime(lifetime);		
 	}
 
@@ -548,8 +321,8 @@ public:
 			ParticleManager::GetInstance().Emit(ParticleType::Hit, transform_.translate);
 			ParticleManager::GetInstance().Emit(ParticleType::Enemy_Dead, transform_.translate);
 			Destroy();
-			SoundManager::GetInstance().PlaySe(DamagedSound);
-			SoundManager::GetInstance().PlaySe(SeId::PlayerShot);
+			SoundManager::GetInstance().PlaySe(DamagedSound, transform_.translate);
+			SoundManager::GetInstance().PlaySe(SeId::PlayerShot, transform_.translate);
 		}
 		else {
 			if (damage > 0) {
@@ -561,14 +334,14 @@ public:
 				damagedShakeTimer_ = 0.0f;
 
 				ParticleManager::GetInstance().Emit(ParticleType::Hit, transform_.translate);
-				SoundManager::GetInstance().PlaySe(DamagedSound);
-				SoundManager::GetInstance().PlaySe(SeId::PlayerShot);
+				SoundManager::GetInstance().PlaySe(DamagedSound, transform_.translate);
+				SoundManager::GetInstance().PlaySe(SeId::PlayerShot, transform_.translate);
 
 				SpawnStar();
 			}
 
 
-			if (battleState_ == AttackEnemyBattleState::Windup) {
+			if (EnemyBehaviorSystem::GetInstance().IsStunnable(brainId_)) {
 				Stun();
 
 				SpawnStar();
@@ -578,7 +351,7 @@ public:
 
 	virtual int OnCollision(GameObject2D* other) override {
 		if (other->GetInfo().tag == "Boomerang") {
-			direction_ = (transform_.translate.x > other->GetTransform().translate.x) ? -1 : 1;
+			Brain().direction = (transform_.translate.x > other->GetTransform().translate.x) ? -1 : 1;
 		}
 		else if (other->GetInfo().tag == "Enemy") {
 			// knockback on collision with other enemies
@@ -586,9 +359,9 @@ public:
 			knockbackDir = Vector2::Normalize(knockbackDir);
 			rigidbody_.acceleration.x += knockbackDir.x * 7.5f;
 
-			if (state_ == AttackEnemyPhase::Patrolling) {
+			if (Brain().phase == EnemyPhase::Patrol) {
 				// reverse direction
-				direction_ *= -1;
+				Brain().direction *= -1;
 			}
 
 		}
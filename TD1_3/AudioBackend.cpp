@@ -0,0 +1,22 @@
+﻿#include "AudioBackend.h"
+#include <Novice.h>
+
+int NoviceAudioBackend::LoadAudio(const char* filePath) {
+	return Novice::LoadAudio(filePath);
+}
+
+int NoviceAudioBackend::PlayAudio(int soundHandle, bool loop, float volume) {
+	return Novice::PlayAudio(soundHandle, loop, volume);
+}
+
+void NoviceAudioBackend::StopAudio(int voiceHandle) {
+	Novice::StopAudio(voiceHandle);
+}
+
+bool NoviceAudioBackend::IsPlayingAudio(int voiceHandle) {
+	return Novice::IsPlayingAudio(voiceHandle) != 0;
+}
+
+void NoviceAudioBackend::SetAudioVolume(int voiceHandle, float volume) {
+	Novice::SetAudioVolume(voiceHandle, volume);
+}
@@ -0,0 +1,84 @@
+﻿#pragma once
+#include <algorithm>
+#include <vector>
+
+/// <summary>
+/// 音声再生バックエンドのインターフェース
+/// SoundManager / SeVoiceManager はここを経由して再生するので、
+/// テスト時はモック実装に差し替えれば Novice なしで動かせる
+/// </summary>
+class IAudioBackend {
+public:
+	virtual ~IAudioBackend() = default;
+
+	// 音声ファイルの読み込み（失敗時 -1）
+	virtual int LoadAudio(const char* filePath) = 0;
+
+	// 読み込んだ音声の解放（解放できないバックエンドは false を返し、常駐のままになる）
+	virtual bool UnloadAudio(int soundHandle) { (void)soundHandle; return false; }
+
+	// 再生してボイスハンドルを返す（失敗時 -1）
+	virtual int PlayAudio(int soundHandle, bool loop, float volume) = 0;
+
+	virtual void StopAudio(int voiceHandle) = 0;
+	virtual bool IsPlayingAudio(int voiceHandle) = 0;
+	virtual void SetAudioVolume(int voiceHandle, float volume) = 0;
+};
+
+/// <summary>
+/// Novice の Audio API を使う本番用バックエンド
+/// </summary>
+class NoviceAudioBackend : public IAudioBackend {
+public:
+	int LoadAudio(const char* filePath) override;
+	// Novice には音声の解放APIがないので UnloadAudio は既定（false）のまま
+	int PlayAudio(int soundHandle, bool loop, float volume) override;
+	void StopAudio(int voiceHandle) override;
+	bool IsPlayingAudio(int voiceHandle) override;
+	void SetAudioVolume(int voiceHandle, float volume) override;
+};
+
+/// <summary>
+/// 音を出さないテスト用バックエンド
+/// 再生中のボイスと停止されたボイスを記録するので、ボイス管理の確認に使う
+/// </summary>
+class MockAudioBackend : public IAudioBackend {
+public:
+	int LoadAudio(const char* filePath) override { (void)filePath; return nextSoundHandle_++; }
+	bool UnloadAudio(int soundHandle) override { (void)soundHandle; return true; }
+
+	int PlayAudio(int soundHandle, bool loop, float volume) override {
+		(void)soundHandle; (void)loop; (void)volume;
+		playing_.push_back(nextVoiceHandle_);
+		return nextVoiceHandle_++;
+	}
+
+	void StopAudio(int voiceHandle) override {
+		if (Finish(voiceHandle)) {
+			stopped_.push_back(voiceHandle);
+		}
+	}
+
+	bool IsPlayingAudio(int voiceHandle) override {
+		return std::find(playing_.begin(), playing_.end(), voiceHandle) != playing_.end();
+	}
+
+	void SetAudioVolume(int voiceHandle, float volume) override { (void)voiceHandle; (void)volume; }
+
+	// 再生が最後まで終わったことにする（停止の記録には残らない）
+	bool Finish(int voiceHandle) {
+		auto it = std::find(playing_.begin(), playing_.end(), voiceHandle);
+		if (it == playing_.end()) return false;
+		playing_.erase(it);
+		return true;
+	}
+
+	// StopAudio で止められたボイス（古い順）
+	const std::vector<int>& GetStoppedVoices() const { return stopped_; }
+
+private:
+	int nextSoundHandle_ = 0;
+	int nextVoiceHandle_ = 0;
+	std::vector<int> playing_;
+	std::vector<int> stopped_;
+};
@@ -0,0 +1,74 @@
+﻿#pragma once
+
+// BGMの識別ID
+enum class BgmId {
+	None = -1,
+	Title,
+	StageSelect,
+	Tutorial,
+	Stage,
+	Result,
+	Count // 総数
+};
+
+// SEの識別ID
+enum class SeId {
+	// Menu
+	Select,
+	Decide,
+	Back,
+	Pause,
+
+	// Game
+	PlayerShot,
+
+	// Player
+	PlayerJump,
+	PlayerDash,
+	PlayerDamage,
+	PlayerLand,
+	PlayerBoomerangThrow,
+	PlayerBoomerangFly,
+	PlayerBoomerangReturn,
+	PlayerStarCollect,
+
+	// Enemy
+	EnemyDamage1,
+	EnemyDamage2,
+	EnemyDamage3,
+
+	EnemyAttack1,
+	EnemyAttack2,
+	EnemyAttack3,
+
+	EnemyFindPlayer1,
+	EnemyFindPlayer2,
+	EnemyFindPlayer3,
+
+	// Item
+	StarSpawn,
+
+	Count // 総数
+};
+
+// 音声リソース構造体
+struct AudioResource {
+	int handle = -1;        // Noviceのハンドル（未ロード時 -1）
+	float volume = 1.0f;    // 個別音量（0.0f～1.0f）
+	const char* name = "";  // 表示名（デバッグ用）
+	const char* path = "";  // ファイルパス（遅延ロード用）
+	float loadTimeMs = 0.0f; // 直近のロードにかかった時間（ms）
+	int loadCount = 0;      // ロード回数（解放→再ロードの確認用）
+};
+
+// 音声ロードの計測情報（デバッグ表示用）
+struct AudioLoadStats {
+	int residentCount = 0;   // 現在ロード済みのファイル数
+	int warmupLoads = 0;     // ウォームアップ（シーン開始時）でのロード数
+	int lazyLoads = 0;       // 初回再生時の遅延ロード数
+	int releasedCount = 0;   // 解放したBGMの数
+	float totalLoadMs = 0.0f; // ロードにかかった時間の合計
+	float lastLoadMs = 0.0f;  // 直近のロード時間
+	float lastSceneLoadMs = 0.0f; // 直近の PrepareScene にかかった時間
+	const char* lastLoadName = "";
+};
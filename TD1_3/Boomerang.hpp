@@ -2,6 +2,8 @@
 #include "PhysicsObject.hpp"
 #include "algorithm"
 #include "Star.hpp"
+#include "TrailRenderer2D.h"
+#include "Easing.h"
 
 enum class BoomerangState {
 	Thrown,
@@ -10,12 +12,6 @@ enum class BoomerangState {
 	blocked,
 };
 
-
-struct TrailInfo {
-	Transform2D pos;
-	float lifeTime;
-};
-
 class Boomerang : public PhysicsObject {
 private:
 	BoomerangState state_;
@@ -60,7 +56,8 @@ private:
 	DrawComponent2D* effectCompLv2_ = nullptr;
 	DrawComponent2D* effectCompLv3_ = nullptr;
 
-	std::vector<TrailInfo> trailInfos_;
+	// 戻り中の軌跡（固定長リングバッファ、1本の帯で描く）
+	TrailRenderer2D trail_{ 16, TrailDrawMode::Ribbon };
 public:
 	Boomerang(GameObject2D* owner, bool isTemp) {
 		state_ = BoomerangState::Idle;
@@ -96,6 +93,11 @@ public:
 		effectCompLv3_ = new DrawComponent2D(Tex().GetTexture(TextureId::Boomerang_ChargedLv3), 8, 1, 8, 2.f, true);
 		effectCompLv3_->Initialize();
 		effectCompLv3_->SetBaseColor({ 1.f, 1.f, 1.f, 0.8f });
+
+		trail_.SetTexture(Tex().GetTexture(TextureId::Particle_Glow));
+		trail_.SetWidth(drawComp_->GetDrawSize().x * 0.6f, 0.f);
+		trail_.SetColor(ColorRGBA(0.6f, 0.6f, 1.0f, 0.5f).ToUInt());
+		trail_.SetBlendMode(kBlendModeAdd);
 	}
 
 	~Boomerang() {
@@ -123,7 +125,7 @@ public:
 		starRetrieved_ = false;
 		isGoing = true;
 
-		trailInfos_.clear();
+		trail_.Clear();
 
 		maxStayTime_ = defaultMaxStayTime_ + starCount_ * delayPerStar + Charge/2.f; // Each star adds 2 seconds
 
@@ -213,11 +215,6 @@ public:
 		SoundManager::GetInstance().PlaySe(SeId::PlayerBoomerangThrow);
 	}
 
-	float EaseOutCubic(float t) {
-		float f = 1.0f - t;
-		return 1.0f - f * f * f;
-	}
-
 	void Blocked(Vector2 dir) {
 		if (state_ != BoomerangState::Thrown) return;
 		
@@ -281,16 +278,7 @@ public:
 	}
 
 	void UpdateTrail(float deltaTime) {
-		for (auto& trail : trailInfos_) {
-			trail.lifeTime -= deltaTime;
-		}
-
-		// delete expired trails
-		trailInfos_.erase(
-			std::remove_if(trailInfos_.begin(), trailInfos_.end(),
-				[](const TrailInfo& t) { return t.lifeTime <= 0.f; }),
-			trailInfos_.end()
-		);
+		trail_.Update(deltaTime);
 	}
 
 	bool IsGoing() const {
@@ -372,8 +360,8 @@ public:
 				float t = moveTimer_ / maxTime_;
 				if (t > 1.0f) t = 1.0f;
 
-				// Go to target
-				float easedT = EaseOutCubic(t);
+				// Go to target（moveTimer_ は当たり判定・戻りの切り替えにも使うので、曲線だけ共通のものを使う）
+				float easedT = Easing::Apply<EaseType::EaseOutCubic>(t);
 				Vector2 currentTarget = startPos_ + (targetPos_ - startPos_) * easedT;
 
 				if (isHorizontal_) {
@@ -456,7 +444,7 @@ public:
 			// Simple return logic: Move towards player
 			Vector2 dir = ownerPos - transform_.translate;
 
-			trailInfos_.push_back({ transform_, 10.f });
+			trail_.AddPoint(transform_.translate, 10.f);
 
 			if (Vector2::Length(dir) < 40.0f) {
 				state_ = BoomerangState::Idle;
@@ -582,15 +570,9 @@ public:
 		if (!info_.isActive || !info_.isVisible) return;
 		// DrawComponent2Dを使って描画
 		if (drawComp_) {
+			// 軌跡は本体の下に描く
+			trail_.Draw(camera);
 			drawComp_->Draw(camera);
-
-			for (auto& trail : trailInfos_) {
-				float alpha = trail.lifeTime / 20.f;
-				drawComp_->SetBaseColor({0.6f, 0.6f, 1.0f, alpha });
-				drawComp_->SetTransform(trail.pos);	
-				drawComp_->Draw(camera);
-			}
-			drawComp_->SetBaseColor({ 1.f, 1.f,1.f, 1.f });
 		}
 
 #ifdef _DEBUG
@@ -1,5 +1,4 @@
 ﻿#include "Button.h"
-#include "Easing.h"
 #include <Novice.h>
 #include <algorithm>
 
@@ -47,15 +46,19 @@ Button::Button(const Vector2& position, const Vector2& size, int normalTexture,
 }
 
 void Button::Update(float deltaTime, bool isSelected) {
-	isSelected_ = isSelected;
-
-	// イージングのターゲット値を設定
-	float target = isSelected_ ? 1.0f : 0.0f;
-	easeT_ += (target - easeT_) * std::clamp(easeSpeed_ * deltaTime, 0.0f, 1.0f);
+	(void)deltaTime; // 時間は TweenManager 側で進む
+
+	// 選択状態が変わったら、今の値から目標値へトゥイーンし直す（ポーズ中も動くよう UI グループ）
+	auto& tweens = TweenManager::GetInstance();
+	if (isSelected != isSelected_) {
+		isSelected_ = isSelected;
+		tweens.Stop(selectTween_);
+		selectTween_ = tweens.Start(easeT_, isSelected_ ? 1.0f : 0.0f, selectDuration_, EaseType::EaseOutQuad, TweenGroup::UI);
+	}
+	tweens.Sample(selectTween_, easeT_);
 
-	// イージングを適用してアニメーションスケールを計算（0.9～1.1）
-	float eased = Easing::EaseOutQuad(easeT_);
-	float animScale = std::lerp(scaleMin_, scaleMax_, eased);
+	// アニメーションスケールを計算（0.9～1.1）
+	float animScale = std::lerp(scaleMin_, scaleMax_, easeT_);
 
 	// 画像ボタンの場合、基本スケールにアニメーションスケールを掛ける
 	if (isImageButton_) {
@@ -87,8 +90,7 @@ void Button::Draw() {
 		// テキストボタン：シンプルな矩形描画のみ
 		uint32_t fillColor = isSelected_ ? colorSelected_ : colorNormal_;
 
-		float eased = Easing::EaseOutQuad(easeT_);
-		float scale = std::lerp(scaleMin_, scaleMax_, eased);
+		float scale = std::lerp(scaleMin_, scaleMax_, easeT_);
 		float w = size_.x * scale;
 		float h = size_.y * scale;
 
@@ -3,6 +3,7 @@
 #include "DrawComponent2D.h"
 #include "FontAtlas.h"
 #include "TextRenderer.h"
+#include "Tween.h"
 #include <functional>
 #include <string>
 
@@ -41,9 +42,10 @@ private:
     float baseScaleX_ = 1.0f;
     float baseScaleY_ = 1.0f;
 
-    // イージング用
+    // 選択・非選択の切り替え演出（0:非選択 〜 1:選択）
     float easeT_ = 0.0f;
-    float easeSpeed_ = 10.0f;
+    float selectDuration_ = 8.0f; // フレーム
+    TweenHandle selectTween_;
     float scaleMin_ = 0.9f;
     float scaleMax_ = 1.1f;
 
@@ -25,6 +25,7 @@ void Camera2D::Initialize(const Vector2& position,
 	zoom_ = 1.0f;
 	rotation_ = 0.0f;
 	isWorldYUp_ = invertY;
+	isMatrixDirty_ = true;
 	UpdateMatrices();
 }
 
@@ -70,29 +71,32 @@ float Camera2D::GetZoom() const {
 
 // ========== イージング移動 ==========
 void Camera2D::MoveTo(const Vector2& targetPos, float duration,
-	std::function<float(float)> easingFunc) {
+	EaseType ease) {
+	auto& tweens = TweenManager::GetInstance();
+	tweens.Stop(moveEffect_.tween);
+
 	moveEffect_.isActive = true;
 	moveEffect_.startPos = position_;
 	moveEffect_.targetPos = targetPos;
-	moveEffect_.duration = duration;
-	moveEffect_.elapsed = 0.0f;
-	moveEffect_.easingFunc = easingFunc;
+	moveEffect_.tween = tweens.Start(0.0f, 1.0f, duration, ease);
 }
 
 void Camera2D::UpdateMoveEffect(float deltaTime) {
+	(void)deltaTime; // 時間は TweenManager 側で進む
 	if (!moveEffect_.isActive) return;
 
-	moveEffect_.elapsed += deltaTime;
-	float t = moveEffect_.elapsed / moveEffect_.duration;
+	auto& tweens = TweenManager::GetInstance();
+	float easedT = 1.0f;
+	tweens.Sample(moveEffect_.tween, easedT);
 
-	if (t >= 1.0f) {
+	if (!tweens.IsPlaying(moveEffect_.tween)) {
 		// 移動完了
 		position_ = moveEffect_.targetPos;
 		moveEffect_.isActive = false;
+		moveEffect_.tween = {};
 	}
 	else {
 		// イージング補間
-		float easedT = moveEffect_.easingFunc(t);
 		position_.x = moveEffect_.startPos.x +
 			(moveEffect_.targetPos.x - moveEffect_.startPos.x) * easedT;
 		position_.y = moveEffect_.startPos.y +
@@ -102,29 +106,32 @@ void Camera2D::UpdateMoveEffect(float deltaTime) {
 
 // ========== ズーム ==========
 void Camera2D::ZoomTo(float targetZoom, float duration,
-	std::function<float(float)> easingFunc) {
+	EaseType ease) {
+	auto& tweens = TweenManager::GetInstance();
+	tweens.Stop(zoomEffect_.tween);
+
 	zoomEffect_.isActive = true;
 	zoomEffect_.startZoom = zoom_;
 	zoomEffect_.targetZoom = std::clamp(targetZoom, 0.1f, 10.0f);
-	zoomEffect_.duration = duration;
-	zoomEffect_.elapsed = 0.0f;
-	zoomEffect_.easingFunc = easingFunc;
+	zoomEffect_.tween = tweens.Start(0.0f, 1.0f, duration, ease);
 }
 
 void Camera2D::UpdateZoomEffect(float deltaTime) {
+	(void)deltaTime; // 時間は TweenManager 側で進む
 	if (!zoomEffect_.isActive) return;
 
-	zoomEffect_.elapsed += deltaTime;
-	float t = zoomEffect_.elapsed / zoomEffect_.duration;
+	auto& tweens = TweenManager::GetInstance();
+	float easedT = 1.0f;
+	tweens.Sample(zoomEffect_.tween, easedT);
 
-	if (t >= 1.0f) {
+	if (!tweens.IsPlaying(zoomEffect_.tween)) {
 		// ズーム完了
 		zoom_ = zoomEffect_.targetZoom;
 		zoomEffect_.isActive = false;
+		zoomEffect_.tween = {};
 	}
 	else {
 		// イージング補間
-		float easedT = zoomEffect_.easingFunc(t);
 		zoom_ = zoomEffect_.startZoom +
 			(zoomEffect_.targetZoom - zoomEffect_.startZoom) * easedT;
 	}
@@ -153,6 +160,16 @@ void Camera2D::StopShake() {
 	shakeEffect_.offset = { 0.0f, 0.0f };
 }
 
+void Camera2D::StopAllEffects() {
+	TweenManager& tweens = TweenManager::GetInstance();
+	tweens.Stop(moveEffect_.tween);
+	tweens.Stop(zoomEffect_.tween);
+	moveEffect_.isActive = false;
+	zoomEffect_.isActive = false;
+	StopShake();
+	shakeEffect_.continuous = false;
+}
+
 void Camera2D::UpdateShakeEffect(float deltaTime) {
 	if (!shakeEffect_.isActive) return;
 
@@ -262,6 +279,17 @@ void Camera2D::UpdateMatrices() {
 		finalPosition.y += shakeEffect_.offset.y;
 	}
 
+	// 位置・ズーム・回転が前回と同じなら作り直さない（止まっているカメラでは毎フレームの逆行列計算を省く）
+	if (!isMatrixDirty_ &&
+		finalPosition.x == lastFinalPosition_.x && finalPosition.y == lastFinalPosition_.y &&
+		zoom_ == lastZoom_ && rotation_ == lastRotation_) {
+		return;
+	}
+	isMatrixDirty_ = false;
+	lastFinalPosition_ = finalPosition;
+	lastZoom_ = zoom_;
+	lastRotation_ = rotation_;
+
 	// ビュー行列を作成（カメラのアフィン変換の逆行列）
 	Vector2 scale = {1.0f / zoom_, 1.0f / zoom_ };
 	Matrix3x3 cameraAffine = AffineMatrix2D::MakeAffine(scale, rotation_, finalPosition);
@@ -300,9 +328,32 @@ void Camera2D::UpdateMatrices() {
 	// View * Projection * Viewport 行列を合成
 	Matrix3x3 vp = Matrix3x3::Multiply(viewMatrix_, projectionMatrix_);
 	vpVpMatrix_ = Matrix3x3::Multiply(vp, viewportMatrix_);
+
+	// どれもアフィン行列なので、逆行列は 2x3 で求める
+	vpVpAffine_ = Affine2x3::FromMatrix(vpVpMatrix_);
+	invVpVpAffine_ = Affine2x3::Inverse(vpVpAffine_);
+	invVpVpMatrix_ = invVpVpAffine_.ToMatrix();
+
+	// 画面の四隅をワールドへ戻して表示範囲のAABBを作る（回転していても覆えるように）
+	const Vector2 corners[4] = {
+		{ 0.0f, 0.0f }, { size_.x, 0.0f }, { 0.0f, size_.y }, { size_.x, size_.y }
+	};
+	Vector2 worldCorners[4];
+	Affine2x3::TransformPoints(corners, worldCorners, 4, invVpVpAffine_);
+	visibleMin_ = worldCorners[0];
+	visibleMax_ = worldCorners[0];
+	for (int i = 1; i < 4; ++i) {
+		const Vector2& world = worldCorners[i];
+		visibleMin_.x = (std::min)(visibleMin_.x, world.x);
+		visibleMin_.y = (std::min)(visibleMin_.y, world.y);
+		visibleMax_.x = (std::max)(visibleMax_.x, world.x);
+		visibleMax_.y = (std::max)(visibleMax_.y, world.y);
+	}
+
+	++matrixVersion_;
 }
 
-Matrix3x3 Camera2D::GetVpVpMatrix() const {
+const Matrix3x3& Camera2D::GetVpVpMatrix() const {
 	return vpVpMatrix_;
 }
 
@@ -397,14 +448,14 @@ void Camera2D::DebugMove() {
 	// ========== ズームテスト ==========
 	// 1キーでズームイン
 	if (input.TriggerKey(DIK_1)) {
-		ZoomTo(2.0f, 1.0f, Easing::EaseOutQuad);
+		ZoomTo(2.0f, 1.0f, EaseType::EaseOutQuad);
 	}
 	// 2キーでズームアウト
 	if (input.TriggerKey(DIK_2)) {
-		ZoomTo(1.0f, 1.0f, Easing::EaseInOutQuad);
+		ZoomTo(1.0f, 1.0f, EaseType::EaseInOutQuad);
 	}
 	// 2キーでズームアウト
 	if (input.TriggerKey(DIK_3)) {
-		ZoomTo(0.5f, 0.5f, Easing::EaseInOutQuad);
+		ZoomTo(0.5f, 0.5f, EaseType::EaseInOutQuad);
 	}
 }
\ No newline at end of file
@@ -1,9 +1,11 @@
 ﻿#pragma once
 #include "Vector2.h"
 #include "Matrix3x3.h"
+#include "Affine2x3.h"
 #include "WindowSize.h"
-#include <functional>
+#include <cstdint>
 #include "Easing.h"
+#include "Tween.h"
 
 class DebugWindow; // 前方宣言
 
@@ -48,20 +50,23 @@ public:
 
 	// === イージング移動 ===
 	void MoveTo(const Vector2& targetPos, float duration,
-		std::function<float(float)> easingFunc = Easing::Linear);
+		EaseType ease = EaseType::Linear);
 
 	//  === デバッグ用カメラ操作 ===
 	void DebugMove();
 
 	// === ズーム ===
 	void ZoomTo(float targetZoom, float duration,
-		std::function<float(float)> easingFunc = Easing::EaseOutQuad);
+		EaseType ease = EaseType::EaseOutQuad);
 
 	// === シェイク ===
 	void Shake(float intensity, float duration);
 	void ShakeContinuous(float intensity);  // 停止まで継続
 	void StopShake();
 
+	// 移動・ズーム・シェイクの演出をすべて止める（リトライ時など）
+	void StopAllEffects();
+
 	// === ターゲット追従 ===
 	void SetTarget(const Vector2* target);  // ポインタで追従対象を設定
 	void SetFollowSpeed(float speed);       // 追従速度（0.1～1.0推奨）
@@ -71,12 +76,34 @@ public:
 	void SetBounds(float left, float top, float right, float bottom);
 	void ClearBounds();
 
-	// === 行列取得 ===
-	Matrix3x3 GetVpVpMatrix() const;
+	// === 行列取得（UpdateMatrices でキャッシュした値を参照で返す） ===
+	const Matrix3x3& GetVpVpMatrix() const;
+	const Matrix3x3& GetInverseVpVpMatrix() const { return invVpVpMatrix_; }
+
+	// 同じ行列の 2x3 版（頂点変換はこちらを使うと w 除算なしで済む）
+	const Affine2x3& GetVpVpAffine() const { return vpVpAffine_; }
+	const Affine2x3& GetInverseVpVpAffine() const { return invVpVpAffine_; }
+
+	/// <summary>
+	/// 行列を作り直すたびに増える番号（同じ番号なら行列・表示範囲は変わっていない）
+	/// </summary>
+	uint32_t GetMatrixVersion() const { return matrixVersion_; }
+
+	// === 表示範囲（ワールド座標のAABB、シェイク・回転込み） ===
+	const Vector2& GetVisibleMin() const { return visibleMin_; }
+	const Vector2& GetVisibleMax() const { return visibleMax_; }
+
+	/// <summary>
+	/// 中心と半径（半サイズ）で表した矩形が表示範囲に入っているか
+	/// </summary>
+	bool IsVisible(const Vector2& center, const Vector2& halfSize) const {
+		return center.x + halfSize.x >= visibleMin_.x && center.x - halfSize.x <= visibleMax_.x &&
+			center.y + halfSize.y >= visibleMin_.y && center.y - halfSize.y <= visibleMax_.y;
+	}
 
 	// === Y軸反転取得 ===
 	bool IsWorldYUp() const { return isWorldYUp_; }
-	void SetIsWorldYUp(bool invert) { isWorldYUp_ = invert; }
+	void SetIsWorldYUp(bool invert) { isWorldYUp_ = invert; isMatrixDirty_ = true; }
 
 	// デバッグ用
 	bool GetIsDebugCamera() { return isDebugCamera_; }
@@ -87,7 +114,7 @@ public:
 	/// カメラのズームによる表示領域の左上座標を取得
 	/// </summary>
 	/// <returns></returns>
-	Vector2 GetTopLeft() {
+	Vector2 GetTopLeft() const {
 		float halfWidth = (size_.x / zoom_) * 0.5f;
 		float halfHeight = (size_.y / zoom_) * 0.5f;
 		return Vector2{ position_.x - halfWidth, position_.y - halfHeight };
@@ -97,7 +124,7 @@ public:
 	/// カメラのズームによる表示領域の右下座標を取得
 	/// </summary>
 	/// <returns></returns>
-	Vector2 GetBottomRight() {
+	Vector2 GetBottomRight() const {
 		float halfWidth = (size_.x / zoom_) * 0.5f;
 		float halfHeight = (size_.y / zoom_) * 0.5f;
 		return Vector2{ position_.x + halfWidth, position_.y + halfHeight };
@@ -107,17 +134,16 @@ public:
 	// ワールド座標をスクリーン座標に変換
 	/// </summary>
 	/// <param name="pos">ワールド座標</param>
-	Vector2 WorldToScreen(Vector2 pos) {
-		return Matrix3x3::Transform(pos, vpVpMatrix_);
+	Vector2 WorldToScreen(Vector2 pos) const {
+		return Affine2x3::Transform(pos, vpVpAffine_);
 	}
 
 	/// <summary>
 	// スクリーン座標をワールド座標に変換
 	/// </summary>
 	// <param name="pos">スクリーン座標</param>
-	Vector2 ScreenToWorld(Vector2 pos) {
-		Matrix3x3 invVpVp = Matrix3x3::Inverse(vpVpMatrix_);
-		return Matrix3x3::Transform(pos, invVpVp);
+	Vector2 ScreenToWorld(Vector2 pos) const {
+		return Affine2x3::Transform(pos, invVpVpAffine_);
 	}
 
 
@@ -139,9 +165,7 @@ private:
 		bool isActive = false;
 		Vector2 startPos;
 		Vector2 targetPos;
-		float elapsed = 0.0f;
-		float duration = 0.0f;
-		std::function<float(float)> easingFunc;
+		TweenHandle tween; // 進行度（0→1、イージング適用済み）
 	};
 
 	// ズーム効果
@@ -149,9 +173,7 @@ private:
 		bool isActive = false;
 		float startZoom;
 		float targetZoom;
-		float elapsed = 0.0f;
-		float duration = 0.0f;
-		std::function<float(float)> easingFunc;
+		TweenHandle tween; // 進行度（0→1、イージング適用済み）
 	};
 
 	// シェイク効果
@@ -196,6 +218,20 @@ private:
 	Matrix3x3 projectionMatrix_;
 	Matrix3x3 viewportMatrix_;
 	Matrix3x3 vpVpMatrix_;
+	Matrix3x3 invVpVpMatrix_;
+	Affine2x3 vpVpAffine_;
+	Affine2x3 invVpVpAffine_;
+
+	// 表示範囲（ワールド座標）
+	Vector2 visibleMin_ = { 0.0f, 0.0f };
+	Vector2 visibleMax_ = { 0.0f, 0.0f };
+
+	// 前回行列を作ったときの状態（変わっていなければ作り直さない）
+	bool isMatrixDirty_ = true;
+	uint32_t matrixVersion_ = 0;
+	Vector2 lastFinalPosition_ = { 0.0f, 0.0f };
+	float lastZoom_ = 0.0f;
+	float lastRotation_ = 0.0f;
 
 	void UpdateMatrices();
 };
\ No newline at end of file
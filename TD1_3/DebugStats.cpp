@@ -0,0 +1,164 @@
+﻿#include "DebugStats.h"
+#include <Novice.h>
+#include <cstdio>
+
+#ifdef _DEBUG
+#include <imgui.h>
+#endif
+
+namespace {
+	const char* const kCounterNames[] = {
+		"Objects",
+		"Draw Calls",
+		"MapChip Draw Calls",
+		"Particles",
+		"Effect Tracks",
+		"Async I/O Jobs",
+	};
+	static_assert(sizeof(kCounterNames) / sizeof(kCounterNames[0]) == static_cast<int>(DebugCounter::Count),
+		"kCounterNames must match DebugCounter");
+
+	const char* const kTimerNames[] = {
+		"Frame",
+		"Scene Update",
+		"Map",
+		"Enemy AI",
+		"Objects",
+		"Particles",
+		"UI",
+		"Scene Draw",
+	};
+	static_assert(sizeof(kTimerNames) / sizeof(kTimerNames[0]) == static_cast<int>(DebugTimer::Count),
+		"kTimerNames must match DebugTimer");
+}
+
+DebugStats::DebugStats() {
+	for (auto& counter : counters_) {
+		counter.store(0, std::memory_order_relaxed);
+	}
+	for (auto& accum : timerAccumNs_) {
+		accum.store(0, std::memory_order_relaxed);
+	}
+	frameStart_ = std::chrono::steady_clock::now();
+	RefreshText();
+}
+
+void DebugStats::History::Push(float value) {
+	values[head] = value;
+	head = (head + 1) % kHistorySize;
+
+	// 120件程度なので毎回なめる（平均・最大）
+	float sum = 0.0f;
+	max = 0.0f;
+	for (float v : values) {
+		sum += v;
+		if (v > max) max = v;
+	}
+	average = sum / kHistorySize;
+}
+
+// ========== フレーム境界 ==========
+void DebugStats::BeginFrame() {
+#ifdef _DEBUG
+	frameStart_ = std::chrono::steady_clock::now();
+	isHeavyFrame_ = heavyPanelInterval_ <= 1 || (frameIndex_ % heavyPanelInterval_) == 0;
+#endif
+}
+
+void DebugStats::EndFrame() {
+#ifdef _DEBUG
+	auto elapsed = std::chrono::steady_clock::now() - frameStart_;
+	AddTime(DebugTimer::Frame, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+
+	// 今フレームの加算値を取り出してリセット
+	for (int i = 0; i < static_cast<int>(DebugTimer::Count); ++i) {
+		long long ns = timerAccumNs_[i].exchange(0, std::memory_order_relaxed);
+		if (!isPaused_) {
+			timerHistory_[i].Push(static_cast<float>(ns) / 1000000.0f);
+		}
+	}
+	if (!isPaused_) {
+		for (int i = 0; i < static_cast<int>(DebugCounter::Count); ++i) {
+			counterHistory_[i].Push(static_cast<float>(counters_[i].load(std::memory_order_relaxed)));
+		}
+	}
+
+	if (textInterval_ <= 1 || (frameIndex_ % textInterval_) == 0) {
+		RefreshText();
+	}
+	++frameIndex_;
+#endif
+}
+
+void DebugStats::RefreshText() {
+	for (int i = 0; i < static_cast<int>(DebugTimer::Count); ++i) {
+		const History& history = timerHistory_[i];
+		snprintf(timerText_[i], sizeof(timerText_[i]), "%-12s avg %6.3f ms  max %6.3f ms",
+			kTimerNames[i], history.average, history.max);
+	}
+	for (int i = 0; i < static_cast<int>(DebugCounter::Count); ++i) {
+		const History& history = counterHistory_[i];
+		snprintf(counterText_[i], sizeof(counterText_[i]), "%-18s %5d  (max %5.0f)",
+			kCounterNames[i], counters_[i].load(std::memory_order_relaxed), history.max);
+	}
+
+	const History& frame = timerHistory_[static_cast<int>(DebugTimer::Frame)];
+	snprintf(overlayText_, sizeof(overlayText_), "Frame: %.2f ms  Objects: %d  Draw Calls: %d  MapChip: %d  Particles: %d",
+		frame.average,
+		GetCounter(DebugCounter::ObjectCount),
+		GetCounter(DebugCounter::DrawCalls),
+		GetCounter(DebugCounter::MapChipDrawCalls),
+		GetCounter(DebugCounter::ActiveParticles));
+}
+
+// ========== 表示 ==========
+void DebugStats::DrawOverlay() {
+#ifdef _DEBUG
+	if (!showOverlay_) return;
+	Novice::ScreenPrintf(0, 0, "%s", overlayText_);
+#endif
+}
+
+void DebugStats::ShowDebugWindow() {
+#ifdef _DEBUG
+	ImGui::Begin("Frame Stats");
+
+	// ========== サンプリング設定 ==========
+	if (ImGui::CollapsingHeader("Sampling", ImGuiTreeNodeFlags_DefaultOpen)) {
+		ImGui::Checkbox("Pause History", &isPaused_);
+		ImGui::SameLine();
+		ImGui::Checkbox("Screen Overlay", &showOverlay_);
+		ImGui::SliderInt("Heavy Panel Interval", &heavyPanelInterval_, 1, 60);
+		ImGui::SliderInt("Text Refresh Interval", &textInterval_, 1, 60);
+		ImGui::Text("Frame: %u  Heavy: %s", frameIndex_, isHeavyFrame_ ? "Yes" : "No");
+	}
+
+	// ========== 処理時間 ==========
+	if (ImGui::CollapsingHeader("Subsystem Time", ImGuiTreeNodeFlags_DefaultOpen)) {
+		const History& frame = timerHistory_[static_cast<int>(DebugTimer::Frame)];
+		ImGui::PlotHistogram("##FrameTime", frame.values.data(), kHistorySize, frame.head,
+			timerText_[static_cast<int>(DebugTimer::Frame)], 0.0f, 33.3f, ImVec2(0, 60));
+
+		for (int i = 1; i < static_cast<int>(DebugTimer::Count); ++i) {
+			const History& history = timerHistory_[i];
+			ImGui::PushID(i);
+			ImGui::PlotLines("##Timer", history.values.data(), kHistorySize, history.head,
+				timerText_[i], 0.0f, frame.max > 0.0f ? frame.max : 16.6f, ImVec2(0, 30));
+			ImGui::PopID();
+		}
+	}
+
+	// ========== カウンター ==========
+	if (ImGui::CollapsingHeader("Counters", ImGuiTreeNodeFlags_DefaultOpen)) {
+		for (int i = 0; i < static_cast<int>(DebugCounter::Count); ++i) {
+			const History& history = counterHistory_[i];
+			ImGui::PushID(i);
+			ImGui::PlotLines("##Counter", history.values.data(), kHistorySize, history.head,
+				counterText_[i], 0.0f, history.max > 0.0f ? history.max * 1.2f : 1.0f, ImVec2(0, 30));
+			ImGui::PopID();
+		}
+	}
+
+	ImGui::End();
+#endif
+}
@@ -0,0 +1,157 @@
+﻿#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+
+/// <summary>
+/// フレームごとに集計するカウンター
+/// </summary>
+enum class DebugCounter {
+	ObjectCount,       // GameObjectManager のオブジェクト数
+	DrawCalls,         // DrawComponent2D の描画回数
+	MapChipDrawCalls,  // MapChip の描画回数
+	ActiveParticles,   // 生存中のパーティクル数
+	EffectTracks,      // 再生中のエフェクトトラック数
+	AsyncJobs,         // 完了待ちの非同期I/Oジョブ数
+	Count
+};
+
+/// <summary>
+/// サブシステムごとの処理時間
+/// </summary>
+enum class DebugTimer {
+	Frame,        // 1フレーム全体（EndFrame 直前まで）
+	SceneUpdate,  // シーン更新全体
+	Map,          // マップ更新
+	EnemyAI,      // 敵AIのバッチ更新
+	Objects,      // GameObjectManager::Update
+	Particles,    // パーティクル更新
+	UI,           // UI更新
+	SceneDraw,    // シーン描画全体
+	Count
+};
+
+/// <summary>
+/// デバッグ用の統計（カウンター・処理時間の履歴）
+/// 値の書き込みは atomic のみで、文字列の整形は固定バッファに間引いて行う。
+/// デバッグ表示そのものが計測を歪めないようにするためのもの
+/// </summary>
+class DebugStats {
+public:
+	static DebugStats& GetInstance() {
+		static DebugStats instance;
+		return instance;
+	}
+
+	DebugStats(const DebugStats&) = delete;
+	DebugStats& operator=(const DebugStats&) = delete;
+
+	static constexpr int kHistorySize = 120;
+
+	// ========== カウンター（どのスレッドからでも呼べる） ==========
+	void SetCounter(DebugCounter counter, int value) {
+		counters_[static_cast<int>(counter)].store(value, std::memory_order_relaxed);
+	}
+	void AddCounter(DebugCounter counter, int delta = 1) {
+		counters_[static_cast<int>(counter)].fetch_add(delta, std::memory_order_relaxed);
+	}
+	int GetCounter(DebugCounter counter) const {
+		return counters_[static_cast<int>(counter)].load(std::memory_order_relaxed);
+	}
+
+	// ========== 処理時間（フレーム内で加算される） ==========
+	void AddTime(DebugTimer timer, long long nanoseconds) {
+		timerAccumNs_[static_cast<int>(timer)].fetch_add(nanoseconds, std::memory_order_relaxed);
+	}
+
+	// 直近フレームの処理時間（ms）
+	float GetLastTimeMs(DebugTimer timer) const {
+		const History& history = timerHistory_[static_cast<int>(timer)];
+		return history.values[(history.head + kHistorySize - 1) % kHistorySize];
+	}
+
+	// ========== フレーム境界 ==========
+	void BeginFrame();
+	void EndFrame();
+
+	/// <summary>
+	/// 重いパネル（一覧の集計など）を今フレーム更新してよいか
+	/// heavyPanelInterval_ フレームに1回 true になる
+	/// </summary>
+	bool ShouldUpdateHeavyPanels() const { return isHeavyFrame_; }
+
+	int GetHeavyPanelInterval() const { return heavyPanelInterval_; }
+
+	// ========== 表示 ==========
+	void ShowDebugWindow();
+
+	// 画面左上への簡易表示（整形済みのバッファを出すだけ）
+	void DrawOverlay();
+
+private:
+	DebugStats();
+	~DebugStats() = default;
+
+	// 固定長のリングバッファ（PlotLines にそのまま渡せる）
+	struct History {
+		std::array<float, kHistorySize> values{};
+		int head = 0;     // 次に書き込む位置
+		float average = 0.0f;
+		float max = 0.0f;
+
+		void Push(float value);
+	};
+
+	// 表示用の文字列を固定バッファに整形する
+	void RefreshText();
+
+	std::array<std::atomic<int>, static_cast<int>(DebugCounter::Count)> counters_;
+	std::array<std::atomic<long long>, static_cast<int>(DebugTimer::Count)> timerAccumNs_;
+
+	std::array<History, static_cast<int>(DebugTimer::Count)> timerHistory_;
+	std::array<History, static_cast<int>(DebugCounter::Count)> counterHistory_;
+
+	// 整形済みテキスト（毎フレームは作り直さない）
+	char overlayText_[160] = {};
+	char timerText_[static_cast<int>(DebugTimer::Count)][64] = {};
+	char counterText_[static_cast<int>(DebugCounter::Count)][64] = {};
+
+	std::chrono::steady_clock::time_point frameStart_;
+
+	// サンプリング設定
+	int heavyPanelInterval_ = 10; // 重いパネルの更新間隔（フレーム）
+	int textInterval_ = 15;       // 文字列の整形間隔（フレーム）
+	bool isPaused_ = false;       // 履歴の記録を止める
+	bool showOverlay_ = true;
+
+	unsigned int frameIndex_ = 0;
+	bool isHeavyFrame_ = true;
+};
+
+/// <summary>
+/// スコープの処理時間を DebugStats に加算する
+/// リリースビルドでは何もしない
+/// </summary>
+class DebugScopedTimer {
+public:
+	explicit DebugScopedTimer(DebugTimer timer) : timer_(timer) {
+#ifdef _DEBUG
+		start_ = std::chrono::steady_clock::now();
+#endif
+	}
+
+	~DebugScopedTimer() {
+#ifdef _DEBUG
+		auto elapsed = std::chrono::steady_clock::now() - start_;
+		DebugStats::GetInstance().AddTime(timer_,
+			std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+#endif
+	}
+
+	DebugScopedTimer(const DebugScopedTimer&) = delete;
+	DebugScopedTimer& operator=(const DebugScopedTimer&) = delete;
+
+private:
+	DebugTimer timer_;
+	std::chrono::steady_clock::time_point start_;
+};
@@ -3,8 +3,10 @@
 #include "Player.h"
 #include "Usagi.hpp"
 #include "Easing.h"
+#include "Tween.h"
 #include "ParticleManager.h"
 #include "ParticleRegistry.h"
+#include "DebugStats.h"
 
 #ifdef _DEBUG
 #include <imgui.h>
@@ -144,23 +146,23 @@ void DebugWindow::DrawCameraDebugWindow(Camera2D* camera) {
 			ImGui::SliderFloat("Duration##zoom", &zoomDuration, 0.1f, 5.0f);
 
 			if (ImGui::Button("Zoom In (2x)")) {
-				camera->ZoomTo(2.0f, 1.0f, Easing::EaseOutQuad);
+				camera->ZoomTo(2.0f, 1.0f, EaseType::EaseOutQuad);
 			}
 
 			ImGui::SameLine();
 
 			if (ImGui::Button("Zoom Out (1x)")) {
-				camera->ZoomTo(1.0f, 1.0f, Easing::EaseInOutQuad);
+				camera->ZoomTo(1.0f, 1.0f, EaseType::EaseInOutQuad);
 			}
 
 			if (ImGui::Button("Zoom to Target")) {
-				camera->ZoomTo(targetZoom, zoomDuration, Easing::EaseOutQuad);
+				camera->ZoomTo(targetZoom, zoomDuration, EaseType::EaseOutQuad);
 			}
 
 			ImGui::Text("Active: %s", camera->zoomEffect_.isActive ? "Yes" : "No");
-			if (camera->zoomEffect_.isActive) {
-				ImGui::Text("Progress: %.1f%%",
-					(camera->zoomEffect_.elapsed / camera->zoomEffect_.duration) * 100.0f);
+			float zoomProgress = 0.0f;
+			if (camera->zoomEffect_.isActive && TweenManager::GetInstance().Sample(camera->zoomEffect_.tween, zoomProgress)) {
+				ImGui::Text("Progress: %.1f%%", zoomProgress * 100.0f);
 			}
 
 			ImGui::TreePop();
@@ -175,19 +177,19 @@ void DebugWindow::DrawCameraDebugWindow(Camera2D* camera) {
 			ImGui::SliderFloat("Duration##move", &moveDuration, 0.1f, 5.0f);
 
 			if (ImGui::Button("Move to Center")) {
-				camera->MoveTo({ 640.0f, 360.0f }, 2.0f, Easing::EaseOutCubic);
+				camera->MoveTo({ 640.0f, 360.0f }, 2.0f, EaseType::EaseOutCubic);
 			}
 
 			ImGui::SameLine();
 
 			if (ImGui::Button("Move to Target")) {
-				camera->MoveTo({ targetPos[0], targetPos[1] }, moveDuration, Easing::EaseOutQuad);
+				camera->MoveTo({ targetPos[0], targetPos[1] }, moveDuration, EaseType::EaseOutQuad);
 			}
 
 			ImGui::Text("Active: %s", camera->moveEffect_.isActive ? "Yes" : "No");
-			if (camera->moveEffect_.isActive) {
-				ImGui::Text("Progress: %.1f%%",
-					(camera->moveEffect_.elapsed / camera->moveEffect_.duration) * 100.0f);
+			float moveProgress = 0.0f;
+			if (camera->moveEffect_.isActive && TweenManager::GetInstance().Sample(camera->moveEffect_.tween, moveProgress)) {
+				ImGui::Text("Progress: %.1f%%", moveProgress * 100.0f);
 			}
 
 			ImGui::TreePop();
@@ -347,22 +349,13 @@ void DebugWindow::DrawParticleDebugWindow(ParticleManager* particleManager, Usag
 		static char filepath[256] = "Resources/Data/particle_params.json";
 		ImGui::InputText("File Path", filepath, sizeof(filepath));
 
+		// 読み書きはワーカーで行い、結果は完了時にコンソールへ出る
 		if (ImGui::Button("Save Parameters", ImVec2(140, 30))) {
-			if (particleManager->SaveParamsToJson(filepath)) {
-				Novice::ConsolePrintf("✓ Saved to: %s\n", filepath);
-			}
-			else {
-				Novice::ConsolePrintf("✗ Failed to save: %s\n", filepath);
-			}
+			particleManager->SaveParamsToJsonAsync(filepath);
 		}
 		ImGui::SameLine();
 		if (ImGui::Button("Load Parameters", ImVec2(140, 30))) {
-			if (particleManager->LoadParamsFromJson(filepath)) {
-				Novice::ConsolePrintf("✓ Loaded from: %s\n", filepath);
-			}
-			else {
-				Novice::ConsolePrintf("✗ Failed to load: %s\n", filepath);
-			}
+			particleManager->LoadParamsFromJsonAsync(filepath);
 		}
 	}
 
@@ -372,17 +365,8 @@ void DebugWindow::DrawParticleDebugWindow(ParticleManager* particleManager, Usag
 	// アクティブパーティクル統計
 	// ========================================
 	if (ImGui::CollapsingHeader("Active Particles", ImGuiTreeNodeFlags_DefaultOpen)) {
-		// パーティクルタイプごとにカウント
-		std::map<ParticleType, int> particleCounts;
-		int totalActive = 0;
-
-		for (const auto& p : particleManager->particles_) {
-			if (p.IsAlive()) {
-				particleCounts[p.GetType()]++;
-				totalActive++;
-			}
-		}
-
+		// タイプごとの生存数はマネージャーが発生・消滅時に数えているので走査しない
+		const int totalActive = particleManager->GetLiveCount();
 		ImGui::Text("Total Active: %d / %d", totalActive, particleManager->kMaxParticles);
 		ImGui::ProgressBar(static_cast<float>(totalActive) / particleManager->kMaxParticles,
 			ImVec2(-1, 0), "");
@@ -394,7 +378,8 @@ void DebugWindow::DrawParticleDebugWindow(ParticleManager* particleManager, Usag
 
 		const auto& allTypes = ParticleRegistry::GetAllParticleTypes();
 		for (const auto& typeInfo : allTypes) {
-			int count = particleCounts[typeInfo.type];
+			const ParticleTypeStats& stats = particleManager->GetStats(typeInfo.type);
+			const int count = stats.live;
 
 			if (count > 0) {
 				ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 1.0f, 0.0f, 1.0f));
@@ -405,6 +390,13 @@ void DebugWindow::DrawParticleDebugWindow(ParticleManager* particleManager, Usag
 
 			ImGui::BulletText("%s: %d", typeInfo.name.c_str(), count);
 			ImGui::PopStyleColor();
+
+			// 予算・カリングで削った数
+			if (stats.dropped > 0 || stats.culled > 0 || stats.lodReduced > 0 || stats.evicted > 0) {
+				ImGui::SameLine();
+				ImGui::TextDisabled("(drop %d / cull %d / lod %d / evict %d)",
+					stats.dropped, stats.culled, stats.lodReduced, stats.evicted);
+			}
 		}
 
 		ImGui::EndChild();
@@ -416,12 +408,13 @@ void DebugWindow::DrawParticleDebugWindow(ParticleManager* particleManager, Usag
 // カテゴリ別パーティクルエディタ
 // ========================================
 	if (ImGui::CollapsingHeader("Particle Editor", ImGuiTreeNodeFlags_DefaultOpen)) {
-		const auto& allTypes = ParticleRegistry::GetAllParticleTypes();
-
-		// カテゴリごとにグループ化
-		std::map<std::string, std::vector<const ParticleTypeInfo*>> categorized;
-		for (const auto& typeInfo : allTypes) {
-			categorized[typeInfo.category].push_back(&typeInfo);
+		// カテゴリごとにグループ化（初回だけ）
+		if (particleCategories_.empty()) {
+			std::map<std::string, std::vector<const ParticleTypeInfo*>> categorized;
+			for (const auto& typeInfo : ParticleRegistry::GetAllParticleTypes()) {
+				categorized[typeInfo.category].push_back(&typeInfo);
+			}
+			particleCategories_.assign(categorized.begin(), categorized.end());
 		}
 
 		// ★修正：currentEditType をタブバーの外に移動
@@ -429,7 +422,7 @@ void DebugWindow::DrawParticleDebugWindow(ParticleManager* particleManager, Usag
 
 		// カテゴリ別タブ表示
 		if (ImGui::BeginTabBar("ParticleCategories", ImGuiTabBarFlags_None)) {
-			for (const auto& [category, types] : categorized) {
+			for (const auto& [category, types] : particleCategories_) {
 				if (ImGui::BeginTabItem(category.c_str())) {
 					ImGui::Spacing();
 
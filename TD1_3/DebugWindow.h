@@ -1,10 +1,14 @@
 ﻿#pragma once
+#include <string>
+#include <utility>
+#include <vector>
 
 // 前方宣言
 class Camera2D;
 class Player;
 class Usagi;
 class ParticleManager;
+struct ParticleTypeInfo;
 
 /// <summary>
 /// 統合デバッグウィンドウ
@@ -51,4 +55,7 @@ private:
 	bool showEnvironmentParticles_ = true;
 	bool showActiveParticles_ = true;
 	bool showParticleParams_ = false;
+
+	// カテゴリ別のタイプ一覧（レジストリは起動後に変わらないので1回だけ作る）
+	std::vector<std::pair<std::string, std::vector<const ParticleTypeInfo*>>> particleCategories_;
 };
\ No newline at end of file
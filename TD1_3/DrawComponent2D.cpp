@@ -1,8 +1,10 @@
 ﻿#include "DrawComponent2D.h"
 #include "Affine2D.h"
 #include <algorithm>
+#include <cmath>
 #include "TextureManager.h"
 #include "WindowSize.h"
+#include "DebugStats.h"
 
 // ========== コンストラクタ ==========
 
@@ -10,16 +12,9 @@ DrawComponent2D::DrawComponent2D(int graphHandle, int divX, int divY,
 	int totalFrames, float speed, bool isLoop)
 	: graphHandle_(graphHandle) {
 
-	// 画像サイズを自動取得
-	InitializeImageSize(divX, divY);
-
-	// アニメーション作成
-	int frameWidth = static_cast<int>(imageSize_.x);
-	int frameHeight = static_cast<int>(imageSize_.y);
-	animation_ = std::make_unique<Animation>(
-		graphHandle, frameWidth, frameHeight, totalFrames, divX, speed, isLoop
-	);
-	animation_->Play();
+	// 共有クリップを取得（フレームサイズ・ソース矩形は計算済み）
+	SetClip(AnimationClipRegistry::GetInstance().GetClip(graphHandle, divX, divY, totalFrames, speed, isLoop));
+	animation_.Play();
 }
 
 DrawComponent2D::DrawComponent2D(TextureId textureId, int divX, int divY,
@@ -27,152 +22,35 @@ DrawComponent2D::DrawComponent2D(TextureId textureId, int divX, int divY,
 
 	graphHandle_ = TextureManager::GetInstance().GetTexture(textureId);
 
-	// 画像サイズを自動取得
-	InitializeImageSize(divX, divY);
-
-	// アニメーション作成
-	int frameWidth = static_cast<int>(imageSize_.x);
-	int frameHeight = static_cast<int>(imageSize_.y);
-	animation_ = std::make_unique<Animation>(
-		graphHandle_, frameWidth, frameHeight, totalFrames, divX, speed, isLoop
-	);
-	animation_->Play();
+	// 共有クリップを取得（フレームサイズ・ソース矩形は計算済み）
+	SetClip(AnimationClipRegistry::GetInstance().GetClip(graphHandle_, divX, divY, totalFrames, speed, isLoop));
+	animation_.Play();
 }
 
 DrawComponent2D::DrawComponent2D(int graphHandle)
 	: graphHandle_(graphHandle) {
 
-	// 静止画として初期化（1x1分割、1フレーム）
-	InitializeImageSize(1, 1);
-
-	// 内部的には1フレームのアニメーションとして扱う
-	int frameWidth = static_cast<int>(imageSize_.x);
-	int frameHeight = static_cast<int>(imageSize_.y);
-	animation_ = std::make_unique<Animation>(
-		graphHandle, frameWidth, frameHeight, 1, 1, 0.0f, false
-	);
+	// 静止画は1フレームのクリップとして扱う
+	SetClip(AnimationClipRegistry::GetInstance().GetClip(graphHandle, 1, 1, 1, 0.0f, false));
 }
 
 DrawComponent2D::DrawComponent2D(TextureId textureId)
 	: graphHandle_(TextureManager::GetInstance().GetTexture(textureId)) {
 
-	// 静止画として初期化（1x1分割、1フレーム）
-	InitializeImageSize(1, 1);
-
-	// 内部的には1フレームのアニメーションとして扱う
-	int frameWidth = static_cast<int>(imageSize_.x);
-	int frameHeight = static_cast<int>(imageSize_.y);
-	animation_ = std::make_unique<Animation>(
-		graphHandle_, frameWidth, frameHeight, 1, 1, 0.0f, false
-	);
+	// 静止画は1フレームのクリップとして扱う
+	SetClip(AnimationClipRegistry::GetInstance().GetClip(graphHandle_, 1, 1, 1, 0.0f, false));
 }
 
 DrawComponent2D::DrawComponent2D()
 	: graphHandle_(-1), imageSize_{ 0.0f, 0.0f }, drawSize_{ 0.0f, 0.0f } {
 }
 
-// コピーコンストラクタ
-DrawComponent2D::DrawComponent2D(const DrawComponent2D& other)
-	: graphHandle_(other.graphHandle_)
-	, imageSize_(other.imageSize_)
-	, drawSize_(other.drawSize_)
-	, transform_(other.transform_)
-	, anchorPoint_(other.anchorPoint_)
-	, baseColor_(other.baseColor_)
-	, flipX_(other.flipX_)
-	, flipY_(other.flipY_)
-	, effect_(other.effect_) {
-
-	if (other.animation_) {
-		animation_ = std::make_unique<Animation>(*other.animation_);
-	}
-}
-
-// ムーブコンストラクタ
-DrawComponent2D::DrawComponent2D(DrawComponent2D&& other) noexcept
-	: graphHandle_(other.graphHandle_)
-	, imageSize_(other.imageSize_)
-	, drawSize_(other.drawSize_)
-	, transform_(other.transform_)
-	, anchorPoint_(other.anchorPoint_)
-	, baseColor_(other.baseColor_)
-	, flipX_(other.flipX_)
-	, flipY_(other.flipY_)
-	, animation_(std::move(other.animation_))
-	, effect_(std::move(other.effect_)) {
-}
-
-// コピー代入演算子
-DrawComponent2D& DrawComponent2D::operator=(const DrawComponent2D& other) {
-	if (this != &other) {
-		graphHandle_ = other.graphHandle_;
-		imageSize_ = other.imageSize_;
-		drawSize_ = other.drawSize_;
-		transform_ = other.transform_;
-		anchorPoint_ = other.anchorPoint_;
-		baseColor_ = other.baseColor_;
-		flipX_ = other.flipX_;
-		flipY_ = other.flipY_;
-		effect_ = other.effect_;
-
-		if (other.animation_) {
-			animation_ = std::make_unique<Animation>(*other.animation_);
-		}
-		else {
-			animation_.reset();
-		}
-	}
-	return *this;
-}
-
-// ムーブ代入演算子
-DrawComponent2D& DrawComponent2D::operator=(DrawComponent2D&& other) noexcept {
-	if (this != &other) {
-		graphHandle_ = other.graphHandle_;
-		imageSize_ = other.imageSize_;
-		drawSize_ = other.drawSize_;
-		transform_ = other.transform_;
-		anchorPoint_ = other.anchorPoint_;
-		baseColor_ = other.baseColor_;
-		flipX_ = other.flipX_;
-		flipY_ = other.flipY_;
-		animation_ = std::move(other.animation_);
-		effect_ = std::move(other.effect_);
-	}
-	return *this;
-}
-
 // ========== 初期化 ==========
-void DrawComponent2D::InitializeImageSize(int divX, int divY) {
-	// ハンドルが無効な場合は早期リターン
-	if (graphHandle_ < 0) {
-		imageSize_ = { 0.0f, 0.0f };
-		drawSize_ = { 0.0f, 0.0f };
-		return;
-	}
-
-	// divXとdivYのゼロチェック（ゼロ除算回避）
-	if (divX <= 0) divX = 1;
-	if (divY <= 0) divY = 1;
-
-	// 画像全体のサイズを取得
-	int fullWidth = 0, fullHeight = 0;
-	Novice::GetTextureSize(graphHandle_, &fullWidth, &fullHeight);
-
-	// GetTextureSizeが失敗した場合のチェック
-	if (fullWidth <= 0 || fullHeight <= 0) {
-		imageSize_ = { 0.0f, 0.0f };
-		drawSize_ = { 0.0f, 0.0f };
-#ifdef _DEBUG
-		Novice::ConsolePrintf("DrawComponent2D::InitializeImageSize - Invalid texture size: %d x %d (handle: %d)\n",
-			fullWidth, fullHeight, graphHandle_);
-#endif
-		return;
-	}
+void DrawComponent2D::SetClip(const AnimationClip* clip) {
+	animation_.SetClip(clip);
 
-	// 1フレーム分のサイズを計算
-	imageSize_.x = static_cast<float>(fullWidth) / divX;
-	imageSize_.y = static_cast<float>(fullHeight) / divY;
+	// 1フレーム分のサイズはクリップのものを使う
+	imageSize_ = clip ? clip->frameSize : Vector2{ 0.0f, 0.0f };
 
 	// 描画サイズのデフォルトは画像サイズと同じ
 	drawSize_ = imageSize_;
@@ -182,9 +60,7 @@ void DrawComponent2D::InitializeImageSize(int divX, int divY) {
 
 void DrawComponent2D::Update(float deltaTime) {
 	// アニメーション更新
-	if (animation_) {
-		animation_->Update(deltaTime);
-	}
+	animation_.Update(deltaTime);
 
 	// エフェクト更新
 	effect_.Update(deltaTime);
@@ -199,16 +75,19 @@ void DrawComponent2D::preDrawSetup() {
 }
 
 void DrawComponent2D::postDrawCleanup() {
-#ifdef _DEBUG
-	Novice::ScreenPrintf(0, 0, "Draw Calls: %d", DrawCount);
-#endif
+	DebugStats::GetInstance().SetCounter(DebugCounter::DrawCalls, DrawCount);
 	DrawCount = 0;
 }
 
 // ========== 描画 ==========
 void DrawComponent2D::Draw(const Camera2D& camera) {
+	// カメラの表示範囲の外なら頂点計算もしない
+	// （アンカー位置によらず覆えるよう、描画サイズの対角を半径にする）
+	const Vector2 finalSize = GetFinalDrawSize();
+	const float radius = std::sqrt(finalSize.x * finalSize.x + finalSize.y * finalSize.y);
+	if (!camera.IsVisible(GetFinalPosition(), { radius, radius })) return;
 
-	Matrix3x3 vpMatrix = camera.GetVpVpMatrix();
+	const Affine2x3& vpMatrix = camera.GetVpVpAffine();
 
 	// カメラのY軸反転設定を確認してスケールを調整
 	if (camera.IsWorldYUp()) {
@@ -237,15 +116,13 @@ void DrawComponent2D::DrawScreen() {
 
 void DrawComponent2D::Initialize() {
 	// アニメーションがある場合は再生を開始
-	if (animation_) {
-		animation_->Initialize();
-	}
+	animation_.Initialize();
 
 	// エフェクトをリセット
 	effect_.StopAll();
 }
 
-void DrawComponent2D::DrawInternal(const Matrix3x3* vpMatrix) {
+void DrawComponent2D::DrawInternal(const Affine2x3* vpMatrix) {
 	if (graphHandle_ < 0) return;
 
 	// 1. ソース矩形（テクスチャのどこを読むか）を計算
@@ -295,17 +172,12 @@ void DrawComponent2D::DrawInternal(const Matrix3x3* vpMatrix) {
 	localVertices[3] = { -anchorOffsetX, currentDrawH - anchorOffsetY + verticalOffset };  // 左下 (height変更)
 
 	// エフェクト適用後の変換行列を取得
-	Matrix3x3 worldMatrix = GetFinalTransformMatrix();
-	Matrix3x3 finalMatrix = worldMatrix;
-	if (vpMatrix) {
-		finalMatrix = Matrix3x3::Multiply(worldMatrix, *vpMatrix);
-	}
+	const Affine2x3 worldMatrix = GetFinalTransformMatrix();
+	const Affine2x3 finalMatrix = vpMatrix ? Affine2x3::Multiply(worldMatrix, *vpMatrix) : worldMatrix;
 
-	// 変換行列を適用
+	// 変換行列を適用（4頂点まとめて）
 	Vector2 screenVertices[4];
-	for (int i = 0; i < 4; ++i) {
-		screenVertices[i] = Matrix3x3::Transform(localVertices[i], finalMatrix);
-	}
+	Affine2x3::TransformPoints(localVertices, screenVertices, 4, finalMatrix);
 
 	// 反転処理
 	if (flipX_) {
@@ -385,12 +257,12 @@ void DrawComponent2D::DrawInternal(const Matrix3x3* vpMatrix) {
 
 // ========== 内部処理 ==========
 
-Matrix3x3 DrawComponent2D::GetFinalTransformMatrix() const {
+Affine2x3 DrawComponent2D::GetFinalTransformMatrix() const {
 	Vector2 finalPos = GetFinalPosition();
 	Vector2 finalScale = GetFinalScale();
 	float finalRotation = GetFinalRotation();
 
-	return AffineMatrix2D::MakeAffine(finalScale, finalRotation, finalPos);
+	return Affine2x3::MakeAffine(finalScale, finalRotation, finalPos);
 }
 
 Vector2 DrawComponent2D::GetFinalPosition() const {
@@ -418,11 +290,12 @@ unsigned int DrawComponent2D::GetFinalColor() const {
 }
 
 void DrawComponent2D::GetSourceRect(int& srcX, int& srcY, int& srcW, int& srcH) const {
-	if (animation_) {
-		srcX = animation_->GetSrcX();
-		srcY = animation_->GetSrcY();
-		srcW = animation_->GetSrcW();
-		srcH = animation_->GetSrcH();
+	if (HasAnimation()) {
+		const AnimationFrameRect& rect = animation_.GetSrcRect();
+		srcX = rect.x;
+		srcY = rect.y;
+		srcW = rect.w;
+		srcH = rect.h;
 	}
 	else {
 		srcX = 0;
@@ -436,61 +309,59 @@ void DrawComponent2D::GetSourceRect(int& srcX, int& srcY, int& srcW, int& srcH)
 
 void DrawComponent2D::SetGraphHandle(int handle) {
 	graphHandle_ = handle;
-	// 画像サイズを再計算
-	if (animation_) {
-		int divX = animation_->GetTotalFrames() > 0 ?
-			(animation_->GetTotalFrames() / animation_->GetFrameHeight()) : 1;
-		int divY = animation_->GetFrameHeight() > 0 ?
-			(animation_->GetFrameHeight() / animation_->GetFrameWidth()) : 1;
-		InitializeImageSize(divX, divY);
+	// 同じ分割設定で新しい画像のクリップに差し替える
+	if (const AnimationClip* clip = animation_.GetClip()) {
+		SetClip(AnimationClipRegistry::GetInstance().GetClip(
+			handle, clip->divX, clip->divY, clip->totalFrames, clip->frameDuration, clip->isLoop));
 	}
 }
 
 // ========== アニメーション制御 ==========
 
 void DrawComponent2D::PlayAnimation() {
-	if (animation_) animation_->Play();
+	animation_.Play();
 }
 
 void DrawComponent2D::StopAnimation() {
-	if (animation_) animation_->Stop();
+	animation_.Stop();
 }
 
 void DrawComponent2D::PauseAnimation() {
-	if (animation_) animation_->Pause();
+	animation_.Pause();
 }
 
 void DrawComponent2D::ResumeAnimation() {
-	if (animation_) animation_->Resume();
+	animation_.Resume();
 }
 
 void DrawComponent2D::SetAnimationFrame(int frame) {
-	if (animation_) animation_->SetFrame(frame);
+	animation_.SetFrame(frame);
 }
 
 bool DrawComponent2D::IsAnimationPlaying() const {
-	return animation_ ? animation_->IsPlaying() : false;
+	return HasAnimation() && animation_.IsPlaying();
 }
 
 int DrawComponent2D::GetCurrentFrame() const {
-	return animation_ ? animation_->GetCurrentFrame() : 0;
+	return animation_.GetCurrentFrame();
 }
 
 int DrawComponent2D::GetTotalFrames() const {
-	return animation_ ? animation_->GetTotalFrames() : 1;
+	return animation_.GetTotalFrames();
 }
 
 void DrawComponent2D::Setup(int graphHandle, int divX, int divY, int totalFrames, float speed, bool isLoop) {
 	// 画像ハンドルを設定
 	graphHandle_ = graphHandle;
 
-	// ゼロチェック
-	if (divX <= 0) divX = 1;
-	if (divY <= 0) divY = 1;
-	if (totalFrames <= 0) totalFrames = 1;
-
-	// 画像サイズを再計算
-	InitializeImageSize(divX, divY);
+	// 共有クリップに差し替え（静止画は1フレームのクリップとして扱う）
+	if (totalFrames > 1 || (divX > 1 || divY > 1)) {
+		SetClip(AnimationClipRegistry::GetInstance().GetClip(graphHandle, divX, divY, totalFrames, speed, isLoop));
+		animation_.Play();
+	}
+	else {
+		SetClip(AnimationClipRegistry::GetInstance().GetClip(graphHandle, 1, 1, 1, 0.0f, false));
+	}
 
 	// 画像サイズが無効な場合は処理を中断
 	if (imageSize_.x <= 0.0f || imageSize_.y <= 0.0f) {
@@ -500,39 +371,9 @@ void DrawComponent2D::Setup(int graphHandle, int divX, int divY, int totalFrames
 		return;
 	}
 
-	// アニメーションを再生成
-	int frameWidth = static_cast<int>(imageSize_.x);
-	int frameHeight = static_cast<int>(imageSize_.y);
-
-	// フレームサイズが無効な場合もチェック
-	if (frameWidth <= 0 || frameHeight <= 0) {
-#ifdef _DEBUG
-		Novice::ConsolePrintf("DrawComponent2D::Setup - Invalid frame size: %d x %d\n", frameWidth, frameHeight);
-#endif
-		return;
-	}
-
-	if (totalFrames > 1 || (divX > 1 || divY > 1)) {
-		animation_ = std::make_unique<Animation>(
-			graphHandle, frameWidth, frameHeight, totalFrames, divX, speed, isLoop
-		);
-		if (animation_) {
-			animation_->Play();
-		}
-	}
-	else {
-		// 静止画の場合は1フレームのアニメーションとして扱う
-		animation_ = std::make_unique<Animation>(
-			graphHandle, frameWidth, frameHeight, 1, 1, 0.0f, false
-		);
-	}
-
-	// エフェクトをリセット
+	// エフェクトをリセット（トラックを返却するのでフェード色も白に戻る）
 	effect_.StopAll();
 
-	// フェードエフェクトの色を明示的に初期化
-	effect_ = Effect(); // コンストラクタで再初期化
-
 	// 基本パラメータをリセット
 	transform_.translate = { 0.0f, 0.0f };
 	transform_.scale = { 1.0f, 1.0f };
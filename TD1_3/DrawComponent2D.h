@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "Vector2.h"
 #include "Matrix3x3.h"
+#include "Affine2x3.h"
 #include "Camera2D.h"
 #include "Effect.h"
 #include "Animation.h"
@@ -65,11 +66,11 @@ public:
 
 	~DrawComponent2D() = default;
 
-	// コピー・ムーブ
-	DrawComponent2D(const DrawComponent2D& other);
-	DrawComponent2D(DrawComponent2D&& other) noexcept;
-	DrawComponent2D& operator=(const DrawComponent2D& other);
-	DrawComponent2D& operator=(DrawComponent2D&& other) noexcept;
+	// コピー・ムーブ（クリップは共有なのでメンバごとのコピーで良い）
+	DrawComponent2D(const DrawComponent2D& other) = default;
+	DrawComponent2D(DrawComponent2D&& other) noexcept = default;
+	DrawComponent2D& operator=(const DrawComponent2D& other) = default;
+	DrawComponent2D& operator=(DrawComponent2D&& other) noexcept = default;
 
 	// ========== 更新 ==========
 
@@ -109,7 +110,7 @@ public:
 	/// <summary>
 	/// Y軸反転描画
 	/// </summary>
-	void DrawInternal(const Matrix3x3* vpMatrix);
+	void DrawInternal(const Affine2x3* vpMatrix);
 
 	// クロップ率の設定 (0.0f:非表示 ～ 1.0f:全表示)
 	void SetCropRatio(float ratio) { cropRatio_ = std::clamp(ratio, 0.0f, 1.0f); }
@@ -142,6 +143,11 @@ public:
 	/// </summary>
 	Vector2 GetImageSize() const { return imageSize_; }
 
+	/// <summary>
+	/// 現在のフレームのソース矩形を取得（残像の記録などで使用）
+	/// </summary>
+	void GetSourceRect(int& srcX, int& srcY, int& srcW, int& srcH) const;
+
 	/// <summary>
 	/// 描画サイズを設定（画像と異なるサイズで描画したい場合）
 	/// </summary>
@@ -201,7 +207,7 @@ public:
 	void ResumeAnimation();
 	void SetAnimationFrame(int frame);
 
-	bool HasAnimation() const { return animation_ != nullptr; }
+	bool HasAnimation() const { return animation_.GetClip() != nullptr; }
 	bool IsAnimationPlaying() const;
 	int GetCurrentFrame() const;
 	int GetTotalFrames() const;
@@ -273,6 +279,9 @@ public:
 	// エフェクトリセット
 	void StopAllEffects() { effect_.StopAll(); }
 
+	// 再生中のエフェクトを途中状態のまま引き継ぐ（from 側は何も再生していない状態になる）
+	void TakeOverEffects(DrawComponent2D& from) { effect_.TakeOver(from.effect_); }
+
 	// エフェクト状態確認
 	bool IsAnyEffectActive() const { return effect_.IsAnyActive(); }
 	bool IsShakeActive() const { return effect_.IsShakeActive(); }
@@ -297,7 +306,7 @@ private:
 	int graphHandle_ = -1;
 	Vector2 imageSize_ = { 0.0f, 0.0f };      // 画像の元サイズ（1フレーム分）
 	Vector2 drawSize_ = { 0.0f, 0.0f };       // 描画サイズ
-	std::unique_ptr<Animation> animation_;   // アニメーション管理
+	Animation animation_;   // 再生カーソル（フレーム情報は共有クリップ）
 
 	// ========== 変形パラメータ ==========
 	//Vector2 position_ = { 0.0f, 0.0f };
@@ -323,14 +332,14 @@ private:
 	// ========== 内部処理 ==========
 
 	/// <summary>
-	/// 画像サイズを自動取得してimageSize_を設定
+	/// 共有クリップを設定してimageSize_を更新
 	/// </summary>
-	void InitializeImageSize(int divX, int divY);
+	void SetClip(const AnimationClip* clip);
 
 	/// <summary>
 	/// エフェクト適用後の最終的な変換行列を取得
 	/// </summary>
-	Matrix3x3 GetFinalTransformMatrix() const;
+	Affine2x3 GetFinalTransformMatrix() const;
 
 	/// <summary>
 	/// エフェクト適用後の最終的な位置を取得
@@ -351,9 +360,4 @@ private:
 	/// 描画用の頂点座標を計算
 	/// </summary>
 	//void CalculateVertices(Vector2 vertices[4]) const;
-
-	/// <summary>
-	/// アニメーションのソース矩形を取得
-	/// </summary>
-	void GetSourceRect(int& srcX, int& srcY, int& srcW, int& srcH) const;
 };
\ No newline at end of file
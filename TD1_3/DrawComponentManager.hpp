@@ -37,18 +37,18 @@ public:
     bool ChangeComponent(const int name) {
         auto it = components_.find(name);
         if (it != components_.end() && activeComponent_ != it->second) {
-            // エフェクト転送を先に行ってから停止
-            // エフェクト状態を引き継ぐ
+            // エフェクト状態を引き継ぐ（古いコンポーネントは何も再生していない状態になる）
             TransferEffectState(activeComponent_, it->second);
 
-            // 古いコンポーネントのフラッシュを停止（新しいコンポーネントは既に転送済み）
-            if (activeComponent_) {
-                activeComponent_->StopFlashBlink();
-            }
-
             activeComponent_ = it->second;
             activeComponentName_ = name;
             activeComponent_->PlayAnimation();
+
+            // 非アクティブ中は更新していないので、共通設定をここで反映
+            activeComponent_->SetFlipX(flipX_);
+            if (hasTransform_) {
+                activeComponent_->SetTransform(transform_);
+            }
             return true;
         }
         return false;
@@ -70,21 +70,20 @@ public:
     }
 
     /// <summary>
-    /// 全コンポーネントに共通設定を適用
+    /// 共通設定（アクティブなコンポーネントにだけ適用し、切り替え時に引き継ぐ）
     /// </summary>
     void SetFlipX(bool flipX) {
-        for (auto& pair : components_) {
-            if (pair.second) {
-                pair.second->SetFlipX(flipX);
-            }
+        flipX_ = flipX;
+        if (activeComponent_) {
+            activeComponent_->SetFlipX(flipX);
         }
     }
 
     void SetTransform(const Transform2D& transform) {
-        for (auto& pair : components_) {
-            if (pair.second) {
-                pair.second->SetTransform(transform);
-            }
+        transform_ = transform;
+        hasTransform_ = true;
+        if (activeComponent_) {
+            activeComponent_->SetTransform(transform);
         }
     }
 
@@ -95,77 +94,45 @@ public:
     }
 
     /// <summary>
-    /// エフェクト開始（全コンポーネントに適用）
+    /// エフェクト開始
+    /// 切り替え時にエフェクトごと引き継ぐので、アクティブなコンポーネントにだけ適用する
     /// </summary>
     void StartHitEffect() {
-        effectState_.isHitEffectActive = true;
-        effectState_.hitEffectTimer = 0.0f;
-        
-        for (auto& pair : components_) {
-            if (pair.second) {
-                pair.second->StartHitEffect();
-            }
+        if (activeComponent_) {
+            activeComponent_->StartHitEffect();
         }
     }
 
     void StartShake(float intensity, float duration) {
-        for (auto& pair : components_) {
-            if (pair.second) {
-                pair.second->StartShake(intensity, duration);
-            }
+        if (activeComponent_) {
+            activeComponent_->StartShake(intensity, duration);
         }
 	}
 
     void StartPulse(float minScale, float maxScale, float duration) {
-        effectState_.isPulseActive = true;
-        effectState_.pulseMinScale = minScale;
-        effectState_.pulseMaxScale = maxScale;
-        effectState_.pulseDuration = duration;
-        
-        for (auto& pair : components_) {
-            if (pair.second) {
-                pair.second->StartPulse(minScale, maxScale, duration);
-            }
+        if (activeComponent_) {
+            activeComponent_->StartPulse(minScale, maxScale, duration);
         }
     }
 
     void StartSquash(const Vector2& targetScale, float duration) {
-        for (auto& pair : components_) {
-            if (pair.second) {
-                pair.second->StartSquash(targetScale, duration);
-            }
+        if (activeComponent_) {
+            activeComponent_->StartSquash(targetScale, duration);
         }
 	}
 
     void StartFlashBlink(unsigned int color, int count, float duration, BlendMode blendMode, unsigned int layer = 1, bool forceOverride = false) {
+        if (!activeComponent_) return;
+
         // 既にフラッシュが実行中で、強制上書きがfalseの場合はスキップ
-        if (effectState_.isFlashBlinkActive && !forceOverride) {
+        if (activeComponent_->IsFlashBlinking() && !forceOverride) {
 #ifdef _DEBUG
-            Novice::ConsolePrintf("[FlashBlink] Already active, skipping (count=%d remaining)\n", effectState_.flashCount);
+            Novice::ConsolePrintf("[FlashBlink] Already active, skipping (count=%d remaining)\n", activeComponent_->GetFlashRemainingCount());
 #endif
             return;
         }
 
-        effectState_.isFlashBlinkActive = true;
-        effectState_.flashColor = color;
-        effectState_.flashCount = count;
-        effectState_.flashDuration = duration;
-        effectState_.blendMode = blendMode;
-        effectState_.flashLayer = layer;
-        effectState_.flashTimer = 0.0f;
-        effectState_.isFlashOn = true;
-
-        // アクティブなコンポーネントのみに適用
-        if (activeComponent_) {
-            activeComponent_->StartFlashBlink(color, count, duration, blendMode, layer);
-        }
-
-        // 他のコンポーネントのフラッシュを明示的に停止
-        for (auto& pair : components_) {
-            if (pair.second && pair.second != activeComponent_) {
-                pair.second->StopFlashBlink();
-            }
-        }
+        activeComponent_->StartFlashBlink(color, count, duration, blendMode, layer);
     }
 
     // 強制的にフラッシュを開始するメソッド
@@ -174,12 +141,8 @@ public:
     }
 
     void StopFlashBlink() {
-        effectState_.isFlashBlinkActive = false;
-
-        for (auto& pair : components_) {
-            if (pair.second) {
-                pair.second->StopFlashBlink();
-            }
+        if (activeComponent_) {
+            activeComponent_->StopFlashBlink();
         }
     }
 
@@ -191,19 +154,6 @@ public:
     void Update(float deltaTime) {
         if (activeComponent_) {
             activeComponent_->Update(deltaTime);
-
-            // アクティブコンポーネントからフラッシュの進行状況を取得して同期
-            if (effectState_.isFlashBlinkActive) {
-                if (activeComponent_->IsFlashBlinking()) {
-                    effectState_.flashCount = activeComponent_->GetFlashRemainingCount();
-                    effectState_.flashTimer = activeComponent_->GetFlashTimer();
-                    effectState_.isFlashOn = activeComponent_->IsFlashCurrentlyOn();
-                }
-                else {
-                    // アクティブコンポーネントのフラッシュが終了したら全て停止
-                    effectState_.isFlashBlinkActive = false;
-                }
-            }
         }
     }
 
@@ -226,66 +176,19 @@ public:
 private:
     /// <summary>
     /// エフェクト状態を別のコンポーネントに転送
+    /// トラックのハンドルを付け替えるだけなので、再生途中の状態がそのまま続く
     /// </summary>
     void TransferEffectState(DrawComponent2D* from, DrawComponent2D* to) {
         if (!from || !to) return;
-
-        // ヒットエフェクトの転送
-        if (effectState_.isHitEffectActive) {
-            to->StartHitEffect();
-        }
-
-        // パルスエフェクトの転送
-        if (effectState_.isPulseActive) {
-            to->StartPulse(
-                effectState_.pulseMinScale,
-                effectState_.pulseMaxScale,
-                effectState_.pulseDuration
-            );
-        }
-
-        // フラッシュ点滅の転送（改善版）
-        if (effectState_.isFlashBlinkActive && effectState_.flashCount > 0) {
-#ifdef _DEBUG
-            Novice::ConsolePrintf("[TransferEffect] Flash: count=%d, timer=%.2f, on=%d\n",
-                effectState_.flashCount, effectState_.flashTimer, effectState_.isFlashOn);
-#endif
-
-            to->SetFlashBlinkState(
-                effectState_.flashColor,
-                effectState_.flashCount,
-                effectState_.flashDuration,
-                effectState_.flashLayer,
-                effectState_.flashTimer,
-				effectState_.blendMode,
-                effectState_.isFlashOn
-            );
-        }
+        to->TakeOverEffects(*from);
     }
 
-
-    struct EffectState {
-        bool isHitEffectActive = false;
-        float hitEffectTimer = 0.0f;
-
-        bool isPulseActive = false;
-        float pulseMinScale = 1.0f;
-        float pulseMaxScale = 1.0f;
-        float pulseDuration = 0.0f;
-
-        // フラッシュ点滅エフェクト
-        bool isFlashBlinkActive = false;
-        unsigned int flashColor = 0xFFFFFFFF;
-        int flashCount = 0;          // 残り回数（動的に更新される）
-        float flashDuration = 0.0f;
-        unsigned int flashLayer = 1;
-        float flashTimer = 0.0f;
-        bool isFlashOn = false;
-        BlendMode blendMode;
-    };
-
     std::unordered_map<int, DrawComponent2D*> components_;
     DrawComponent2D* activeComponent_ = nullptr;
+
+    // アクティブなコンポーネントに引き継ぐ共通設定
+    bool flipX_ = false;
+    Transform2D transform_;
+    bool hasTransform_ = false;
     int activeComponentName_;
-    EffectState effectState_;
 };
\ No newline at end of file
@@ -2,7 +2,26 @@
 #define _USE_MATH_DEFINES
 #include <math.h>
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
+
+// イージングの種類（Tween やカメラ演出では関数ポインタではなくこの番号で指定する）
+enum class EaseType : uint8_t {
+	Linear,
+	EaseInQuad,
+	EaseOutQuad,
+	EaseInOutQuad,
+	EaseInOutSine,
+	EaseInCubic,
+	EaseOutCubic,
+	EaseInOutCubic,
+	EaseOutBounce,
+	EaseOutBack,
+	EaseInBack,
+	EaseOutElastic,
+	Count // 総数
+};
 
 class Easing {
 public:
@@ -89,4 +108,95 @@ public:
 		float s = p / 4.0f;
 		return powf(2.0f, -10.0f * t) * sinf((t - s) * (2.0f * (float)M_PI) / p) + 1.0f;
 	}
+
+	static float EaseInBack(float t, float overshoot = 1.70158f) {
+		float s = overshoot;
+		return t * t * ((s + 1.0f) * t - s);
+	}
+
+	// ========== 種類指定での評価 ==========
+
+	/// <summary>
+	/// コンパイル時に種類が決まる場合の評価（分岐が消えてインライン展開される）
+	/// </summary>
+	template <EaseType Type>
+	static float Apply(float t) {
+		if constexpr (Type == EaseType::Linear) return Linear(t);
+		else if constexpr (Type == EaseType::EaseInQuad) return EaseInQuad(t);
+		else if constexpr (Type == EaseType::EaseOutQuad) return EaseOutQuad(t);
+		else if constexpr (Type == EaseType::EaseInOutQuad) return EaseInOutQuad(t);
+		else if constexpr (Type == EaseType::EaseInOutSine) return easeInOutSine(t);
+		else if constexpr (Type == EaseType::EaseInCubic) return EaseInCubic(t);
+		else if constexpr (Type == EaseType::EaseOutCubic) return EaseOutCubic(t);
+		else if constexpr (Type == EaseType::EaseInOutCubic) return EaseInOutCubic(t);
+		else if constexpr (Type == EaseType::EaseOutBounce) return EaseOutBounce(t);
+		else if constexpr (Type == EaseType::EaseOutBack) return EaseOutBack(t);
+		else if constexpr (Type == EaseType::EaseInBack) return EaseInBack(t);
+		else if constexpr (Type == EaseType::EaseOutElastic) return EaseOutElastic(t);
+		else static_assert(Type != Type, "未対応の EaseType");
+	}
+
+	/// <summary>
+	/// 実行時に種類を指定する場合の評価（t は 0～1 にクランプ）
+	/// sin / pow を使う曲線は事前計算したテーブルを線形補間して返す
+	/// </summary>
+	static float Evaluate(EaseType type, float t) {
+		t = std::clamp(t, 0.0f, 1.0f);
+		switch (type) {
+		case EaseType::Linear:         return Apply<EaseType::Linear>(t);
+		case EaseType::EaseInQuad:     return Apply<EaseType::EaseInQuad>(t);
+		case EaseType::EaseOutQuad:    return Apply<EaseType::EaseOutQuad>(t);
+		case EaseType::EaseInOutQuad:  return Apply<EaseType::EaseInOutQuad>(t);
+		case EaseType::EaseInCubic:    return Apply<EaseType::EaseInCubic>(t);
+		case EaseType::EaseOutCubic:   return Apply<EaseType::EaseOutCubic>(t);
+		case EaseType::EaseInOutCubic: return Apply<EaseType::EaseInOutCubic>(t);
+		case EaseType::EaseOutBack:    return Apply<EaseType::EaseOutBack>(t);
+		case EaseType::EaseInBack:     return Apply<EaseType::EaseInBack>(t);
+		case EaseType::EaseInOutSine:  return SampleTable(0, t);
+		case EaseType::EaseOutBounce:  return SampleTable(1, t);
+		case EaseType::EaseOutElastic: return SampleTable(2, t);
+		default:                       return t;
+		}
+	}
+
+	// デバッグ表示用の名前
+	static const char* ToString(EaseType type) {
+		static constexpr const char* kNames[] = {
+			"Linear", "EaseInQuad", "EaseOutQuad", "EaseInOutQuad", "EaseInOutSine",
+			"EaseInCubic", "EaseOutCubic", "EaseInOutCubic", "EaseOutBounce",
+			"EaseOutBack", "EaseInBack", "EaseOutElastic",
+		};
+		static_assert(std::size(kNames) == static_cast<size_t>(EaseType::Count), "EaseType と名前の数が一致しません");
+		int index = static_cast<int>(type);
+		return (index >= 0 && index < static_cast<int>(EaseType::Count)) ? kNames[index] : "Unknown";
+	}
+
+private:
+	// テーブルの分割数（端点を含めて kTableSize + 1 個のサンプル）
+	static constexpr int kTableSize = 256;
+	using Table = std::array<std::array<float, kTableSize + 1>, 3>;
+
+	// 初回呼び出し時に1回だけ作る（0: Sine, 1: Bounce, 2: Elastic）
+	static const Table& GetTable() {
+		static const Table table = [] {
+			Table result{};
+			for (int i = 0; i <= kTableSize; ++i) {
+				float t = static_cast<float>(i) / kTableSize;
+				result[0][i] = easeInOutSine(t);
+				result[1][i] = EaseOutBounce(t);
+				result[2][i] = EaseOutElastic(t);
+			}
+			return result;
+		}();
+		return table;
+	}
+
+	static float SampleTable(int row, float t) {
+		const auto& values = GetTable()[row];
+		float f = t * kTableSize;
+		int i = static_cast<int>(f);
+		if (i >= kTableSize) return values[kTableSize];
+		float frac = f - static_cast<float>(i);
+		return values[i] + (values[i + 1] - values[i]) * frac;
+	}
 };
\ No newline at end of file
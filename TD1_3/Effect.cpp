@@ -1,4 +1,5 @@
 ﻿#include "Effect.h"
+#include "EffectSystem.h"
 #include <random>
 #include <algorithm>
 #include <cmath>
@@ -45,15 +46,8 @@ ColorRGBA ColorRGBA::Add(const ColorRGBA& a, const ColorRGBA& b) {
 	);
 }
 
-Effect::Effect() {
-	// フェード効果の初期化（不透明な白）
-	fadeEffect_.currentColor = ColorRGBA(1.0f, 1.0f, 1.0f, 1.0f);
-	fadeEffect_.startColor = ColorRGBA(1.0f, 1.0f, 1.0f, 1.0f);
-	fadeEffect_.targetColor = ColorRGBA(1.0f, 1.0f, 1.0f, 1.0f);
-}
-
-// ========== Effect 更新 ==========
-void Effect::Update(float deltaTime) {
+// ========== EffectTrack 更新 ==========
+void EffectTrack::Advance(float deltaTime) {
 	UpdateShake(deltaTime);
 	UpdateRotation(deltaTime);
 	UpdateFade(deltaTime);
@@ -61,240 +55,387 @@ void Effect::Update(float deltaTime) {
 	UpdateScale(deltaTime);
 	UpdateWobble(deltaTime);
 	UpdateSquash(deltaTime);
+	UpdateFlashBlink(deltaTime);
+}
 
-	// フラッシュ点滅の更新
-	if (flashBlink_.isActive) {
-		flashBlink_.flashTimer += deltaTime / 60.0f;
+bool EffectTrack::IsIdle() const {
+	if (shake.isActive || rotation.isActive || fade.isActive || flash.isActive ||
+		flashBlink.isActive || scale.isActive || wobble.isActive || squash.isActive) {
+		return false;
+	}
 
-		if (flashBlink_.flashTimer >= flashBlink_.flashDuration) {
-			flashBlink_.flashTimer -= flashBlink_.flashDuration;
-			flashBlink_.isFlashOn = !flashBlink_.isFlashOn;
+	// フェード後の色は次のフェードの開始色になるので、白以外なら持っておく
+	const ColorRGBA& color = fade.currentColor;
+	return color.r == 1.0f && color.g == 1.0f && color.b == 1.0f && color.a == 1.0f;
+}
 
-			if (!flashBlink_.isFlashOn) {
-				flashBlink_.flashCount--;
-				if (flashBlink_.flashCount <= 0) {
-					StopFlashBlink();
-				}
-			}
+void EffectTrack::Reset() {
+	*this = EffectTrack();
+}
+
+void EffectTrack::UpdateShake(float deltaTime) {
+	if (!shake.isActive) return;
+
+	static std::random_device rd;
+	static std::mt19937 gen(rd());
+	std::uniform_real_distribution<float> dist(-shake.intensity, shake.intensity);
+
+	shake.offset.x = dist(gen);
+	shake.offset.y = dist(gen);
+
+	if (!shake.continuous) {
+		shake.elapsed += deltaTime / 60.0f;
+		if (shake.elapsed >= shake.duration) {
+			StopShake();
 		}
 	}
 }
 
-// ========== シェイク ==========
-void Effect::StartShake(float intensity, float duration) {
-	shakeEffect_.isActive = true;
-	shakeEffect_.intensity = intensity;
-	shakeEffect_.duration = duration;
-	shakeEffect_.elapsed = 0.0f;
-	shakeEffect_.continuous = false;
+void EffectTrack::UpdateRotation(float deltaTime) {
+	if (!rotation.isActive) return;
+
+	rotation.accumulatedAngle += rotation.speed * deltaTime / 60.0f;
+
+	if (!rotation.continuous) {
+		rotation.elapsed += deltaTime / 60.0f;
+		if (rotation.elapsed >= rotation.duration) {
+			StopRotation();
+		}
+	}
 }
 
-void Effect::StartShakeContinuous(float intensity) {
-	shakeEffect_.isActive = true;
-	shakeEffect_.intensity = intensity;
-	shakeEffect_.continuous = true;
-	shakeEffect_.elapsed = 0.0f;
+void EffectTrack::UpdateWobble(float deltaTime) {
+	if (!wobble.isActive) return;
+	wobble.elapsed += deltaTime / 60.0f;
 }
 
-void Effect::StopShake() {
-	shakeEffect_.isActive = false;
-	shakeEffect_.offset = { 0.0f, 0.0f };
+void EffectTrack::UpdateFade(float deltaTime) {
+	if (!fade.isActive) return;
+
+	// 持ち主から渡された時間だけ進める（持ち主が止まっている間はフェードも止まる）
+	fade.elapsed += deltaTime / 60.0f;
+	float t = fade.duration > 0.0f ? fade.elapsed / fade.duration : 1.0f;
+
+	if (t >= 1.0f) {
+		fade.currentColor = fade.targetColor;
+		fade.isActive = false;
+	}
+	else {
+		fade.currentColor = ColorRGBA::Lerp(fade.startColor, fade.targetColor, t);
+	}
 }
 
-void Effect::UpdateShake(float deltaTime) {
-	if (!shakeEffect_.isActive) return;
+void EffectTrack::UpdateFlash(float deltaTime) {
+	if (!flash.isActive) return;
 
-	static std::random_device rd;
-	static std::mt19937 gen(rd());
-	std::uniform_real_distribution<float> dist(-shakeEffect_.intensity, shakeEffect_.intensity);
+	flash.elapsed += deltaTime / 60.0f;
+	float t = flash.elapsed / flash.duration;
 
-	shakeEffect_.offset.x = dist(gen);
-	shakeEffect_.offset.y = dist(gen);
+	if (t >= 1.0f) {
+		flash.isActive = false;
+	}
+}
 
-	if (!shakeEffect_.continuous) {
-		shakeEffect_.elapsed += deltaTime / 60.0f;
-		if (shakeEffect_.elapsed >= shakeEffect_.duration) {
-			StopShake();
+void EffectTrack::UpdateFlashBlink(float deltaTime) {
+	if (!flashBlink.isActive) return;
+
+	flashBlink.flashTimer += deltaTime / 60.0f;
+
+	if (flashBlink.flashTimer >= flashBlink.flashDuration) {
+		flashBlink.flashTimer -= flashBlink.flashDuration;
+		flashBlink.isFlashOn = !flashBlink.isFlashOn;
+
+		if (!flashBlink.isFlashOn) {
+			flashBlink.flashCount--;
+			if (flashBlink.flashCount <= 0) {
+				StopFlashBlink();
+			}
 		}
 	}
 }
 
-// ========== 回転 ==========
-void Effect::StartRotation(float speed, float duration) {
-	rotationEffect_.isActive = true;
-	rotationEffect_.speed = speed;
-	rotationEffect_.duration = duration;
-	rotationEffect_.elapsed = 0.0f;
-	rotationEffect_.continuous = false;
+void EffectTrack::UpdateScale(float deltaTime) {
+	if (!scale.isActive) return;
+
+	scale.elapsed += deltaTime / 60.0f;
+
+	// サイン波で 0.0 ~ 1.0 の範囲で振動
+	float t = std::sin(scale.elapsed * scale.speed) * 0.5f + 0.5f;
+
+	// minScale と maxScale の間で補間
+	scale.currentScale = scale.minScale + (scale.maxScale - scale.minScale) * t;
+
+	// 非連続モードの場合、カウントを管理
+	if (!scale.continuous) {
+		// 1周期 = 2π / speed
+		float period = (2.0f * 3.14159265f) / scale.speed;
+		if (scale.elapsed >= period * (scale.currentCount + 1)) {
+			scale.currentCount++;
+			if (scale.currentCount >= scale.maxCount) {
+				StopScale();
+			}
+		}
+	}
 }
 
-void Effect::StartRotationContinuous(float speed) {
-	rotationEffect_.isActive = true;
-	rotationEffect_.speed = speed;
-	rotationEffect_.continuous = true;
-	rotationEffect_.elapsed = 0.0f;
+void EffectTrack::UpdateSquash(float deltaTime) {
+	if (!squash.isActive) return;
+
+	squash.elapsed += deltaTime / 60.0f;
+	float t = squash.elapsed / squash.duration;
+
+	if (t >= 1.0f) {
+		t = 1.0f;
+		squash.isActive = false;
+	}
+
+	squash.currentScale.x = 1.0f + (squash.targetScale.x - 1.0f) * (1.0f - t);
+	squash.currentScale.y = 1.0f + (squash.targetScale.y - 1.0f) * (1.0f - t);
 }
 
-void Effect::StartWobble(float angle, float speed) {
-	wobbleEffect_.isActive = true;
-	wobbleEffect_.angle = angle;
-	wobbleEffect_.speed = speed;
-	wobbleEffect_.elapsed = 0.0f;
+// ========== EffectTrack 停止 ==========
+void EffectTrack::StopShake() {
+	shake.isActive = false;
+	shake.offset = { 0.0f, 0.0f };
 }
 
-void Effect::StopRotation() {
-	rotationEffect_.isActive = false;
-	rotationEffect_.accumulatedAngle = 0.0f;
-	wobbleEffect_.isActive = false;
+void EffectTrack::StopRotation() {
+	rotation.isActive = false;
+	rotation.accumulatedAngle = 0.0f;
+	wobble.isActive = false;
 }
 
-void Effect::UpdateRotation(float deltaTime) {
-	if (!rotationEffect_.isActive) return;
+void EffectTrack::StopFade() {
+	fade.isActive = false;
+}
 
-	rotationEffect_.accumulatedAngle += rotationEffect_.speed * deltaTime / 60.0f;
+void EffectTrack::StopScale() {
+	scale.isActive = false;
+	squash.isActive = false;
+}
 
-	if (!rotationEffect_.continuous) {
-		rotationEffect_.elapsed += deltaTime / 60.0f;
-		if (rotationEffect_.elapsed >= rotationEffect_.duration) {
-			StopRotation();
-		}
+void EffectTrack::StopFlashBlink() {
+	flashBlink.isActive = false;
+	flashBlink.flashCount = 0;
+	flashBlink.isFlashOn = false;
+}
+
+// ========== Effect 生成・破棄 ==========
+Effect::~Effect() {
+	// 終了時に EffectSystem が先に破棄されていたら何もしない
+	if (!handle_.IsNull() && !EffectSystem::IsShutDown()) {
+		ReleaseTrack();
 	}
 }
 
-void Effect::UpdateWobble(float deltaTime) {
-	if (!wobbleEffect_.isActive) return;
-	wobbleEffect_.elapsed += deltaTime / 60.0f;
+Effect::Effect(const Effect& other) {
+	*this = other;
 }
 
-// ========== フェード ==========
-void Effect::StartFade(float targetAlpha, float duration) {
-	fadeEffect_.isActive = true;
-	fadeEffect_.duration = duration;
-	fadeEffect_.elapsed = 0.0f;
+Effect& Effect::operator=(const Effect& other) {
+	if (this == &other) return *this;
 
-	// 初期化されていない場合は白・不透明で初期化
-	if (!fadeEffect_.isActive && fadeEffect_.currentColor.a == 0.0f) {
-		fadeEffect_.currentColor = ColorRGBA::White();
+	const EffectTrack* source = other.FindTrack();
+	if (!source) {
+		ReleaseTrack();
+		return *this;
 	}
 
-	fadeEffect_.startColor = fadeEffect_.currentColor;
-	fadeEffect_.targetColor = fadeEffect_.currentColor;
-	fadeEffect_.targetColor.a = targetAlpha;
+	// 借りるときにプールが再配置されるので先に値で取っておく
+	EffectTrack copy = *source;
+
+	EffectTrack& track = AcquireTrack();
+	track = copy;
+	return *this;
 }
 
-void Effect::StartColorTransition(const ColorRGBA& targetColor, float duration) {
-	fadeEffect_.isActive = true;
-	fadeEffect_.duration = duration;
-	fadeEffect_.elapsed = 0.0f;
+Effect::Effect(Effect&& other) noexcept
+	: handle_(other.handle_) {
+	other.handle_ = {};
+}
 
-	// 初期化されていない場合は白・不透明で初期化
-	if (fadeEffect_.currentColor.a == 0.0f && fadeEffect_.currentColor.r == 0.0f) {
-		fadeEffect_.currentColor = ColorRGBA::White();
+Effect& Effect::operator=(Effect&& other) noexcept {
+	if (this != &other) {
+		ReleaseTrack();
+		handle_ = other.handle_;
+		other.handle_ = {};
 	}
+	return *this;
+}
 
-	fadeEffect_.startColor = fadeEffect_.currentColor;
-	fadeEffect_.targetColor = targetColor;
+// ========== トラック管理 ==========
+EffectTrack* Effect::FindTrack() {
+	if (handle_.IsNull()) return nullptr;
+	return EffectSystem::GetInstance().Get(handle_);
 }
 
-void Effect::StartFlash(const ColorRGBA& flashColor, float duration, float intensity) {
-	flashEffect_.isActive = true;
-	flashEffect_.flashColor = flashColor;
-	flashEffect_.duration = duration;
-	flashEffect_.elapsed = 0.0f;
-	flashEffect_.intensity = intensity;
+const EffectTrack* Effect::FindTrack() const {
+	if (handle_.IsNull()) return nullptr;
+	return EffectSystem::GetInstance().Get(handle_);
 }
 
-void Effect::StopFade() {
-	fadeEffect_.isActive = false;
+EffectTrack& Effect::AcquireTrack() {
+	EffectSystem& system = EffectSystem::GetInstance();
+	if (EffectTrack* track = system.Get(handle_)) {
+		return *track;
+	}
+
+	handle_ = system.Allocate();
+	return *system.Get(handle_);
 }
 
-void Effect::UpdateFade(float deltaTime) {
-	if (!fadeEffect_.isActive) return;
+void Effect::ReleaseTrack() {
+	if (handle_.IsNull()) return;
+	EffectSystem::GetInstance().Release(handle_);
+	handle_ = {};
+}
 
-	fadeEffect_.elapsed += deltaTime / 60.0f;
-	float t = fadeEffect_.elapsed / fadeEffect_.duration;
+void Effect::TakeOver(Effect& from) {
+	if (this == &from) return;
+	*this = std::move(from);
+}
 
-	if (t >= 1.0f) {
-		t = 1.0f;
-		fadeEffect_.currentColor = fadeEffect_.targetColor;
-		fadeEffect_.isActive = false;
+// ========== Effect 更新 ==========
+void Effect::Update(float deltaTime) {
+	// 何も再生していなければ何もしない
+	if (EffectTrack* track = FindTrack()) {
+		track->pendingDelta += deltaTime;
 	}
 	else {
-		fadeEffect_.currentColor = ColorRGBA::Lerp(fadeEffect_.startColor, fadeEffect_.targetColor, t);
+		handle_ = {};
 	}
 }
 
-void Effect::UpdateFlash(float deltaTime) {
-	if (!flashEffect_.isActive) return;
+// ========== シェイク ==========
+void Effect::StartShake(float intensity, float duration) {
+	EffectTrack& track = AcquireTrack();
+	track.shake.isActive = true;
+	track.shake.intensity = intensity;
+	track.shake.duration = duration;
+	track.shake.elapsed = 0.0f;
+	track.shake.continuous = false;
+}
 
-	flashEffect_.elapsed += deltaTime / 60.0f;
-	float t = flashEffect_.elapsed / flashEffect_.duration;
+void Effect::StartShakeContinuous(float intensity) {
+	EffectTrack& track = AcquireTrack();
+	track.shake.isActive = true;
+	track.shake.intensity = intensity;
+	track.shake.continuous = true;
+	track.shake.elapsed = 0.0f;
+}
 
-	if (t >= 1.0f) {
-		flashEffect_.isActive = false;
+void Effect::StopShake() {
+	if (EffectTrack* track = FindTrack()) {
+		track->StopShake();
 	}
 }
 
-// ========== スケール ==========
-void Effect::StartPulse(float minScale, float maxScale, float speed, bool continuous) {
-	scaleEffect_.isActive = true;
-	scaleEffect_.minScale = minScale;
-	scaleEffect_.maxScale = maxScale;
-	scaleEffect_.speed = speed;
-	scaleEffect_.continuous = continuous;
-	scaleEffect_.expanding = true;
-	scaleEffect_.elapsed = 0.0f;
+// ========== 回転 ==========
+void Effect::StartRotation(float speed, float duration) {
+	EffectTrack& track = AcquireTrack();
+	track.rotation.isActive = true;
+	track.rotation.speed = speed;
+	track.rotation.duration = duration;
+	track.rotation.elapsed = 0.0f;
+	track.rotation.continuous = false;
 }
 
-void Effect::StartSquash(const Vector2& targetScale, float duration) {
-	squashEffect_.isActive = true;
-	squashEffect_.targetScale = targetScale;
-	squashEffect_.duration = duration;
-	squashEffect_.elapsed = 0.0f;
-	squashEffect_.currentScale = { 1.0f, 1.0f };
+void Effect::StartRotationContinuous(float speed) {
+	EffectTrack& track = AcquireTrack();
+	track.rotation.isActive = true;
+	track.rotation.speed = speed;
+	track.rotation.continuous = true;
+	track.rotation.elapsed = 0.0f;
 }
 
-void Effect::StopScale() {
-	scaleEffect_.isActive = false;
-	squashEffect_.isActive = false;
+void Effect::StartWobble(float angle, float speed) {
+	EffectTrack& track = AcquireTrack();
+	track.wobble.isActive = true;
+	track.wobble.angle = angle;
+	track.wobble.speed = speed;
+	track.wobble.elapsed = 0.0f;
+}
+
+void Effect::StopRotation() {
+	if (EffectTrack* track = FindTrack()) {
+		track->StopRotation();
+	}
 }
 
-void Effect::UpdateScale(float deltaTime) {
-	if (!scaleEffect_.isActive) return;
+// ========== フェード ==========
+void Effect::StartFade(float targetAlpha, float duration) {
+	EffectTrack& track = AcquireTrack();
+	FadeEffect& fade = track.fade;
+	fade.isActive = true;
+	fade.duration = duration;
+	fade.elapsed = 0.0f;
 
-	scaleEffect_.elapsed += deltaTime / 60.0f;
+	// 初期化されていない場合は白・不透明で初期化
+	if (!fade.isActive && fade.currentColor.a == 0.0f) {
+		fade.currentColor = ColorRGBA::White();
+	}
 
-	// サイン波で 0.0 ~ 1.0 の範囲で振動
-	float t = std::sin(scaleEffect_.elapsed * scaleEffect_.speed) * 0.5f + 0.5f;
+	fade.startColor = fade.currentColor;
+	fade.targetColor = fade.currentColor;
+	fade.targetColor.a = targetAlpha;
+}
 
-	// minScale と maxScale の間で補間
-	scaleEffect_.currentScale = scaleEffect_.minScale + (scaleEffect_.maxScale - scaleEffect_.minScale) * t;
+void Effect::StartColorTransition(const ColorRGBA& targetColor, float duration) {
+	EffectTrack& track = AcquireTrack();
+	FadeEffect& fade = track.fade;
+	fade.isActive = true;
+	fade.duration = duration;
+	fade.elapsed = 0.0f;
 
-	// 非連続モードの場合、カウントを管理
-	if (!scaleEffect_.continuous) {
-		// 1周期 = 2π / speed
-		float period = (2.0f * 3.14159265f) / scaleEffect_.speed;
-		if (scaleEffect_.elapsed >= period * (scaleEffect_.currentCount + 1)) {
-			scaleEffect_.currentCount++;
-			if (scaleEffect_.currentCount >= scaleEffect_.maxCount) {
-				StopScale();
-			}
-		}
+	// 初期化されていない場合は白・不透明で初期化
+	if (fade.currentColor.a == 0.0f && fade.currentColor.r == 0.0f) {
+		fade.currentColor = ColorRGBA::White();
 	}
+
+	fade.startColor = fade.currentColor;
+	fade.targetColor = targetColor;
 }
-void Effect::UpdateSquash(float deltaTime) {
-	if (!squashEffect_.isActive) return;
 
-	squashEffect_.elapsed += deltaTime / 60.0f;
-	float t = squashEffect_.elapsed / squashEffect_.duration;
+void Effect::StartFlash(const ColorRGBA& flashColor, float duration, float intensity) {
+	EffectTrack& track = AcquireTrack();
+	track.flash.isActive = true;
+	track.flash.flashColor = flashColor;
+	track.flash.duration = duration;
+	track.flash.elapsed = 0.0f;
+	track.flash.intensity = intensity;
+}
 
-	if (t >= 1.0f) {
-		t = 1.0f;
-		squashEffect_.isActive = false;
+void Effect::StopFade() {
+	if (EffectTrack* track = FindTrack()) {
+		track->StopFade();
 	}
+}
+
+// ========== スケール ==========
+void Effect::StartPulse(float minScale, float maxScale, float speed, bool continuous) {
+	EffectTrack& track = AcquireTrack();
+	track.scale.isActive = true;
+	track.scale.minScale = minScale;
+	track.scale.maxScale = maxScale;
+	track.scale.speed = speed;
+	track.scale.continuous = continuous;
+	track.scale.expanding = true;
+	track.scale.elapsed = 0.0f;
+}
 
-	squashEffect_.currentScale.x = 1.0f + (squashEffect_.targetScale.x - 1.0f) * (1.0f - t);
-	squashEffect_.currentScale.y = 1.0f + (squashEffect_.targetScale.y - 1.0f) * (1.0f - t);
+void Effect::StartSquash(const Vector2& targetScale, float duration) {
+	EffectTrack& track = AcquireTrack();
+	track.squash.isActive = true;
+	track.squash.targetScale = targetScale;
+	track.squash.duration = duration;
+	track.squash.elapsed = 0.0f;
+	track.squash.currentScale = { 1.0f, 1.0f };
+}
+
+void Effect::StopScale() {
+	if (EffectTrack* track = FindTrack()) {
+		track->StopScale();
+	}
 }
 
 // ========== 複合エフェクト ==========
@@ -315,20 +456,24 @@ void Effect::StartSpawnEffect() {
 
 // ========== 結果取得 ==========
 Vector2 Effect::GetPositionOffset() const {
-	return shakeEffect_.offset;
+	const EffectTrack* track = FindTrack();
+	return track ? track->shake.offset : Vector2{ 0.0f, 0.0f };
 }
 
 Vector2 Effect::GetScaleMultiplier() const {
 	Vector2 scale = { 1.0f, 1.0f };
 
-	if (scaleEffect_.isActive) {
-		scale.x *= scaleEffect_.currentScale;
-		scale.y *= scaleEffect_.currentScale;
+	const EffectTrack* track = FindTrack();
+	if (!track) return scale;
+
+	if (track->scale.isActive) {
+		scale.x *= track->scale.currentScale;
+		scale.y *= track->scale.currentScale;
 	}
 
-	if (squashEffect_.isActive) {
-		scale.x *= squashEffect_.currentScale.x;
-		scale.y *= squashEffect_.currentScale.y;
+	if (track->squash.isActive) {
+		scale.x *= track->squash.currentScale.x;
+		scale.y *= track->squash.currentScale.y;
 	}
 
 	return scale;
@@ -337,12 +482,15 @@ Vector2 Effect::GetScaleMultiplier() const {
 float Effect::GetRotationOffset() const {
 	float rotation = 0.0f;
 
-	if (rotationEffect_.isActive) {
-		rotation += rotationEffect_.accumulatedAngle;
+	const EffectTrack* track = FindTrack();
+	if (!track) return rotation;
+
+	if (track->rotation.isActive) {
+		rotation += track->rotation.accumulatedAngle;
 	}
 
-	if (wobbleEffect_.isActive) {
-		rotation += std::sin(wobbleEffect_.elapsed * wobbleEffect_.speed) * wobbleEffect_.angle;
+	if (track->wobble.isActive) {
+		rotation += std::sin(track->wobble.elapsed * track->wobble.speed) * track->wobble.angle;
 	}
 
 	return rotation;
@@ -351,64 +499,146 @@ float Effect::GetRotationOffset() const {
 ColorRGBA Effect::GetColorModifier(const ColorRGBA& baseColor) const {
 	ColorRGBA result = baseColor;
 
+	const EffectTrack* track = FindTrack();
+	if (!track) return result;
+
 	// フェード適用
-	if (fadeEffect_.isActive) {
-		result = ColorRGBA::Multiply(result, fadeEffect_.currentColor);
+	if (track->fade.isActive) {
+		result = ColorRGBA::Multiply(result, track->fade.currentColor);
 	}
 
 	// フラッシュ適用
-	if (flashEffect_.isActive) {
-		float t = 1.0f - (flashEffect_.elapsed / flashEffect_.duration);
-		ColorRGBA flash = ColorRGBA::Lerp(baseColor, flashEffect_.flashColor, t * flashEffect_.intensity);
-		result = flash;
+	if (track->flash.isActive) {
+		const FlashEffect& flash = track->flash;
+		float t = 1.0f - (flash.elapsed / flash.duration);
+		result = ColorRGBA::Lerp(baseColor, flash.flashColor, t * flash.intensity);
 	}
 
 	return result;
 }
 
 unsigned int Effect::GetFinalColor(unsigned int baseColor) const {
+	// 何も再生していなければ色変換は不要
+	if (!FindTrack()) return baseColor;
+
 	ColorRGBA base = ColorRGBA::FromUInt(baseColor);
 	ColorRGBA modified = GetColorModifier(base);
 	return modified.ToUInt();
 }
 
+// ========== 状態確認 ==========
 bool Effect::IsAnyActive() const {
-	return shakeEffect_.isActive || rotationEffect_.isActive ||
-		fadeEffect_.isActive || flashEffect_.isActive ||
-		scaleEffect_.isActive || wobbleEffect_.isActive ||
-		squashEffect_.isActive || IsFlashBlinking();
+	const EffectTrack* track = FindTrack();
+	if (!track) return false;
+
+	return track->shake.isActive || track->rotation.isActive ||
+		track->fade.isActive || track->flash.isActive ||
+		track->scale.isActive || track->wobble.isActive ||
+		track->squash.isActive || track->flashBlink.isActive;
 }
 
-void Effect::StopAll() {
-	StopShake();
-	StopRotation();
-	StopFade();
-	StopScale();
-	StopFlashBlink();
+bool Effect::IsShakeActive() const {
+	const EffectTrack* track = FindTrack();
+	return track && track->shake.isActive;
+}
+
+bool Effect::IsRotationActive() const {
+	const EffectTrack* track = FindTrack();
+	return track && track->rotation.isActive;
+}
+
+bool Effect::IsFadeActive() const {
+	const EffectTrack* track = FindTrack();
+	return track && track->fade.isActive;
+}
 
-	// フェード色をリセット
-	fadeEffect_.currentColor = ColorRGBA::White();
-	fadeEffect_.startColor = ColorRGBA::White();
-	fadeEffect_.targetColor = ColorRGBA::White();
+bool Effect::IsScaleActive() const {
+	const EffectTrack* track = FindTrack();
+	return track && track->scale.isActive;
 }
 
+// ========== リセット ==========
+void Effect::StopAll() {
+	// 全部止めるとトラックは不要になるので、その場で返却する（フェード色も白に戻る）
+	ReleaseTrack();
+}
 
+// ========== フラッシュ点滅 ==========
 void Effect::StartFlashBlink(unsigned int color, int count, float duration, BlendMode blend, unsigned int layer) {
-	flashBlink_.isActive = true;
-	flashBlink_.flashColor = color;
-	flashBlink_.flashCount = count;
-	flashBlink_.totalFlashCount = count;
-	flashBlink_.flashDuration = duration;
-	flashBlink_.flashTimer = 0.0f;
-	flashBlink_.isFlashOn = true;
-	flashBlink_.layer = layer;
-	flashBlink_.blend = blend;
+	FlashBlinkState& flashBlink = AcquireTrack().flashBlink;
+	flashBlink.isActive = true;
+	flashBlink.flashColor = color;
+	flashBlink.flashCount = count;
+	flashBlink.totalFlashCount = count;
+	flashBlink.flashDuration = duration;
+	flashBlink.flashTimer = 0.0f;
+	flashBlink.isFlashOn = true;
+	flashBlink.layer = layer;
+	flashBlink.blend = blend;
 }
 
 void Effect::StopFlashBlink() {
-	flashBlink_.isActive = false;
-	flashBlink_.flashCount = 0;
-	flashBlink_.isFlashOn = false;
+	if (EffectTrack* track = FindTrack()) {
+		track->StopFlashBlink();
+	}
 }
 
+void Effect::SetFlashBlinkState(unsigned int color, int remainingCount, float duration,
+	unsigned int layer, float timer, BlendMode blendMode, bool isOn) {
+	// 止める指定ならトラックを借りない
+	if (remainingCount <= 0) {
+		StopFlashBlink();
+		return;
+	}
+
+	FlashBlinkState& flashBlink = AcquireTrack().flashBlink;
+	flashBlink.isActive = true;
+	flashBlink.flashColor = color;
+	flashBlink.flashCount = remainingCount;
+	flashBlink.totalFlashCount = remainingCount;
+	flashBlink.flashDuration = duration;
+	flashBlink.layer = layer;
+	flashBlink.flashTimer = timer;
+	flashBlink.blend = blendMode;
+	flashBlink.isFlashOn = isOn;
+}
 
+bool Effect::IsFlashBlinking() const {
+	const EffectTrack* track = FindTrack();
+	return track && track->flashBlink.isActive;
+}
+
+int Effect::GetFlashRemainingCount() const {
+	const EffectTrack* track = FindTrack();
+	return track ? track->flashBlink.flashCount : 0;
+}
+
+float Effect::GetFlashTimer() const {
+	const EffectTrack* track = FindTrack();
+	return track ? track->flashBlink.flashTimer : 0.0f;
+}
+
+bool Effect::IsFlashOn() const {
+	const EffectTrack* track = FindTrack();
+	return track && track->flashBlink.isActive && track->flashBlink.isFlashOn;
+}
+
+unsigned int Effect::GetFlashColor() const {
+	const EffectTrack* track = FindTrack();
+	return track ? track->flashBlink.flashColor : 0xFFFFFFFF;
+}
+
+BlendMode Effect::GetFlashBlendMode() const {
+	const EffectTrack* track = FindTrack();
+	return track ? track->flashBlink.blend : BlendMode::kBlendModeAdd;
+}
+
+unsigned int Effect::GetFlashLayer() const {
+	const EffectTrack* track = FindTrack();
+	return track ? track->flashBlink.layer : 1;
+}
+
+float Effect::GetFlashDuration() const {
+	const EffectTrack* track = FindTrack();
+	return track ? track->flashBlink.flashDuration : 0.0f;
+}
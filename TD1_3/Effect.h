@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "Vector2.h"
+#include <cstdint>
 #include <functional>
 #include <Novice.h>
 
@@ -111,13 +112,82 @@ struct SquashEffect {
 	Vector2 currentScale = { 1.0f, 1.0f };
 };
 
+// ========== エフェクトトラック ==========
+/// <summary>
+/// 1つの描画物にかかっているエフェクトの状態一式
+/// 演出を開始したときだけ EffectSystem のプールから借り、すべて終われば返却される
+/// </summary>
+struct EffectTrack {
+	ShakeEffect shake;
+	RotationEffect rotation;
+	FadeEffect fade;
+	FlashEffect flash;
+	FlashBlinkState flashBlink;
+	ScaleEffect scale;
+	WobbleEffect wobble;
+	SquashEffect squash;
+
+	// 持ち主の Update で渡された時間（EffectSystem::Update でまとめて消化する）
+	float pendingDelta = 0.0f;
+
+	// 時間を進める
+	void Advance(float deltaTime);
+
+	// 何も再生しておらず、返却しても見た目が変わらないか
+	bool IsIdle() const;
+
+	// 返却前の後始末
+	void Reset();
+
+	void StopShake();
+	void StopRotation();
+	void StopFade();
+	void StopScale();
+	void StopFlashBlink();
+
+private:
+	void UpdateShake(float deltaTime);
+	void UpdateRotation(float deltaTime);
+	void UpdateFade(float deltaTime);
+	void UpdateFlash(float deltaTime);
+	void UpdateFlashBlink(float deltaTime);
+	void UpdateScale(float deltaTime);
+	void UpdateWobble(float deltaTime);
+	void UpdateSquash(float deltaTime);
+};
+
+// ==========================================
+// エフェクトハンドル（スロット番号 + 世代）
+// 返却されたトラックのスロットは再利用されるので、世代が一致するときだけ有効
+// ==========================================
+struct EffectHandle {
+	static constexpr uint32_t kInvalidSlot = 0xFFFFFFFF;
+
+	uint32_t slot = kInvalidSlot;
+	uint32_t generation = 0;
+
+	bool IsNull() const { return slot == kInvalidSlot; }
+};
+
 // ========== Effect クラス ==========
+/// <summary>
+/// エフェクトの操作窓口
+/// 本体はハンドルだけを持ち、状態は EffectSystem のトラックに置く。
+/// 何も再生していない間はトラックを持たないので、待機中の描画物はメモリも更新コストもかからない
+/// </summary>
 class Effect {
 public:
-	Effect();
-	~Effect() = default;
+	Effect() = default;
+	~Effect();
+
+	// コピーはトラックの中身を複製、ムーブはハンドルの付け替え
+	Effect(const Effect& other);
+	Effect& operator=(const Effect& other);
+	Effect(Effect&& other) noexcept;
+	Effect& operator=(Effect&& other) noexcept;
 
 	// ========== 更新 ==========
+	// 経過時間を渡す（実際の更新は EffectSystem::Update でまとめて行う）
 	void Update(float deltaTime);
 
 	// ========== 位置系エフェクト ==========
@@ -148,27 +218,17 @@ public:
 	void StartFlashBlink(unsigned int color, int count, float duration, BlendMode blend = BlendMode::kBlendModeAdd,unsigned int layer = 1);
 	void StopFlashBlink();
 
-	bool IsFlashBlinking() const {return flashBlink_.isActive;}
-	int GetFlashRemainingCount() const { return flashBlink_.flashCount; }
-	float GetFlashTimer() const { return flashBlink_.flashTimer; }
-	bool IsFlashOn() const { return flashBlink_.isActive && flashBlink_.isFlashOn; }
-	unsigned int GetFlashColor() const { return flashBlink_.flashColor; }
-	BlendMode GetFlashBlendMode() const { return flashBlink_.blend; }
-	unsigned int GetFlashLayer() const { return flashBlink_.layer; }
-	float GetFlashDuration() const { return flashBlink_.flashDuration; }
+	bool IsFlashBlinking() const;
+	int GetFlashRemainingCount() const;
+	float GetFlashTimer() const;
+	bool IsFlashOn() const;
+	unsigned int GetFlashColor() const;
+	BlendMode GetFlashBlendMode() const;
+	unsigned int GetFlashLayer() const;
+	float GetFlashDuration() const;
 
 	void SetFlashBlinkState(unsigned int color, int remainingCount, float duration,
-		unsigned int layer, float timer, BlendMode blendMode, bool isOn) {
-		flashBlink_.isActive = (remainingCount > 0);
-		flashBlink_.flashColor = color;
-		flashBlink_.flashCount = remainingCount;
-		flashBlink_.totalFlashCount = remainingCount;
-		flashBlink_.flashDuration = duration;
-		flashBlink_.layer = layer;
-		flashBlink_.flashTimer = timer;
-		flashBlink_.blend = blendMode;
-		flashBlink_.isFlashOn = isOn;
-	}
+		unsigned int layer, float timer, BlendMode blendMode, bool isOn);
 
 	// ========== 複合エフェクト（プリセット） ==========
 	void StartHitEffect();      // ダメージ演出（白フラッシュ + シェイク）
@@ -184,30 +244,27 @@ public:
 
 	// ========== 状態確認 ==========
 	bool IsAnyActive() const;
-	bool IsShakeActive() const { return shakeEffect_.isActive; }
-	bool IsRotationActive() const { return rotationEffect_.isActive; }
-	bool IsFadeActive() const { return fadeEffect_.isActive; }
-	bool IsScaleActive() const { return scaleEffect_.isActive; }
+	bool IsShakeActive() const;
+	bool IsRotationActive() const;
+	bool IsFadeActive() const;
+	bool IsScaleActive() const;
+
+	// ========== 引き継ぎ ==========
+	// from で再生中のエフェクトを途中状態のまま引き継ぐ（from は何も再生していない状態になる）
+	void TakeOver(Effect& from);
 
 	// ========== リセット ==========
 	void StopAll();
 
 private:
-	ShakeEffect shakeEffect_;
-	RotationEffect rotationEffect_;
-	FadeEffect fadeEffect_;
-	FlashEffect flashEffect_;
-	FlashBlinkState flashBlink_;
-	ScaleEffect scaleEffect_;
-	WobbleEffect wobbleEffect_;
-	SquashEffect squashEffect_;
-
-	// 内部更新処理
-	void UpdateShake(float deltaTime);
-	void UpdateRotation(float deltaTime);
-	void UpdateFade(float deltaTime);
-	void UpdateFlash(float deltaTime);
-	void UpdateScale(float deltaTime);
-	void UpdateWobble(float deltaTime);
-	void UpdateSquash(float deltaTime);
-};
\ No newline at end of file
+	EffectHandle handle_;
+
+	// トラックの取得（なければ nullptr）
+	// ポインタはプールの再配置で無効になるので、関数をまたいで持たないこと
+	EffectTrack* FindTrack();
+	const EffectTrack* FindTrack() const;
+
+	// トラックの取得（なければプールから借りる）
+	EffectTrack& AcquireTrack();
+	void ReleaseTrack();
+};
@@ -0,0 +1,98 @@
+﻿#include "EffectSystem.h"
+#include "DebugStats.h"
+
+namespace {
+	constexpr uint32_t kNoDense = 0xFFFFFFFF;
+	constexpr size_t kInitialCapacity = 128;
+}
+
+EffectSystem::EffectSystem() {
+	tracks_.reserve(kInitialCapacity);
+	denseToSlot_.reserve(kInitialCapacity);
+}
+
+// ========== トラックの貸し出し ==========
+EffectHandle EffectSystem::Allocate() {
+	// スロット確保（空きがあれば再利用）
+	uint32_t slot;
+	if (!freeSlots_.empty()) {
+		slot = freeSlots_.back();
+		freeSlots_.pop_back();
+	}
+	else {
+		slot = static_cast<uint32_t>(slotToDense_.size());
+		slotToDense_.push_back(kNoDense);
+		slotGenerations_.push_back(0);
+	}
+
+	slotToDense_[slot] = static_cast<uint32_t>(tracks_.size());
+	tracks_.emplace_back();
+	denseToSlot_.push_back(slot);
+
+	return { slot, slotGenerations_[slot] };
+}
+
+void EffectSystem::Release(EffectHandle handle) {
+	int index = GetIndex(handle);
+	if (index >= 0) {
+		RemoveAt(static_cast<size_t>(index));
+	}
+}
+
+EffectTrack* EffectSystem::Get(EffectHandle handle) {
+	int index = GetIndex(handle);
+	return index >= 0 ? &tracks_[index] : nullptr;
+}
+
+const EffectTrack* EffectSystem::Get(EffectHandle handle) const {
+	int index = GetIndex(handle);
+	return index >= 0 ? &tracks_[index] : nullptr;
+}
+
+int EffectSystem::GetIndex(EffectHandle handle) const {
+	if (handle.IsNull() || handle.slot >= slotToDense_.size()) return -1;
+	if (slotGenerations_[handle.slot] != handle.generation) return -1;
+	uint32_t dense = slotToDense_[handle.slot];
+	return dense == kNoDense ? -1 : static_cast<int>(dense);
+}
+
+// ========== 一括更新 ==========
+void EffectSystem::Update() {
+	// 後ろから回すと、返却で入れ替わった要素を飛ばさない
+	for (size_t i = tracks_.size(); i-- > 0;) {
+		EffectTrack& track = tracks_[i];
+
+		// このフレームに更新された持ち主のトラックだけ進める
+		if (track.pendingDelta > 0.0f) {
+			track.Advance(track.pendingDelta);
+			track.pendingDelta = 0.0f;
+		}
+
+		if (track.IsIdle()) {
+			RemoveAt(i);
+		}
+	}
+
+	DebugStats::GetInstance().SetCounter(DebugCounter::EffectTracks, GetActiveCount());
+}
+
+void EffectSystem::RemoveAt(size_t index) {
+	tracks_[index].Reset();
+
+	// ハンドルを無効化してスロットを返す
+	uint32_t slot = denseToSlot_[index];
+	slotToDense_[slot] = kNoDense;
+	slotGenerations_[slot]++;
+	freeSlots_.push_back(slot);
+
+	// 末尾の要素を空いた位置に移す
+	size_t last = tracks_.size() - 1;
+	if (index != last) {
+		tracks_[index] = tracks_[last];
+		denseToSlot_[index] = denseToSlot_[last];
+		slotToDense_[denseToSlot_[index]] = static_cast<uint32_t>(index);
+	}
+
+	tracks_.pop_back();
+	denseToSlot_.pop_back();
+}
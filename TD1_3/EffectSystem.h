@@ -0,0 +1,62 @@
+﻿#pragma once
+#include <cstdint>
+#include <vector>
+#include "Effect.h"
+
+/// <summary>
+/// 再生中のエフェクトトラックをまとめて持つシステム
+/// トラックは連続配列に詰めて持ち（返却時は末尾と入れ替え）、
+/// SceneManager から毎フレーム1回 Update で再生中のものだけを一括更新する。
+/// 各 Effect は持ち主の Update で経過時間を積んでおくだけなので、
+/// 止まっている（更新されない）持ち主のエフェクトは進まない
+/// </summary>
+class EffectSystem {
+public:
+	// シングルトンインスタンス取得
+	static EffectSystem& GetInstance() {
+		static EffectSystem instance;
+		return instance;
+	}
+
+	// コピー/ムーブ禁止
+	EffectSystem(const EffectSystem&) = delete;
+	EffectSystem& operator=(const EffectSystem&) = delete;
+
+	// ========== トラックの貸し出し ==========
+	EffectHandle Allocate();
+	void Release(EffectHandle handle);
+
+	// 無効なハンドルなら nullptr
+	EffectTrack* Get(EffectHandle handle);
+	const EffectTrack* Get(EffectHandle handle) const;
+
+	// ========== 一括更新 ==========
+	// 積まれた時間でトラックを進め、何も再生していないトラックを返却する
+	void Update();
+
+	int GetActiveCount() const { return static_cast<int>(tracks_.size()); }
+
+	// 終了処理でシステムが先に破棄された後か（静的な Effect の破棄用）
+	static bool IsShutDown() { return isShutDown_; }
+
+private:
+	EffectSystem();
+	~EffectSystem() { isShutDown_ = true; }
+
+	// 現在の添字（無効なハンドルなら -1）
+	int GetIndex(EffectHandle handle) const;
+
+	// 添字のトラックを末尾と入れ替えて削除する
+	void RemoveAt(size_t index);
+
+	// ========== トラック本体（連続配列） ==========
+	std::vector<EffectTrack> tracks_;
+	std::vector<uint32_t> denseToSlot_;
+
+	// ========== スロット表（ハンドル → 添字） ==========
+	std::vector<uint32_t> slotToDense_;
+	std::vector<uint32_t> slotGenerations_;
+	std::vector<uint32_t> freeSlots_;
+
+	static inline bool isShutDown_ = false;
+};
@@ -1,11 +1,8 @@
 ﻿#pragma once
 #include "PhysicsObject.hpp"
 #include "ParticleManager.h"
-
-enum class EnemyState {
-	Patrolling,
-	Stunned
-};
+#include "EnemyBehaviorSystem.h"
+#include <cassert>
 
 class Enemy : public PhysicsObject {
 private:
@@ -18,27 +15,26 @@ private:
 	bool isDamaged_ = false;
 	bool isHitBoomerang_ = false;
 
-	float patrolRange_ = 200.0f; // パトロール範囲
-	Vector2 initialPosition_;    // 初期位置
-	int direction_ = 1;         // 移動方向（1: 右, -1: 左）
-	float moveSpeed_ = 2.0f;
-	EnemyState state_ = EnemyState::Patrolling;
-	int stunDuration_ = 60; // スタン状態の持続時間（フレーム数）
-	int stunTimer_ = 0;    // スタン状態のタイマー
+	// 挙動は EnemyBehaviorSystem が一括で更新する
+	int brainId_ = -1;
 
 	DrawComponent2D* StunnedComp_ = nullptr;
 	DrawComponent2D* PatrolComp_ = nullptr;
 
-	GameObject2D* playerRef_ = nullptr;
-	Vector2 playerPos_ = { 0.0f, 0.0f };
-	float distanceToPlayer_ = 0.f;
-	float detectionRange_ = 300.0f;
+	EnemyBrain& Brain() {
+		assert(brainId_ != -1 && "Initialize 前にブレインを参照しました");
+		return EnemyBehaviorSystem::GetInstance().GetBrain(brainId_);
+	}
 public:
+	// 挙動システム上のID（未登録なら -1）
+	int GetBrainId() const { return brainId_; }
+
 	Enemy() {
 		drawComp_ = nullptr;
 		//Initialize();
 	}
 	~Enemy() {
+		EnemyBehaviorSystem::GetInstance().Unregister(brainId_);
 		if (drawComp_ != StunnedComp_) delete StunnedComp_;
 		if (drawComp_ != PatrolComp_) delete PatrolComp_;
 
@@ -68,19 +64,26 @@ public:
 		collider_.size = { 80.f, 80.f };
 		collider_.offset = { 0.f, -20.f };
 		// 描画コンポーネントの初期化があれば呼ぶ
+		delete PatrolComp_;
+		delete StunnedComp_;
 		PatrolComp_ = new DrawComponent2D(Tex().GetTexture(TextureId::KinokoWalk), 10, 1, 10, 5.f, true);
 		StunnedComp_ = new DrawComponent2D(Tex().GetTexture(TextureId::KinokoStun), 4, 1, 4, 5.f, false);
-		delete drawComp_;
 		drawComp_ = PatrolComp_;
 		drawComp_->Initialize();
-		initialPosition_ = transform_.translate;
+
+		// 明示的に Initialize し直された場合も、ブレインは二重登録せず状態だけ戻す
+		auto& behavior = EnemyBehaviorSystem::GetInstance();
+		if (brainId_ == -1) {
+			brainId_ = behavior.Register(EnemyKind::Kinoko, &transform_.translate, collider_.size, collider_.offset);
+		}
+		behavior.ResetBrain(brainId_);
+
 		status_.maxHP = 8;
 		status_.currentHP = status_.maxHP;
 	}
 
 	void Update(float deltaTime) override {
-		FindPlayer();
-		Behavior(deltaTime);
+		ApplyBehavior();
 		damageHandling(deltaTime);
 		Move(deltaTime);
 		UpdateDrawComponent(deltaTime);
@@ -95,107 +98,33 @@ public:
 		}
 	}
 
-	void Behavior(float deltaTime) {
-		drawComp_->SetFlipX(direction_ == 1);
+	/// <summary>
+	/// EnemyBehaviorSystem の結果を反映する
+	/// </summary>
+	void ApplyBehavior() {
+		const EnemyBrain& brain = Brain();
 
-		if (state_ == EnemyState::Stunned) {
-			stunTimer_--;
-			if (stunTimer_ <= 0) {
-				state_ = EnemyState::Patrolling;
-			}
-		}
-		else if (state_ == EnemyState::Patrolling) {
-			Patrol(deltaTime);
-		}
+		transform_.translate.x += brain.moveX;
 
+		if (brain.events & kEnemyEventFoundPlayer) {
+			SoundManager::GetInstance().PlaySe(SeId::EnemyFindPlayer2, transform_.translate);
+		}
 
+		ChangeDrawComponent(brain.anim == EnemyAnim::Stunned ? StunnedComp_ : PatrolComp_);
+		drawComp_->SetFlipX(brain.direction == 1);
 	}
 
-	void Stun() {
-		state_ = EnemyState::Stunned;
-		stunTimer_ = stunDuration_;
-		if (drawComp_ != StunnedComp_) {
-			drawComp_ = StunnedComp_;
+	void ChangeDrawComponent(DrawComponent2D* newComp) {
+		if (drawComp_ != newComp) {
+			drawComp_ = newComp;
 			drawComp_->PlayAnimation();
 			drawComp_->SetTransform(transform_);
 		}
 	}
 
-	void Patrol(float deltaTime) {
-		if (drawComp_ != PatrolComp_) {
-			drawComp_ = PatrolComp_;
-			drawComp_->PlayAnimation();
-		}
-
-		// パトロール範囲内で移動
-		transform_.translate.x += direction_ * moveSpeed_ * deltaTime;
-		//Novice::ConsolePrintf( "id: %d ,Enemy Pos X: %.2f ", info_.id,transform_.translate.x);
-		//Novice::ConsolePrintf("Initial Pos X: %.2f, overPatrol: %d\n", initialPosition_.x, transform_.translate.x > initialPosition_.x + patrolRange_ || transform_.translate.x < initialPosition_.x - patrolRange_);
-		if (transform_.translate.x > initialPosition_.x + patrolRange_) {
-			direction_ = -1; // 左に移動
-		}
-		else if (transform_.translate.x < initialPosition_.x - patrolRange_) {
-			direction_ = 1; // 右に移動
-		}
-
-		//find the bottomRight and bottomLeft haveing blocks
-		auto& mapData = MapData::GetInstance();
-		float tileSize = 64.0f; // Adjust this to your actual tile size (e.g. 64.f)
-
-		Vector2 bottomLeft = { transform_.translate.x - collider_.offset.x - collider_.size.x, transform_.translate.y - collider_.offset.y - collider_.size.y * 1.25f };
-		Vector2 bottomRight = { transform_.translate.x - collider_.offset.x + collider_.size.x, transform_.translate.y - collider_.offset.y - collider_.size.y * 1.25f };
-
-
-		int leftTileX = static_cast<int>(bottomLeft.x / tileSize);
-		int rightTileX = static_cast<int>(bottomRight.x / tileSize);
-		int bottomTileY = static_cast<int>(bottomLeft.y / tileSize);
-
-		//check if cornor tile dont have block, change direction
-		int LBtileID = mapData.GetTile(leftTileX, bottomTileY, TileLayer::Block);
-		const TileDefinition* LBDef = TileRegistry::GetTile(LBtileID);
-		if (LBDef == nullptr || !LBDef->isSolid) {
-			direction_ = 1; // Change direction to right
-		}
-
-		int RBtileID = mapData.GetTile(rightTileX, bottomTileY, TileLayer::Block);
-		const TileDefinition* RBDef = TileRegistry::GetTile(RBtileID);
-		if (RBDef == nullptr || !RBDef->isSolid) {
-			direction_ = -1; // Change direction to left
-		}
-
-
-	}
-
-	bool IsFacingPlayer() {
-		if (!playerRef_) return false;
-		return (direction_ == 1 && playerPos_.x >= transform_.translate.x) ||
-			(direction_ == -1 && playerPos_.x <= transform_.translate.x);
-	}
-
-	bool foundPlayer = false;
-
-	void FindPlayer() {
-		if (foundPlayer) return;
-
-		if (!playerRef_) {
-			if (manager_) {
-				playerRef_ = manager_->GetPlayerObject();
-			}
-		}
-
-		if (playerRef_) {
-			//Novice::ConsolePrintf("try finding\n");
-			playerPos_ = playerRef_->GetPosition();
-			distanceToPlayer_ = Vector2::Length(Vector2::Subtract(playerPos_, transform_.translate));
-			if (IsFacingPlayer()) {
-				if (distanceToPlayer_ <= detectionRange_) {
-					SoundManager::GetInstance().PlaySe(SeId::EnemyFindPlayer2);
-					//Novice::ConsolePrintf("Enemy id: %d found Player!\n", info_.id);
-					foundPlayer = true;
-				}
-
-			}
-		}
+	void Stun() {
+		EnemyBehaviorSystem::GetInstance().Stun(brainId_);
+		ChangeDrawComponent(StunnedComp_);
 	}
 
 	void Draw(const Camera2D& camera) override {
@@ -252,7 +181,7 @@ public:
 			ParticleManager::GetInstance().Emit(ParticleType::Hit, transform_.translate);
 			ParticleManager::GetInstance().Emit(ParticleType::Enemy_Dead, transform_.translate);
 			Destroy();
-			SoundManager::GetInstance().PlaySe(SeId::EnemyDamage2);
+			SoundManager::GetInstance().PlaySe(SeId::EnemyDamage2, transform_.translate);
 		}
 		else {
 			if (damage > 0) {
@@ -261,7 +190,7 @@ public:
 
 				ParticleManager::GetInstance().Emit(ParticleType::Hit, transform_.translate);
 
-				SoundManager::GetInstance().PlaySe(SeId::EnemyDamage2);
+				SoundManager::GetInstance().PlaySe(SeId::EnemyDamage2, transform_.translate);
 			}
 
 			Stun();
@@ -271,14 +200,14 @@ public:
 	virtual int OnCollision(GameObject2D* other) override {
 		if (other->GetInfo().tag == "Boomerang") {
 			if (!isHitBoomerang_) {
-				direction_ = (transform_.translate.x > other->GetTransform().translate.x) ? -1 : 1;
+				Brain().direction = (transform_.translate.x > other->GetTransform().translate.x) ? -1 : 1;
 				isHitBoomerang_ = true;
 			}
 		}
 		else if (other->GetInfo().tag == "Player")
 		{
 			Vector2 knockbackDir = Vector2::Subtract(transform_.translate, other->GetTransform().translate);
-			direction_ *= knockbackDir.x > 0 ? 1 : -1;
+			Brain().direction *= knockbackDir.x > 0 ? 1 : -1;
 		}
 		else if (other->GetInfo().tag == "Enemy") {
 			// knockback on collision with other enemies
@@ -287,7 +216,7 @@ public:
 			rigidbody_.acceleration.x += knockbackDir.x * 7.5f;
 
 			// reverse direction
-			direction_ *= -1;
+			Brain().direction *= -1;
 
 		}
 
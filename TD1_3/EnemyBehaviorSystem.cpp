@@ -0,0 +1,654 @@
+﻿#include "EnemyBehaviorSystem.h"
+#include "MapData.h"
+#include "TileRegistry.h"
+#include "JsonUtil.h"
+#include <Novice.h>
+
+#ifdef _DEBUG
+#include <imgui.h>
+#endif
+
+// デフォルトの挙動定義ファイル
+static const std::string kDefaultBehaviorPath = "Resources/Data/enemy_behaviors.json";
+
+namespace {
+	const char* kKindNames[] = { "Kinoko", "AttackKinoko", "FatKinoko" };
+	const char* kAnimNames[] = { "Patrol", "Stunned", "BattleIdle", "Run", "Windup", "Attack", "Attack2" };
+
+	EnemyAnim StringToAnim(const std::string& str) {
+		for (int i = 0; i < static_cast<int>(EnemyAnim::Count); ++i) {
+			if (str == kAnimNames[i]) {
+				return static_cast<EnemyAnim>(i);
+			}
+		}
+		return EnemyAnim::Attack;
+	}
+
+	Vector2 ReadVector2(const json& j, const std::string& key) {
+		if (!j.contains(key)) {
+			return { 0.0f, 0.0f };
+		}
+		return {
+			JsonUtil::GetValue<float>(j[key], "x", 0.0f),
+			JsonUtil::GetValue<float>(j[key], "y", 0.0f)
+		};
+	}
+
+	json WriteVector2(const Vector2& v) {
+		return json{ { "x", v.x }, { "y", v.y } };
+	}
+
+	EnemyBehaviorDef DeserializeDef(const json& j, const EnemyBehaviorDef& base) {
+		EnemyBehaviorDef def = base;
+		def.moveSpeed = JsonUtil::GetValue<float>(j, "moveSpeed", base.moveSpeed);
+		def.runSpeed = JsonUtil::GetValue<float>(j, "runSpeed", base.runSpeed);
+		def.patrolRange = JsonUtil::GetValue<float>(j, "patrolRange", base.patrolRange);
+		def.ledgeProbeDepth = JsonUtil::GetValue<float>(j, "ledgeProbeDepth", base.ledgeProbeDepth);
+		def.patrolHeal = JsonUtil::GetValue<int>(j, "patrolHeal", base.patrolHeal);
+		def.hasBattle = JsonUtil::GetValue<bool>(j, "hasBattle", base.hasBattle);
+		def.detectionRange = JsonUtil::GetValue<float>(j, "detectionRange", base.detectionRange);
+		def.attackRange = JsonUtil::GetValue<float>(j, "attackRange", base.attackRange);
+		def.keepDistance = JsonUtil::GetValue<float>(j, "keepDistance", base.keepDistance);
+		def.battleRange = JsonUtil::GetValue<float>(j, "battleRange", base.battleRange);
+		def.escapeRange = JsonUtil::GetValue<float>(j, "escapeRange", base.escapeRange);
+		def.attackCooldown = JsonUtil::GetValue<float>(j, "attackCooldown", base.attackCooldown);
+		def.windupShakeIncrement = JsonUtil::GetValue<float>(j, "windupShakeIncrement", base.windupShakeIncrement);
+		def.stunDuration = JsonUtil::GetValue<float>(j, "stunDuration", base.stunDuration);
+
+		if (j.contains("attackSequence") && j["attackSequence"].is_array()) {
+			def.attackSequence.clear();
+			for (const auto& s : j["attackSequence"]) {
+				EnemyAttackStep step;
+				step.anim = StringToAnim(JsonUtil::GetValue<std::string>(s, "anim", "Attack"));
+				step.duration = JsonUtil::GetValue<float>(s, "duration", step.duration);
+				step.telegraph = JsonUtil::GetValue<bool>(s, "telegraph", false);
+				step.stunnable = JsonUtil::GetValue<bool>(s, "stunnable", false);
+				step.shake = JsonUtil::GetValue<bool>(s, "shake", false);
+				step.spawnHitBox = JsonUtil::GetValue<bool>(s, "spawnHitBox", false);
+				step.playAttackSe = JsonUtil::GetValue<bool>(s, "playAttackSe", false);
+				step.force = ReadVector2(s, "force");
+				step.retreatIfClose = JsonUtil::GetValue<bool>(s, "retreatIfClose", false);
+				step.retreatForce = ReadVector2(s, "retreatForce");
+				def.attackSequence.push_back(step);
+			}
+		}
+		return def;
+	}
+
+	json SerializeDef(const EnemyBehaviorDef& def) {
+		json j;
+		j["moveSpeed"] = def.moveSpeed;
+		j["runSpeed"] = def.runSpeed;
+		j["patrolRange"] = def.patrolRange;
+		j["ledgeProbeDepth"] = def.ledgeProbeDepth;
+		j["patrolHeal"] = def.patrolHeal;
+		j["hasBattle"] = def.hasBattle;
+		j["detectionRange"] = def.detectionRange;
+		j["attackRange"] = def.attackRange;
+		j["keepDistance"] = def.keepDistance;
+		j["battleRange"] = def.battleRange;
+		j["escapeRange"] = def.escapeRange;
+		j["attackCooldown"] = def.attackCooldown;
+		j["windupShakeIncrement"] = def.windupShakeIncrement;
+		j["stunDuration"] = def.stunDuration;
+
+		json steps = json::array();
+		for (const EnemyAttackStep& step : def.attackSequence) {
+			json s;
+			s["anim"] = kAnimNames[static_cast<int>(step.anim)];
+			s["duration"] = step.duration;
+			s["telegraph"] = step.telegraph;
+			s["stunnable"] = step.stunnable;
+			s["shake"] = step.shake;
+			s["spawnHitBox"] = step.spawnHitBox;
+			s["playAttackSe"] = step.playAttackSe;
+			s["force"] = WriteVector2(step.force);
+			s["retreatIfClose"] = step.retreatIfClose;
+			s["retreatForce"] = WriteVector2(step.retreatForce);
+			steps.push_back(s);
+		}
+		j["attackSequence"] = steps;
+		return j;
+	}
+}
+
+EnemyBehaviorSystem::EnemyBehaviorSystem() {
+	LoadDefaults();
+}
+
+// ========== 挙動定義 ==========
+
+void EnemyBehaviorSystem::Load() {
+	if (!LoadFromJson(kDefaultBehaviorPath)) {
+		// JSONが無い場合はデフォルトを作成
+		LoadDefaults();
+		SaveToJson(kDefaultBehaviorPath);
+	}
+}
+
+void EnemyBehaviorSystem::LoadDefaults() {
+	// ----- Kinoko（Enemy）：パトロールのみ -----
+	EnemyBehaviorDef& kinoko = defs_[static_cast<int>(EnemyKind::Kinoko)];
+	kinoko = {};
+	kinoko.name = "Kinoko";
+	kinoko.moveSpeed = 2.0f;
+	kinoko.patrolRange = 200.0f;
+	kinoko.hasBattle = false;
+	kinoko.detectionRange = 300.0f;
+	kinoko.stunDuration = 60.0f;
+
+	// ----- AttackKinoko（AttackEnemy）：溜め → 攻撃 -----
+	EnemyBehaviorDef& attack = defs_[static_cast<int>(EnemyKind::AttackKinoko)];
+	attack = {};
+	attack.name = "AttackKinoko";
+	attack.moveSpeed = 2.0f;
+	attack.runSpeed = 6.5f;
+	attack.patrolRange = 200.0f;
+	attack.patrolHeal = 1;
+	attack.hasBattle = true;
+	attack.detectionRange = 500.0f;
+	attack.attackRange = 140.0f;
+	attack.keepDistance = 110.0f;
+	attack.battleRange = 200.0f;
+	attack.escapeRange = 600.0f;
+	attack.attackCooldown = 50.0f;
+	attack.windupShakeIncrement = 0.1f;
+	attack.stunDuration = 60.0f;
+	{
+		EnemyAttackStep windup;
+		windup.anim = EnemyAnim::Windup;
+		windup.duration = 60.0f;
+		windup.telegraph = true;
+		windup.stunnable = true;
+		windup.shake = true;
+		windup.spawnHitBox = true;
+		windup.playAttackSe = true;
+		windup.force = { 8.0f, 0.0f };
+
+		EnemyAttackStep windDown;
+		windDown.anim = EnemyAnim::Attack;
+		windDown.duration = 45.0f;
+
+		attack.attackSequence = { windup, windDown };
+	}
+
+	// ----- FatKinoko（FatEnemy）：溜め → 突進 → 追撃 → 離脱 -----
+	EnemyBehaviorDef& fat = defs_[static_cast<int>(EnemyKind::FatKinoko)];
+	fat = {};
+	fat.name = "FatKinoko";
+	fat.moveSpeed = 2.0f;
+	fat.runSpeed = 4.0f;
+	fat.patrolRange = 200.0f;
+	fat.patrolHeal = 1;
+	fat.hasBattle = true;
+	fat.detectionRange = 600.0f;
+	fat.attackRange = 190.0f;
+	fat.keepDistance = 150.0f;
+	fat.battleRange = 260.0f;
+	fat.escapeRange = 860.0f;
+	fat.attackCooldown = 60.0f;
+	fat.windupShakeIncrement = 0.1f;
+	fat.stunDuration = 150.0f;
+	{
+		const float chargeForce = 15.0f;
+
+		EnemyAttackStep windup;
+		windup.anim = EnemyAnim::Windup;
+		windup.duration = 60.0f;
+		windup.telegraph = true;
+		windup.stunnable = true;
+		windup.shake = true;
+		windup.spawnHitBox = true;
+		windup.playAttackSe = true;
+		windup.force = { chargeForce, 0.0f };
+
+		EnemyAttackStep charge;
+		charge.anim = EnemyAnim::Attack;
+		charge.duration = 50.0f;
+		charge.spawnHitBox = true;
+		charge.playAttackSe = true;
+		charge.force = { chargeForce, 0.0f };
+
+		EnemyAttackStep windDown;
+		windDown.anim = EnemyAnim::Attack2;
+		windDown.duration = 25.0f;
+		windDown.retreatIfClose = true;
+		windDown.retreatForce = { -chargeForce * 2.2f, chargeForce };
+
+		fat.attackSequence = { windup, charge, windDown };
+	}
+}
+
+bool EnemyBehaviorSystem::LoadFromJson(const std::string& filepath) {
+	json j;
+	if (!JsonUtil::LoadFromFile(filepath, j)) {
+		return false;
+	}
+
+	// 足りない項目はデフォルト値で埋める
+	LoadDefaults();
+	for (int i = 0; i < static_cast<int>(EnemyKind::Count); ++i) {
+		if (j.contains(kKindNames[i])) {
+			defs_[i] = DeserializeDef(j[kKindNames[i]], defs_[i]);
+		}
+	}
+	return true;
+}
+
+bool EnemyBehaviorSystem::SaveToJson(const std::string& filepath) const {
+	json j = json::object();
+	for (int i = 0; i < static_cast<int>(EnemyKind::Count); ++i) {
+		j[kKindNames[i]] = SerializeDef(defs_[i]);
+	}
+	return JsonUtil::SaveToFile(filepath, j);
+}
+
+// ========== 登録 ==========
+
+int EnemyBehaviorSystem::Register(EnemyKind kind, const Vector2* positionSource, const Vector2& colliderSize, const Vector2& colliderOffset) {
+	int id = 0;
+	if (!freeIds_.empty()) {
+		id = freeIds_.back();
+		freeIds_.pop_back();
+	}
+	else {
+		id = static_cast<int>(slots_.size());
+		slots_.emplace_back();
+	}
+
+	std::vector<EnemyBrain>& brains = brains_[static_cast<int>(kind)];
+
+	EnemyBrain brain;
+	brain.id = id;
+	brain.positionSource = positionSource;
+	brain.position = positionSource ? *positionSource : Vector2{ 0.0f, 0.0f };
+	brain.initialPosition = brain.position;
+	brain.hasAnchor = false;
+	brain.colliderSize = colliderSize;
+	brain.colliderOffset = colliderOffset;
+	brains.push_back(brain);
+
+	slots_[id] = { kind, static_cast<int>(brains.size()) - 1 };
+	return id;
+}
+
+void EnemyBehaviorSystem::Unregister(int id) {
+	if (id < 0 || id >= static_cast<int>(slots_.size()) || slots_[id].index < 0) {
+		return;
+	}
+
+	Slot& slot = slots_[id];
+	std::vector<EnemyBrain>& brains = brains_[static_cast<int>(slot.kind)];
+
+	// 末尾と入れ替えて詰める
+	const int last = static_cast<int>(brains.size()) - 1;
+	if (slot.index != last) {
+		brains[slot.index] = brains[last];
+		slots_[brains[slot.index].id].index = slot.index;
+	}
+	brains.pop_back();
+
+	slot.index = -1;
+	freeIds_.push_back(id);
+}
+
+EnemyBrain& EnemyBehaviorSystem::GetBrain(int id) {
+	const Slot& slot = slots_[id];
+	return brains_[static_cast<int>(slot.kind)][slot.index];
+}
+
+void EnemyBehaviorSystem::ResetBrain(int id) {
+	EnemyBrain& brain = GetBrain(id);
+	if (brain.positionSource) {
+		brain.position = *brain.positionSource;
+	}
+	brain.initialPosition = brain.position;
+	brain.hasAnchor = false;
+}
+
+void EnemyBehaviorSystem::SetColliderSize(int id, const Vector2& colliderSize) {
+	GetBrain(id).colliderSize = colliderSize;
+}
+
+// ========== 更新 ==========
+
+void EnemyBehaviorSystem::Update(float deltaTime, const Vector2* playerPos) {
+	hasPlayer_ = (playerPos != nullptr);
+	if (playerPos) {
+		playerPos_ = *playerPos;
+	}
+
+	for (int i = 0; i < static_cast<int>(EnemyKind::Count); ++i) {
+		UpdateKind(static_cast<EnemyKind>(i), deltaTime);
+	}
+}
+
+void EnemyBehaviorSystem::UpdateKind(EnemyKind kind, float deltaTime) {
+	std::vector<EnemyBrain>& brains = brains_[static_cast<int>(kind)];
+	if (brains.empty()) {
+		return;
+	}
+
+	const EnemyBehaviorDef& def = defs_[static_cast<int>(kind)];
+
+	// 位置の取り込みと出力のクリアを先にまとめて行う
+	for (EnemyBrain& brain : brains) {
+		if (brain.positionSource) {
+			brain.position = *brain.positionSource;
+		}
+
+		// 巡回の基準は最初の更新時の位置にする
+		// （生成後に SetPosition で配置し直す Spawner やイベントの敵も、その位置を基準に巡回する）
+		if (!brain.hasAnchor) {
+			brain.initialPosition = brain.position;
+			brain.hasAnchor = true;
+		}
+		brain.events = kEnemyEventNone;
+		brain.moveX = 0.0f;
+		brain.pendingForce = { 0.0f, 0.0f };
+		brain.heal = 0;
+	}
+
+	for (EnemyBrain& brain : brains) {
+		FindPlayer(brain, def);
+
+		if (brain.stunned) {
+			brain.anim = EnemyAnim::Stunned;
+			brain.stunTimer -= deltaTime;
+			if (brain.stunTimer <= 0.0f) {
+				brain.stunned = false;
+				brain.events |= kEnemyEventStunEnd;
+			}
+			continue;
+		}
+
+		if (brain.phase == EnemyPhase::Battle) {
+			Battle(brain, def, deltaTime);
+		}
+		else {
+			Patrol(brain, def, deltaTime);
+		}
+	}
+}
+
+void EnemyBehaviorSystem::FindPlayer(EnemyBrain& brain, const EnemyBehaviorDef& def) {
+	if (!def.hasBattle && brain.foundPlayer) {
+		return;
+	}
+
+	if (!hasPlayer_) {
+		if (def.hasBattle) {
+			ReturnToPatrol(brain);
+		}
+		return;
+	}
+
+	const Vector2 toPlayer = Vector2::Subtract(playerPos_, brain.position);
+	brain.distanceToPlayer = Vector2::Length(toPlayer);
+
+	if (brain.phase == EnemyPhase::Battle) {
+		return;
+	}
+
+	const bool isFacingPlayer =
+		(brain.direction == 1 && playerPos_.x >= brain.position.x) ||
+		(brain.direction == -1 && playerPos_.x <= brain.position.x);
+
+	if (isFacingPlayer && brain.distanceToPlayer <= def.detectionRange) {
+		brain.events |= kEnemyEventFoundPlayer;
+		if (def.hasBattle) {
+			brain.phase = EnemyPhase::Battle;
+		}
+		else {
+			brain.foundPlayer = true;
+		}
+	}
+}
+
+void EnemyBehaviorSystem::Patrol(EnemyBrain& brain, const EnemyBehaviorDef& def, float deltaTime) {
+	brain.anim = EnemyAnim::Patrol;
+	brain.heal += def.patrolHeal;
+
+	// パトロール範囲内で移動
+	brain.moveX += brain.direction * def.moveSpeed * deltaTime;
+	const float x = brain.position.x + brain.moveX;
+
+	if (x > brain.initialPosition.x + def.patrolRange) {
+		brain.direction = -1; // 左に移動
+	}
+	else if (x < brain.initialPosition.x - def.patrolRange) {
+		brain.direction = 1; // 右に移動
+	}
+
+	// 足元の左右に床が無ければ引き返す
+	const MapData& mapData = MapData::GetInstance();
+	const float tileSize = mapData.GetTileSize();
+
+	const float probeY = brain.position.y - brain.colliderOffset.y - brain.colliderSize.y * def.ledgeProbeDepth;
+	const float probeLeftX = x - brain.colliderOffset.x - brain.colliderSize.x;
+	const float probeRightX = x - brain.colliderOffset.x + brain.colliderSize.x;
+
+	const int leftTileX = static_cast<int>(probeLeftX / tileSize);
+	const int rightTileX = static_cast<int>(probeRightX / tileSize);
+	const int bottomTileY = static_cast<int>(probeY / tileSize);
+
+	const TileDefinition* leftDef = TileRegistry::GetTile(mapData.GetTile(leftTileX, bottomTileY, TileLayer::Block));
+	if (leftDef == nullptr || !leftDef->isSolid) {
+		brain.direction = 1;
+	}
+
+	const TileDefinition* rightDef = TileRegistry::GetTile(mapData.GetTile(rightTileX, bottomTileY, TileLayer::Block));
+	if (rightDef == nullptr || !rightDef->isSolid) {
+		brain.direction = -1;
+	}
+}
+
+void EnemyBehaviorSystem::Battle(EnemyBrain& brain, const EnemyBehaviorDef& def, float deltaTime) {
+	if (brain.distanceToPlayer > def.escapeRange) {
+		ReturnToPatrol(brain);
+		return;
+	}
+
+	switch (brain.battleState) {
+	case EnemyBattleState::Idle:
+		brain.anim = EnemyAnim::BattleIdle;
+		BattleIdle(brain, def, deltaTime);
+		break;
+	case EnemyBattleState::Running:
+		brain.anim = EnemyAnim::Run;
+		RunTowardsPlayer(brain, def, deltaTime);
+		break;
+	case EnemyBattleState::Sequence:
+		RunSequence(brain, def, deltaTime);
+		break;
+	}
+}
+
+void EnemyBehaviorSystem::BattleIdle(EnemyBrain& brain, const EnemyBehaviorDef& def, float deltaTime) {
+	if (brain.distanceToPlayer > def.battleRange) {
+		brain.battleState = EnemyBattleState::Running;
+		return;
+	}
+
+	brain.attackTimer += deltaTime;
+	brain.direction = (playerPos_.x >= brain.position.x) ? 1 : -1;
+
+	const Vector2 toPlayer = Vector2::Normalize(Vector2::Subtract(playerPos_, brain.position));
+
+	if (brain.distanceToPlayer > def.attackRange) {
+		// プレイヤーに近づく
+		brain.moveX += toPlayer.x * def.moveSpeed;
+		return;
+	}
+
+	if (brain.distanceToPlayer < def.keepDistance) {
+		// プレイヤーから離れる
+		brain.moveX -= toPlayer.x * def.moveSpeed;
+	}
+
+	// 攻撃範囲内
+	if (brain.attackTimer >= def.attackCooldown && !def.attackSequence.empty()) {
+		brain.attackTimer = 0.0f;
+		brain.battleState = EnemyBattleState::Sequence;
+		brain.step = 0;
+		brain.stepTimer = 0.0f;
+		brain.stepStarted = false;
+	}
+}
+
+void EnemyBehaviorSystem::RunTowardsPlayer(EnemyBrain& brain, const EnemyBehaviorDef& def, float deltaTime) {
+	const Vector2 toPlayer = Vector2::Normalize(Vector2::Subtract(playerPos_, brain.position));
+	brain.moveX += toPlayer.x * def.runSpeed * deltaTime;
+	brain.direction = (toPlayer.x >= 0.0f) ? 1 : -1;
+
+	brain.attackTimer += deltaTime;
+
+	if (brain.distanceToPlayer <= def.battleRange) {
+		brain.battleState = EnemyBattleState::Idle;
+	}
+}
+
+void EnemyBehaviorSystem::RunSequence(EnemyBrain& brain, const EnemyBehaviorDef& def, float deltaTime) {
+	if (brain.step >= static_cast<int>(def.attackSequence.size())) {
+		brain.battleState = EnemyBattleState::Idle;
+		return;
+	}
+
+	const EnemyAttackStep& step = def.attackSequence[brain.step];
+	brain.anim = step.anim;
+
+	if (!brain.stepStarted) {
+		brain.stepStarted = true;
+		if (step.telegraph) {
+			brain.events |= kEnemyEventTelegraph;
+		}
+	}
+
+	brain.stepTimer += deltaTime;
+
+	if (step.shake && brain.stepTimer >= step.duration / 2.0f) {
+		brain.shakeMagnitude += def.windupShakeIncrement * deltaTime;
+	}
+
+	if (brain.stepTimer < step.duration) {
+		return;
+	}
+
+	// ----- ステップ終了 -----
+	const float dir = static_cast<float>(brain.direction);
+	if (step.force.x != 0.0f || step.force.y != 0.0f) {
+		brain.pendingForce += Vector2{ dir * step.force.x, step.force.y };
+		brain.events |= kEnemyEventAddForce;
+	}
+	if (step.retreatIfClose && brain.distanceToPlayer <= def.keepDistance) {
+		brain.pendingForce += Vector2{ dir * step.retreatForce.x, step.retreatForce.y };
+		brain.events |= kEnemyEventAddForce;
+	}
+	if (step.spawnHitBox) {
+		brain.events |= kEnemyEventSpawnHitBox;
+	}
+	if (step.playAttackSe) {
+		brain.events |= kEnemyEventAttackSe;
+	}
+
+	brain.shakeMagnitude = 0.0f;
+	brain.stepTimer = 0.0f;
+	brain.stepStarted = false;
+	brain.step++;
+	if (brain.step >= static_cast<int>(def.attackSequence.size())) {
+		brain.step = 0;
+		brain.battleState = EnemyBattleState::Idle;
+	}
+}
+
+void EnemyBehaviorSystem::ReturnToPatrol(EnemyBrain& brain) {
+	brain.phase = EnemyPhase::Patrol;
+	brain.battleState = EnemyBattleState::Idle;
+	brain.attackTimer = 0.0f;
+	brain.step = 0;
+	brain.stepTimer = 0.0f;
+	brain.stepStarted = false;
+	brain.shakeMagnitude = 0.0f;
+}
+
+// ========== 被弾 ==========
+
+void EnemyBehaviorSystem::Stun(int id) {
+	EnemyBrain& brain = GetBrain(id);
+	const EnemyBehaviorDef& def = defs_[static_cast<int>(slots_[id].kind)];
+
+	brain.stunned = true;
+	brain.stunTimer = def.stunDuration;
+	brain.anim = EnemyAnim::Stunned;
+
+	// 攻撃はキャンセル
+	brain.attackTimer = 0.0f;
+	brain.battleState = EnemyBattleState::Idle;
+	brain.step = 0;
+	brain.stepTimer = 0.0f;
+	brain.stepStarted = false;
+	brain.shakeMagnitude = 0.0f;
+}
+
+bool EnemyBehaviorSystem::IsStunnable(int id) {
+	const EnemyBrain& brain = GetBrain(id);
+	const EnemyBehaviorDef& def = defs_[static_cast<int>(slots_[id].kind)];
+
+	if (brain.battleState != EnemyBattleState::Sequence || brain.step >= static_cast<int>(def.attackSequence.size())) {
+		return false;
+	}
+	return def.attackSequence[brain.step].stunnable;
+}
+
+// ========== デバッグ ==========
+
+void EnemyBehaviorSystem::ShowDebugWindow() {
+#ifdef _DEBUG
+	if (ImGui::Begin("Enemy Behavior")) {
+		static char filepath[256] = "Resources/Data/enemy_behaviors.json";
+		ImGui::InputText("File", filepath, sizeof(filepath));
+		if (ImGui::Button("Load")) {
+			LoadFromJson(filepath);
+		}
+		ImGui::SameLine();
+		if (ImGui::Button("Save")) {
+			SaveToJson(filepath);
+		}
+
+		for (int i = 0; i < static_cast<int>(EnemyKind::Count); ++i) {
+			EnemyBehaviorDef& def = defs_[i];
+			ImGui::PushID(i);
+
+			if (ImGui::CollapsingHeader(kKindNames[i])) {
+				ImGui::Text("Active: %d", static_cast<int>(brains_[i].size()));
+
+				ImGui::DragFloat("Move Speed", &def.moveSpeed, 0.1f, 0.0f, 20.0f);
+				ImGui::DragFloat("Patrol Range", &def.patrolRange, 1.0f, 0.0f, 2000.0f);
+				ImGui::DragFloat("Detection Range", &def.detectionRange, 1.0f, 0.0f, 2000.0f);
+				ImGui::DragFloat("Stun Duration", &def.stunDuration, 1.0f, 0.0f, 600.0f);
+
+				if (def.hasBattle) {
+					ImGui::DragFloat("Run Speed", &def.runSpeed, 0.1f, 0.0f, 20.0f);
+					ImGui::DragFloat("Attack Range", &def.attackRange, 1.0f, 0.0f, 2000.0f);
+					ImGui::DragFloat("Keep Distance", &def.keepDistance, 1.0f, 0.0f, 2000.0f);
+					ImGui::DragFloat("Battle Range", &def.battleRange, 1.0f, 0.0f, 2000.0f);
+					ImGui::DragFloat("Escape Range", &def.escapeRange, 1.0f, 0.0f, 4000.0f);
+					ImGui::DragFloat("Attack Cooldown", &def.attackCooldown, 1.0f, 0.0f, 600.0f);
+
+					for (int s = 0; s < static_cast<int>(def.attackSequence.size()); ++s) {
+						EnemyAttackStep& step = def.attackSequence[s];
+						ImGui::PushID(s);
+						ImGui::Text("Step %d: %s", s, kAnimNames[static_cast<int>(step.anim)]);
+						ImGui::DragFloat("Duration", &step.duration, 1.0f, 1.0f, 600.0f);
+						ImGui::DragFloat2("Force", &step.force.x, 0.1f);
+						ImGui::PopID();
+					}
+				}
+			}
+
+			ImGui::PopID();
+		}
+	}
+	ImGui::End();
+#endif
+}
@@ -0,0 +1,221 @@
+﻿#pragma once
+#include <array>
+#include <string>
+#include <vector>
+#include "Vector2.h"
+
+// ========== 敵の挙動定義 ==========
+
+/// <summary>
+/// 敵の種類（挙動定義の単位）
+/// </summary>
+enum class EnemyKind {
+	Kinoko,        // Enemy
+	AttackKinoko,  // AttackEnemy
+	FatKinoko,     // FatEnemy
+	Count
+};
+
+// 行動フェーズ
+enum class EnemyPhase {
+	Patrol,
+	Battle,
+};
+
+// 戦闘中の状態（Sequence は攻撃シーケンスの各ステップを実行中）
+enum class EnemyBattleState {
+	Idle,
+	Running,
+	Sequence,
+};
+
+// 描画状態（各敵クラスが DrawComponent に対応付ける）
+enum class EnemyAnim {
+	Patrol,
+	Stunned,
+	BattleIdle,
+	Run,
+	Windup,
+	Attack,
+	Attack2,
+	Count
+};
+
+// 挙動の結果として本体に通知するイベント（ビットフラグ）
+enum EnemyEventFlag : unsigned int {
+	kEnemyEventNone = 0,
+	kEnemyEventFoundPlayer = 1 << 0, // プレイヤー発見
+	kEnemyEventTelegraph = 1 << 1,   // 攻撃予告（パーティクル・点滅）
+	kEnemyEventSpawnHitBox = 1 << 2, // 攻撃判定の生成
+	kEnemyEventAttackSe = 1 << 3,    // 攻撃SE
+	kEnemyEventAddForce = 1 << 4,    // pendingForce を加える
+	kEnemyEventStunEnd = 1 << 5,     // スタン終了
+};
+
+/// <summary>
+/// 攻撃シーケンスの1ステップ（溜め → 攻撃 → 追撃 など）
+/// </summary>
+struct EnemyAttackStep {
+	EnemyAnim anim = EnemyAnim::Attack;
+	float duration = 45.0f;     // ステップの長さ（フレーム）
+	bool telegraph = false;     // 開始時に予告エフェクトを出す
+	bool stunnable = false;     // このステップ中に被弾するとスタンする
+	bool shake = false;         // 後半に溜め揺れを加える
+
+	// ----- 終了時のアクション -----
+	bool spawnHitBox = false;
+	bool playAttackSe = false;
+	Vector2 force = { 0.0f, 0.0f };        // x は向きを掛けて加える
+	bool retreatIfClose = false;           // keepDistance 以内なら離脱する
+	Vector2 retreatForce = { 0.0f, 0.0f }; // x は向きを掛けて加える
+};
+
+/// <summary>
+/// 敵1種類分の挙動定義（JSONから読み込む）
+/// </summary>
+struct EnemyBehaviorDef {
+	std::string name;
+
+	// 移動
+	float moveSpeed = 2.0f;
+	float runSpeed = 6.5f;
+	float patrolRange = 200.0f;
+	float ledgeProbeDepth = 1.25f; // 足元の崖判定の深さ（コライダー高さ比）
+	int patrolHeal = 0;            // パトロール中の毎フレーム回復量
+
+	// 検知・戦闘
+	bool hasBattle = false;        // false ならプレイヤー発見時にSEを鳴らすだけ
+	float detectionRange = 300.0f;
+	float attackRange = 140.0f;
+	float keepDistance = 110.0f;
+	float battleRange = 200.0f;
+	float escapeRange = 600.0f;
+	float attackCooldown = 50.0f;
+	float windupShakeIncrement = 0.1f;
+
+	// スタン
+	float stunDuration = 60.0f;
+
+	std::vector<EnemyAttackStep> attackSequence;
+};
+
+/// <summary>
+/// 敵1体分の挙動状態（種類ごとに連続した配列で持つ）
+/// </summary>
+struct EnemyBrain {
+	int id = -1;
+
+	// 入力（Update の先頭でまとめて取り込む）
+	const Vector2* positionSource = nullptr;
+	Vector2 position = { 0.0f, 0.0f };
+	Vector2 initialPosition = { 0.0f, 0.0f };
+	bool hasAnchor = false; // 最初の Update で initialPosition を取り直したか
+	Vector2 colliderSize = { 0.0f, 0.0f };
+	Vector2 colliderOffset = { 0.0f, 0.0f };
+
+	// 状態
+	int direction = 1; // 1: 右, -1: 左
+	EnemyPhase phase = EnemyPhase::Patrol;
+	EnemyBattleState battleState = EnemyBattleState::Idle;
+	int step = 0;
+	bool stepStarted = false;
+	float stepTimer = 0.0f;
+	float attackTimer = 0.0f;
+	float stunTimer = 0.0f;
+	bool stunned = false;
+	bool foundPlayer = false;
+	float distanceToPlayer = 0.0f;
+
+	// 出力（本体が Update で反映する）
+	EnemyAnim anim = EnemyAnim::Patrol;
+	unsigned int events = kEnemyEventNone;
+	float moveX = 0.0f;
+	Vector2 pendingForce = { 0.0f, 0.0f };
+	int heal = 0;
+	float shakeMagnitude = 0.0f;
+};
+
+/// <summary>
+/// 敵AIの一括更新システム
+/// 種類ごとの EnemyBrain 配列を1パスで更新し、プレイヤー位置はフレームに1回だけ受け取る
+/// 敵オブジェクトは結果（移動量・イベント・描画状態）を反映するだけ
+/// </summary>
+class EnemyBehaviorSystem {
+public:
+	static EnemyBehaviorSystem& GetInstance() {
+		static EnemyBehaviorSystem instance;
+		return instance;
+	}
+
+	EnemyBehaviorSystem(const EnemyBehaviorSystem&) = delete;
+	EnemyBehaviorSystem& operator=(const EnemyBehaviorSystem&) = delete;
+
+	// 挙動定義の読み込み（JSONが無ければデフォルトを作って保存）
+	void Load();
+	bool LoadFromJson(const std::string& filepath);
+	bool SaveToJson(const std::string& filepath) const;
+
+	const EnemyBehaviorDef& GetDef(EnemyKind kind) const { return defs_[static_cast<int>(kind)]; }
+
+	// 登録・解除（戻り値のIDで EnemyBrain にアクセスする）
+	int Register(EnemyKind kind, const Vector2* positionSource, const Vector2& colliderSize, const Vector2& colliderOffset);
+	void Unregister(int id);
+
+	// IDから状態を取得（Register で配列が再確保されるので参照は保持しないこと）
+	EnemyBrain& GetBrain(int id);
+
+	// 巡回の基準位置を取り直す（配置がずれていても次の Update の位置で確定する）
+	void ResetBrain(int id);
+
+	// 当たり判定サイズの変更を反映する（足場判定に使う。倒れて判定が低くなる敵など）
+	void SetColliderSize(int id, const Vector2& colliderSize);
+
+	/// <summary>
+	/// 全敵の挙動を更新（GameObjectManager::Update の前に1回呼ぶ）
+	/// </summary>
+	/// <param name="deltaTime">経過フレーム</param>
+	/// <param name="playerPos">プレイヤー位置（いなければ nullptr）</param>
+	void Update(float deltaTime, const Vector2* playerPos);
+
+	// 被弾時のスタン
+	void Stun(int id);
+	bool IsStunnable(int id);
+
+	int GetCount(EnemyKind kind) const { return static_cast<int>(brains_[static_cast<int>(kind)].size()); }
+
+	void ShowDebugWindow();
+
+private:
+	EnemyBehaviorSystem();
+	~EnemyBehaviorSystem() = default;
+
+	void LoadDefaults();
+
+	// 種類ごとの一括更新
+	void UpdateKind(EnemyKind kind, float deltaTime);
+
+	void FindPlayer(EnemyBrain& brain, const EnemyBehaviorDef& def);
+	void Patrol(EnemyBrain& brain, const EnemyBehaviorDef& def, float deltaTime);
+	void Battle(EnemyBrain& brain, const EnemyBehaviorDef& def, float deltaTime);
+	void BattleIdle(EnemyBrain& brain, const EnemyBehaviorDef& def, float deltaTime);
+	void RunTowardsPlayer(EnemyBrain& brain, const EnemyBehaviorDef& def, float deltaTime);
+	void RunSequence(EnemyBrain& brain, const EnemyBehaviorDef& def, float deltaTime);
+	void ReturnToPatrol(EnemyBrain& brain);
+
+	std::array<EnemyBehaviorDef, static_cast<int>(EnemyKind::Count)> defs_;
+
+	// 種類ごとの連続配列
+	std::array<std::vector<EnemyBrain>, static_cast<int>(EnemyKind::Count)> brains_;
+
+	// ID → 配列位置（swap-and-pop で詰めるので間接参照にする）
+	struct Slot {
+		EnemyKind kind = EnemyKind::Kinoko;
+		int index = -1;
+	};
+	std::vector<Slot> slots_;
+	std::vector<int> freeIds_;
+
+	// フレームごとのプレイヤー位置
+	bool hasPlayer_ = false;
+	Vector2 playerPos_ = { 0.0f, 0.0f };
+};
@@ -93,28 +93,11 @@ public:
 };
 
 class FatEnemy : public AttackEnemy {
-	float windDownTwoDuration_ = 25.0f; // 2回目の攻撃後のクールダウン時間
-	float windDownTwoTimer_ = 0.0f; // 2回目のクールダウンタイマー
-
 	float chargeForce_ = 15.0f; // 突進力
 
-	enum  FatEnemyDrawState {
-		ePatrol,
-		eStunned,
-		eAttack,
-		eWindup,
-		eBattleIdle,
-		eRun,
-		eAttack2,
-	};
-
 public:
 	FatEnemy() {
-		direction_ = 1;         // 移動方向（1: 右, -1: 左）
-
-		// 移動速度
-		moveSpeed_ = 2.0f;
-		runSpeed_ = 4.0f;
+		kind_ = EnemyKind::FatKinoko;
 
 		// damaged handling
 		damagedShakingDuration_ = 20.0f; // ダメージ時の揺れ時間
@@ -123,44 +106,6 @@ public:
 		damagedShakeOffset_ = { 0.0f, 0.0f };
 		isDamaged_ = false;
 
-		// states
-		state_ = AttackEnemyPhase::Patrolling;
-		initialPosition_;    // 初期位置
-		stunned_ = false;
-
-		// プレイヤー参照
-		playerRef_ = nullptr; // プレイヤー参照
-		playerPos_ = { 0.0f, 0.0f };
-		distanceToPlayer_ = 0.0f;
-		detectionRange_ = 600.0f; // プレイヤー検知範囲
-
-		// stun state
-		stunDuration_ = 150.0f; // スタン状態の持続時間（フレーム数）
-		stunTimer_ = 0.0f;    // スタン状態のタイマー
-
-		// patrol state
-		patrolRange_ = 200.0f; // パトロール範囲
-
-		// battle state
-		attackRange_ = 190.0f; // 攻撃範囲
-		keepDistance_ = 150.0f; // プレイヤーとの距離維持
-		battleRange_ = 260.0f; // 戦闘維持範囲
-		escapeRange_ = 860.0f; // 戦闘離脱範囲
-
-		attackCooldown_ = 60.0f; // 攻撃クールダウン時間
-		attackTimer_ = 0.0f; // 攻撃タイマー
-
-		windDownDuration_ = 50.0f; // 攻撃後のクールダウン時間
-		windDownTimer_ = 0.0f; // クールダウンタイマー
-
-		windupDuration_ = 60.0f; // 攻撃の溜め時間
-		windupTimer_ = 0.0f; // 溜めタイマー
-		windupShakeMagnitude_ = 0.0f; // 溜め時の画面揺れの大きさ
-		windupShakeIncrement_ = 0.1f; // 画面揺れの増加量
-		emitedCanAttackEffect_ = false;
-		battleState_ = AttackEnemyBattleState::Idle;
-
-
 		DrawOffset_ = { -64.f, 100.f };
 
 		foundPlayerSound = SeId::EnemyFindPlayer3;
@@ -176,33 +121,28 @@ public:
 
 		rigidbody_.maxSpeedX = chargeForce_ * 2.2f;
 
-		// マネージャーにコンポーネントを登録
-		drawManager_.RegisterComponent(FatEnemyDrawState::ePatrol,
+		RegisterDrawComponents();
+		RegisterBrain();
+
+		status_.maxHP = 11145;
+		status_.currentHP = status_.maxHP;
+	}
+
+	virtual void RegisterDrawComponents() override {
+		RegisterDrawComponent(EnemyAnim::Patrol,
 			new DrawComponent2D(Tex().GetTexture(TextureId::FatEnemyWalk), 8, 1, 8, 5.f, true));
-		drawManager_.RegisterComponent(FatEnemyDrawState::eStunned,
+		RegisterDrawComponent(EnemyAnim::Stunned,
 			new DrawComponent2D(Tex().GetTexture(TextureId::FatEnemyStun), 3, 1, 3, 5.f, false));
-		drawManager_.RegisterComponent(FatEnemyDrawState::eAttack,
+		RegisterDrawComponent(EnemyAnim::Attack,
 			new DrawComponent2D(Tex().GetTexture(TextureId::FatEnemyAttack), 6, 1, 6, 5.f, false));
-		drawManager_.RegisterComponent(FatEnemyDrawState::eRun,
+		RegisterDrawComponent(EnemyAnim::Run,
 			new DrawComponent2D(Tex().GetTexture(TextureId::FatEnemyRun), 8, 1, 8, 3.f, true));
-		drawManager_.RegisterComponent(FatEnemyDrawState::eWindup,
+		RegisterDrawComponent(EnemyAnim::Windup,
 			new DrawComponent2D(Tex().GetTexture(TextureId::FatEnemyWindup), 4, 1, 4, 5.f, false));
-		drawManager_.RegisterComponent(FatEnemyDrawState::eBattleIdle,
+		RegisterDrawComponent(EnemyAnim::BattleIdle,
 			new DrawComponent2D(Tex().GetTexture(TextureId::FatEnemyBattleIdle), 6, 1, 6, 5.f, true));
-		drawManager_.RegisterComponent(FatEnemyDrawState::eAttack2,
+		RegisterDrawComponent(EnemyAnim::Attack2,
 			new DrawComponent2D(Tex().GetTexture(TextureId::FatEnemyAttack2), 5, 1, 5, 5.f, false));
-
-		// 全コンポーネントを初期化
-		auto compNames = { FatEnemyDrawState::ePatrol, FatEnemyDrawState::eStunned, FatEnemyDrawState::eAttack, FatEnemyDrawState::eRun, FatEnemyDrawState::eWindup, FatEnemyDrawState::eBattleIdle, FatEnemyDrawState::eAttack2 };
-		for (const auto& name : compNames) {
-			if (auto* comp = drawManager_.GetComponent(name)) {
-				comp->Initialize();
-			}
-		}
-
-		initialPosition_ = transform_.translate;
-		status_.maxHP = 11145;
-		status_.currentHP = status_.maxHP;
 	}
 
 	virtual void SpawnStar() override {
@@ -214,112 +154,28 @@ public:
 		
 	}
 
-	virtual void Stunning(float deltaTime) override {
-		stunTimer_ -= deltaTime;
+	virtual void Stun() override {
+		AttackEnemy::Stun();
+
+		// 倒れている間は当たり判定を低くする
 		collider_.size = { 140.f, 120.f };
 		DrawOffset_ = { -64.f, 100.f + 60.f };
-
-		if (stunTimer_ <= 0) {
-			stunned_ = false;
-			collider_.size = { 140.f, 240.f };
-			DrawOffset_ = { -64.f, 100.f };
-		}
+		EnemyBehaviorSystem::GetInstance().SetColliderSize(brainId_, collider_.size);
 	}
 
-	virtual void Windup(float deltaTime) {
-		windupTimer_ += deltaTime;
-
-		if (!emitedCanAttackEffect_) {
-			ParticleManager::GetInstance().Emit(ParticleType::Enemy_CanStan, transform_.translate);
-			emitedCanAttackEffect_ = true;
-
-			// 前のエフェクトを明示的に停止してから新しいエフェクトを開始
-			drawManager_.StopFlashBlink();
-			drawManager_.StartFlashBlink(0xFFFFFFFF, 4, windupDuration_ / 8.f / 60.f, BlendMode::kBlendModeAdd, 2);
-		}
-
-		if (windupTimer_ >= windupDuration_ / 2) {
-			windupShakeMagnitude_ += windupShakeIncrement_ * deltaTime;
-		}
-
-		if (windupTimer_ >= windupDuration_) {
-			battleState_ = AttackEnemyBattleState::Attacking;
-			windupTimer_ = 0.0f;
-			windupShakeMagnitude_ = 0.0f;
-			emitedCanAttackEffect_ = false;
-
-			rigidbody_.AddForce({ direction_ * chargeForce_, 0.0f });
-
-			// Create and position the hitbox
-			SpawnHitBox(15.f);
-			SoundManager::GetInstance().PlaySe(AttackSound);
-		}
+	virtual void OnStunEnd() override {
+		collider_.size = { 140.f, 240.f };
+		DrawOffset_ = { -64.f, 100.f };
+		EnemyBehaviorSystem::GetInstance().SetColliderSize(brainId_, collider_.size);
 	}
 
-	virtual void SpawnHitBox(float lifetime) {
+	virtual void SpawnHitBox(float lifetime) override {
 		FatEnemyHitBox* hitbox = manager_->Spawn<FatEnemyHitBox>(this, "EnemyHitBox");
-		hitbox->SetPosition(transform_.translate + Vector2(64.f, 0.f) * float(direction_));
+		hitbox->SetPosition(transform_.translate + Vector2(64.f, 0.f) * float(Direction()));
 		hitbox->setLifetime(lifetime);
 		hitbox->SetOwner(this);
 	}
 
-	void Attack(float deltaTime)  override{
-		windDownTimer_ += deltaTime;
-		if (windDownTimer_ >= windDownDuration_) {
-			battleState_ = AttackEnemyBattleState::Attacking2;
-			windDownTimer_ = 0.0f;
-			SpawnHitBox(15.f);
-			SoundManager::GetInstance().PlaySe(AttackSound);
-
-			rigidbody_.AddForce({ direction_ * chargeForce_, 0.0f });
-		}
-	}
-
-	void Attack2(float deltaTime) {
-		windDownTwoTimer_ += deltaTime;
-		if (windDownTwoTimer_ >= windDownTwoDuration_) {
-			battleState_ = AttackEnemyBattleState::Idle;
-			windDownTwoTimer_ = 0.0f;
-			// Create and position the hitbox
-
-			if(distanceToPlayer_ <= keepDistance_) {
-				rigidbody_.AddForce({ -direction_ * chargeForce_ * 2.2f, chargeForce_});
-
-			}
-			
-		}
-	}
-
-	virtual void BattleBehavior(float deltaTime) override {
-		if (distanceToPlayer_ > escapeRange_) {
-			ReturnToPatrol();
-			return;
-		}
-
-		switch (battleState_) {
-		case AttackEnemyBattleState::Idle:
-			drawManager_.ChangeComponent(FatEnemyDrawState::eBattleIdle);
-			BattleIdle(deltaTime);
-			break;
-		case AttackEnemyBattleState::Running:
-			drawManager_.ChangeComponent(FatEnemyDrawState::eRun);
-			RunTowardsPlayer(deltaTime);
-			break;
-		case AttackEnemyBattleState::Windup:
-			drawManager_.ChangeComponent(FatEnemyDrawState::eWindup);
-			Windup(deltaTime);
-			break;
-		case AttackEnemyBattleState::Attacking:
-			drawManager_.ChangeComponent(FatEnemyDrawState::eAttack);
-			Attack(deltaTime);
-			break;
-		case AttackEnemyBattleState::Attacking2:
-			drawManager_.ChangeComponent(FatEnemyDrawState::eAttack2);
-			Attack2(deltaTime);
-			break;
-		}
-	}
-
 	void Draw(const Camera2D& camera) override {
 		if (!info_.isActive || !info_.isVisible) return;
 
@@ -0,0 +1,102 @@
+﻿#include "FileWatcher.h"
+#include <algorithm>
+#include <memory>
+#include "AsyncIO.h"
+
+int FileWatcher::Watch(const std::string& path, ChangeCallback onChanged) {
+	const std::string key = NormalizePath(path);
+	if (knownTimes_.find(key) == knownTimes_.end()) {
+		knownTimes_[key] = GetWriteTime(key);
+	}
+
+	const int watchId = nextId_++;
+	entries_.push_back({ watchId, key, std::move(onChanged) });
+	return watchId;
+}
+
+void FileWatcher::Unwatch(int watchId) {
+	auto it = std::find_if(entries_.begin(), entries_.end(), [watchId](const Entry& entry) { return entry.id == watchId; });
+	if (it == entries_.end()) return;
+
+	const std::string key = it->path;
+	entries_.erase(it);
+
+	// 誰も見ていないパスは確認対象から外す
+	const bool isStillWatched = std::any_of(entries_.begin(), entries_.end(), [&key](const Entry& entry) { return entry.path == key; });
+	if (!isStillWatched) {
+		knownTimes_.erase(key);
+	}
+}
+
+void FileWatcher::Acknowledge(const std::string& path) {
+	auto it = knownTimes_.find(NormalizePath(path));
+	if (it != knownTimes_.end()) {
+		it->second = GetWriteTime(it->first);
+	}
+}
+
+void FileWatcher::Update() {
+	if (!isEnabled_ || entries_.empty() || isPolling_) return;
+	if (++frameCounter_ < kPollIntervalFrames) return;
+	frameCounter_ = 0;
+
+	// 確認するパスを固定してワーカーに渡す（ファイルシステムへの問い合わせはメインスレッドで行わない）
+	std::vector<std::string> paths;
+	paths.reserve(knownTimes_.size());
+	for (const auto& [path, time] : knownTimes_) {
+		paths.push_back(path);
+	}
+
+	using PathTimes = std::vector<std::pair<std::string, std::filesystem::file_time_type>>;
+	auto result = std::make_shared<PathTimes>();
+	isPolling_ = true;
+
+	AsyncIO::GetInstance().Submit(
+		[paths = std::move(paths), result]() {
+			result->reserve(paths.size());
+			for (const std::string& path : paths) {
+				result->emplace_back(path, GetWriteTime(path));
+			}
+		},
+		[this, result]() {
+			isPolling_ = false;
+			ApplyPollResult(*result);
+		});
+}
+
+void FileWatcher::ApplyPollResult(const std::vector<std::pair<std::string, std::filesystem::file_time_type>>& times) {
+	std::vector<std::string> changedPaths;
+	for (const auto& [path, time] : times) {
+		auto it = knownTimes_.find(path);
+		if (it == knownTimes_.end()) continue;
+
+		// 確認中に Acknowledge で進んだ時刻より古い結果は無視する
+		if (time <= it->second) continue;
+
+		it->second = time;
+		changedPaths.push_back(path);
+	}
+
+	for (const std::string& path : changedPaths) {
+		// コールバック内で Watch / Unwatch されてもよいように、呼ぶ前に対象を集める
+		std::vector<ChangeCallback> callbacks;
+		for (const Entry& entry : entries_) {
+			if (entry.path == path) {
+				callbacks.push_back(entry.onChanged);
+			}
+		}
+		for (const ChangeCallback& callback : callbacks) {
+			callback(path);
+		}
+	}
+}
+
+std::string FileWatcher::NormalizePath(const std::string& path) {
+	return std::filesystem::path(path).lexically_normal().generic_string();
+}
+
+std::filesystem::file_time_type FileWatcher::GetWriteTime(const std::string& path) {
+	std::error_code error;
+	const auto time = std::filesystem::last_write_time(path, error);
+	return error ? std::filesystem::file_time_type::min() : time;
+}
@@ -0,0 +1,70 @@
+﻿#pragma once
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// <summary>
+/// ファイルの更新を監視し、変わったら登録したコールバックを呼ぶ（データの調整を再起動なしで反映する用）
+/// 更新時刻の確認は AsyncIO のワーカーで行い、コールバックは完了時の同期点でメインスレッドから呼ぶ。
+/// OS の変更通知APIは使わず、一定間隔のポーリングで検出する
+/// </summary>
+class FileWatcher {
+public:
+	using ChangeCallback = std::function<void(const std::string& path)>;
+
+	static FileWatcher& GetInstance() {
+		static FileWatcher instance;
+		return instance;
+	}
+
+	FileWatcher(const FileWatcher&) = delete;
+	FileWatcher& operator=(const FileWatcher&) = delete;
+
+	// 監視を登録して ID を返す（登録時点の更新時刻を基準にする）
+	int Watch(const std::string& path, ChangeCallback onChanged);
+
+	// 登録を解除する（コールバックの持ち主が破棄されるときに必ず呼ぶ）
+	void Unwatch(int watchId);
+
+	/// <summary>
+	/// 自分で書き込んだファイルの更新時刻を取り込み、変更として扱わないようにする
+	/// （AsyncIO の書き込み完了時に呼ばれる）
+	/// </summary>
+	void Acknowledge(const std::string& path);
+
+	// 1フレームに1回呼ぶ（kPollIntervalFrames ごとに確認ジョブを積む）
+	void Update();
+
+	void SetEnabled(bool isEnabled) { isEnabled_ = isEnabled; }
+	bool IsEnabled() const { return isEnabled_; }
+
+private:
+	FileWatcher() = default;
+	~FileWatcher() = default;
+
+	struct Entry {
+		int id;
+		std::string path;
+		ChangeCallback onChanged;
+	};
+
+	// 表記ゆれ（"./" の有無など）を揃えたキー
+	static std::string NormalizePath(const std::string& path);
+
+	// 更新時刻の取得（ファイルが無ければ最小値）
+	static std::filesystem::file_time_type GetWriteTime(const std::string& path);
+
+	// 確認ジョブの結果を反映し、更新されたファイルのコールバックを呼ぶ
+	void ApplyPollResult(const std::vector<std::pair<std::string, std::filesystem::file_time_type>>& times);
+
+	static constexpr int kPollIntervalFrames = 30;
+
+	std::vector<Entry> entries_;
+	std::unordered_map<std::string, std::filesystem::file_time_type> knownTimes_;
+	int nextId_ = 1;
+	int frameCounter_ = 0;
+	bool isPolling_ = false;
+	bool isEnabled_ = true;
+};
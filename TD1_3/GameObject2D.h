@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include <string>
 #include <memory>
+#include <cstdint>
 
 #include "Vector2.h"
 #include "Matrix3x3.h"
@@ -195,9 +196,9 @@ public:
         if (!this) return;
 
 #ifdef _DEBUG
-        // デバッグ用GUIウィンドウ表示
-        if (ImGui::TreeNode(("GameObject ID: " + std::to_string(info_.id)).c_str())) {
-            ImGui::Text(("Tag: " + info_.tag).c_str());
+        // デバッグ用GUIウィンドウ表示（文字列を組み立てずに書式で渡す）
+        if (ImGui::TreeNode(reinterpret_cast<void*>(static_cast<intptr_t>(info_.id)), "GameObject ID: %d", info_.id)) {
+            ImGui::Text("Tag: %s", info_.tag.c_str());
             ImGui::Text("Active: %s", info_.isActive ? "Yes" : "No");
             ImGui::Text("Visible: %s", info_.isVisible ? "Yes" : "No");
             ImGui::Separator();
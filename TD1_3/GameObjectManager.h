@@ -4,6 +4,7 @@
 #include <memory>
 #include <algorithm>
 #include "MapData.h"
+#include "DebugStats.h"
 #include <utility>
 
 enum class ObjectType {
@@ -27,11 +28,14 @@ private:
 
 
     template <typename T, typename... Args>
-    T* CreateObject(GameObject2D* owner, const std::string& tag, Args&&... args) {
+    T* CreateObject(GameObject2D* owner, const std::string& tag, const Vector2* position, Args&&... args) {
         // 1. メモリ確保 (T型で作成)
         auto newObj = std::make_unique<T>(std::forward<Args>(args)...);
 
         // 2. 基本情報のセットアップ
+        if (position) {
+            newObj->SetPosition(*position); // Initialize が位置を使えるように先に置く
+        }
         newObj->SetOwner(owner);      // オーナー登録
         newObj->SetManager(this);     // マネージャー登録
         newObj->GetInfo().tag = tag;  // タグ設定
@@ -62,20 +66,29 @@ public:
     /// <returns>生成されたオブジェクトのポインタ</returns>
     template <typename T, typename... Args>
     T* Spawn(GameObject2D* owner, const char* tag, Args&&... args) {
-        return CreateObject<T>(owner, std::string(tag), std::forward<Args>(args)...);
+        return CreateObject<T>(owner, std::string(tag), nullptr, std::forward<Args>(args)...);
     }
 
     // 2. Match for std::string Tag
     template <typename T, typename... Args>
     T* Spawn(GameObject2D* owner, const std::string& tag, Args&&... args) {
-        return CreateObject<T>(owner, tag, std::forward<Args>(args)...);
+        return CreateObject<T>(owner, tag, nullptr, std::forward<Args>(args)...);
+    }
+
+    /// <summary>
+    /// 位置を決めてから生成する（Initialize の時点で位置が入っている）
+    /// 敵の巡回範囲など、Initialize で初期位置を覚えるオブジェクトの配置に使う
+    /// </summary>
+    template <typename T, typename... Args>
+    T* SpawnAt(GameObject2D* owner, const std::string& tag, const Vector2& position, Args&&... args) {
+        return CreateObject<T>(owner, tag, &position, std::forward<Args>(args)...);
     }
 
     // 3. No Tag Provided (Defaults to "Untagged")
     // This catches everything else.
     template <typename T, typename... Args>
     T* Spawn(GameObject2D* owner, Args&&... args) {
-        return CreateObject<T>(owner, std::string("Untagged"), std::forward<Args>(args)...);
+        return CreateObject<T>(owner, std::string("Untagged"), nullptr, std::forward<Args>(args)...);
     }
 
 	// MapDataから
@@ -94,9 +107,7 @@ public:
     //  基本ループ
     // ==========================================
     void Update(float deltaTime) {
-#ifdef _DEBUG
-		Novice::ScreenPrintf(0, 20, "Object Count: %d", static_cast<int>(objects_.size()));
-#endif
+		DebugStats::GetInstance().SetCounter(DebugCounter::ObjectCount, static_cast<int>(objects_.size()));
 
         // 1. 新規追加オブジェクトをメインリストへ統合
         for (auto& obj : pendingObjects_) {
@@ -127,6 +138,12 @@ public:
         }
     }
 
+    // まとめて生成する前に確保しておく（ステージ読み込み時など）
+    void Reserve(size_t count) {
+        objects_.reserve(objects_.size() + pendingObjects_.size() + count);
+        pendingObjects_.reserve(pendingObjects_.size() + count);
+    }
+
     // 全削除（シーン切り替え時など）
     void Clear() {
         objects_.clear();
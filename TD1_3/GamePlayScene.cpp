@@ -6,13 +6,12 @@
 
 #include "Player.h"
 #include "Usagi.hpp"
-#include "KinokoSpawner.hpp"
 #include "WorldOrigin.h"
 #include "ObjectRegistry.h"
 #include "ParticleManager.h"
+#include "EnemyBehaviorSystem.h"
+#include "DebugStats.h"
 #include "Button.hpp"
-#include "Door.hpp"
-#include "UsagiCheckPoint.hpp"
 
 #include "PhysicsManager.h"
 #include "UIManager.h"
@@ -22,7 +21,16 @@
 
 // Tips System
 #include "TipsManager.h"
-#include "TipsTrigger.hpp"
+
+#ifdef _DEBUG
+#include "FileWatcher.h"
+#endif
+
+namespace {
+	const char* const kStageDataPath = "./Resources/data/stage1.json";
+	const char* const kParticleParamPath = "./Resources/Data/particle_params.json";
+	const char* const kEnemyBehaviorPath = "./Resources/Data/enemy_behaviors.json";
+}
 
 GamePlayScene::GamePlayScene(SceneManager& mgr)
 	: manager_(mgr) {
@@ -40,6 +48,11 @@ GamePlayScene::GamePlayScene(SceneManager& mgr)
 }
 
 GamePlayScene::~GamePlayScene() {
+#ifdef _DEBUG
+	for (int watchId : hotReloadWatchIds_) {
+		FileWatcher::GetInstance().Unwatch(watchId);
+	}
+#endif
 }
 
 void GamePlayScene::Initialize() {
@@ -70,7 +83,8 @@ void GamePlayScene::Initialize() {
 	// 1. エディタ初期化（タイル定義のロード）
 	mapEditor_.Initialize(&mapManager_);
 #endif
-	ParticleManager::GetInstance().LoadParamsFromJson("./Resources/Data/particle_params.json");
+	// パラメータは起動時に読み込み済みなので、編集内容の取り込みは非同期で行う
+	ParticleManager::GetInstance().LoadParamsFromJsonAsync(kParticleParamPath);
 
 	// 3. マップ描画クラスの初期化
 	mapChip_.Initialize();
@@ -93,6 +107,109 @@ void GamePlayScene::Initialize() {
 	if (player_) {
 		camera_->SetPosition(player_->GetPosition());
 	}
+
+	TakeStageSnapshot();
+
+#ifdef _DEBUG
+	InitializeHotReload();
+#endif
+}
+
+#ifdef _DEBUG
+void GamePlayScene::InitializeHotReload() {
+	FileWatcher& watcher = FileWatcher::GetInstance();
+
+	// パーティクル：変わった型のパラメータだけ差し替わる（再生中のものは次の発生から反映）
+	hotReloadWatchIds_.push_back(watcher.Watch(kParticleParamPath, [](const std::string& path) {
+		ParticleManager::GetInstance().ReloadParamsAsync(path);
+	}));
+
+	// 敵の挙動：定義は毎ティック参照されるので、読み直すだけで動いている敵にも反映される
+	hotReloadWatchIds_.push_back(watcher.Watch(kEnemyBehaviorPath, [](const std::string& path) {
+		if (!EnemyBehaviorSystem::GetInstance().LoadFromJson(path)) {
+			Novice::ConsolePrintf("[HotReload] Failed to load %s. Kept the previous definitions.\n", path.c_str());
+			return;
+		}
+		Novice::ConsolePrintf("[HotReload] Enemy behaviors reloaded.\n");
+	}));
+
+	// ステージ：変わった行のチャンクだけ作り直す。スポーン情報が変わった場合はリトライで配置し直す
+	hotReloadWatchIds_.push_back(watcher.Watch(kStageDataPath, [this](const std::string& path) {
+		MapData& mapData = MapData::GetInstance();
+		if (mapData.HasUnsavedChanges()) {
+			Novice::ConsolePrintf("[HotReload] %s changed, but the editor has unsaved changes. Skipped.\n", path.c_str());
+			return;
+		}
+
+		std::weak_ptr<int> token = hotReloadToken_;
+		mapData.ReloadAsync(path, [this, token](const MapReloadResult& result) {
+			if (token.expired() || !result.isApplied) return;
+
+			mapManager_.SyncDirtyChunks();
+			if (result.hasSpawnChanges) {
+				Retry();
+			}
+			Novice::ConsolePrintf("[HotReload] Map reloaded: rows=%d chunks=%d spawns=%s%s\n",
+				result.changedRows, result.changedChunks,
+				result.hasSpawnChanges ? "changed" : "same",
+				result.isFullReload ? " (full)" : "");
+		});
+	}));
+}
+#endif
+
+void GamePlayScene::TakeStageSnapshot() {
+	stageSnapshot_.cameraPosition = camera_->GetPosition();
+	stageSnapshot_.cameraZoom = camera_->GetZoom();
+	TipsManager::GetInstance().GetCollection().GetUnlockedIds(stageSnapshot_.unlockedTipsIds);
+	stageSnapshot_.isValid = true;
+}
+
+bool GamePlayScene::Retry() {
+	if (!stageSnapshot_.isValid) {
+		return false;
+	}
+
+	// レジストリ・パーティクル設定・マップと動的タイルは作り直さない
+	fade_ = 0.0f;
+
+	// オブジェクト（ボタン・扉の状態も含む）は常駐しているスポーン情報から生成し直す
+	objectManager_.Clear();
+	player_ = nullptr;
+	worldOrigin_ = nullptr;
+
+	// パーティクルと演出
+	particleManager_->StopAllContinuousEmit();
+	particleManager_->Clear();
+	mapManager_.ResetTileStates();
+
+	// カメラ
+	camera_->StopAllEffects();
+	InitializeCamera();
+	camera_->SetZoom(stageSnapshot_.cameraZoom);
+
+	InitializeObjects();
+	camera_->SetPosition(stageSnapshot_.cameraPosition);
+
+	// ホットリロードでプレイヤーの配置が消えている場合もある
+	if (player_) {
+		backgroundManager_->SetInitialCameraPosition(player_->GetPosition());
+	}
+
+	// Tips（解放状態を開始時点に戻し、UIの演出を止める）
+	TipsManager::GetInstance().RestoreProgress(stageSnapshot_.unlockedTipsIds);
+	if (tipsUIDrawer_) {
+		tipsUIDrawer_->ResetState();
+	}
+	if (tipsCollectionUI_) {
+		tipsCollectionUI_->ResetState();
+	}
+
+	UIManager::GetInstance().SetGamePlay(true);
+	SoundManager::GetInstance().PlayBgm(BgmId::Tutorial);
+
+	Novice::ConsolePrintf("[GamePlayScene] Retry: restored stage start snapshot\n");
+	return true;
 }
 
 void GamePlayScene::InitializeCamera() {
@@ -105,13 +222,13 @@ void GamePlayScene::InitializeCamera() {
 }
 
 void GamePlayScene::InitializeObjects() {
-	// シングルトンを使う
-	auto& mapData = MapData::GetInstance();
-	const auto& spawns = mapData.GetObjectSpawns();
+	// 配置データをタイプごとにまとめて生成（生成方法は ObjectRegistry が持つ）
+	ObjectSpawnContext context;
+	context.manager = &objectManager_;
+	ObjectRegistry::SpawnAll(MapData::GetInstance().GetObjectSpawns(), context);
 
-	for (const auto& spawn : spawns) {
-		SpawnObjectFromData(spawn);
-	}
+	player_ = static_cast<Usagi*>(context.player);
+	worldOrigin_ = static_cast<WorldOrigin*>(context.worldOrigin);
 
 	// Playerが生成されていない場合はデフォルト位置に配置
 	if (!player_) {
@@ -133,367 +250,6 @@ void GamePlayScene::InitializeObjects() {
 	}
 }
 
-void GamePlayScene::SpawnObjectFromData(const ObjectSpawnInfo& spawn) {
-	switch (spawn.objectTypeId) {
-	case 0: // WorldOrigin（拠点・ワールド座標の原点）
-		if (!worldOrigin_) {
-			worldOrigin_ = objectManager_.Spawn<WorldOrigin>(nullptr, "WorldOrigin");
-			worldOrigin_->SetPosition(spawn.position);
-			Novice::ConsolePrintf("[GamePlayScene] Spawned WorldOrigin at (%.1f, %.1f)\n",
-				spawn.position.x, spawn.position.y);
-		}
-		break;
-	case 99: {
-		auto* checkPoint = objectManager_.Spawn<UsagiCheckPoint>(nullptr, "UsagiCheckPoint");
-		checkPoint->SetPosition(spawn.position);
-		checkPoint->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned UsagiCheckPoint at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-
-	case 100: // PlayerStart
-		if (!player_) {
-			player_ = objectManager_.Spawn<Usagi>(nullptr, "Player");
-			player_->SetPosition(spawn.position);
-			player_->Initialize();
-			Novice::ConsolePrintf("[GamePlayScene] Spawned Player at (%.1f, %.1f)\n",
-				spawn.position.x, spawn.position.y);
-			//player_->SetManager(&objectManager_);
-		}
-		break;
-
-		// 追加するオブジェクトタイプはここに追加
-	case 101: { // Enemy_Normal
-		auto* enemy = objectManager_.Spawn<Enemy>(nullptr, "Enemy");
-		enemy->SetPosition(spawn.position);
-		enemy->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned Enemy at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-
-	case 102: { // Enemy_spawner
-		auto* spawner = objectManager_.Spawn<KinokoSpawner>(nullptr, "KinokoSpawner");
-		spawner->SetPosition(spawn.position);
-		spawner->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned KinokoSpawner at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	case 103: { // AttackEnemy
-		auto* enemy = objectManager_.Spawn<AttackEnemy>(nullptr, "Enemy");
-		enemy->SetPosition(spawn.position);
-		enemy->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned AttackEnemy at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	case 104: { // AttackEnemySpawner
-		auto* spawner = objectManager_.Spawn<AttackKinokoSpawner>(nullptr, "KinokoSpawner");
-		spawner->SetPosition(spawn.position);
-		spawner->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned AttackEnemySpawner at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	case 105: { // FatEnemy
-		auto* enemy = objectManager_.Spawn<FatEnemy>(nullptr, "Enemy");
-		enemy->SetPosition(spawn.position);
-		enemy->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned FatEnemy at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	case 300: { // Button1
-		auto* button = objectManager_.Spawn<Button1>(nullptr, "Button");
-		button->SetPosition(spawn.position);
-		button->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned Button at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	case 400: {
-		auto* door = objectManager_.Spawn<Door1>(nullptr, "Door");
-		door->SetPosition(spawn.position);
-		door->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned Door at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	case 301: { // Button2
-		auto* button = objectManager_.Spawn<Button2>(nullptr, "Button");
-		button->SetPosition(spawn.position);
-		button->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned Button at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	case 401: {
-		auto* door = objectManager_.Spawn<Door2>(nullptr, "Door");
-		door->SetPosition(spawn.position);
-		door->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned Door at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	case 302: { // Button3
-		auto* button = objectManager_.Spawn<Button3>(nullptr, "Button");
-		button->SetPosition(spawn.position);
-		button->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned Button at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	case 402: {
-		auto* door = objectManager_.Spawn<Door3>(nullptr, "Door");
-		door->SetPosition(spawn.position);
-		door->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned Door at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	case 303: { // Button4
-		auto* button = objectManager_.Spawn<Button4>(nullptr, "Button");
-		button->SetPosition(spawn.position);
-		button->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned Button at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	case 403: {
-		auto* door = objectManager_.Spawn<Door4>(nullptr, "Door");
-		door->SetPosition(spawn.position);
-		door->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned Door at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	case 304: { // Button5
-		auto* button = objectManager_.Spawn<Button5>(nullptr, "Button");
-		button->SetPosition(spawn.position);
-		button->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned Button at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	case 404: {
-		auto* door = objectManager_.Spawn<Door5>(nullptr, "Door");
-		door->SetPosition(spawn.position);
-		door->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned Door at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	case 305: { // Button6
-		auto* button = objectManager_.Spawn<Button6>(nullptr, "Button");
-		button->SetPosition(spawn.position);
-		button->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned Button at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	case 405: {
-		auto* door = objectManager_.Spawn<Door6>(nullptr, "Door");
-		door->SetPosition(spawn.position);
-		door->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned Door at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	case 306: { // EnemyEvent
-		auto* event = objectManager_.Spawn<EnemyEvent>(nullptr, "Button");
-		event->SetPosition(spawn.position);
-		event->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned EnemyEvent at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	case 406: { // Door_EnemyEvent
-		auto* door = objectManager_.Spawn<EventDoor>(nullptr, "Door");
-		door->SetPosition(spawn.position);
-		door->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned Door_EnemyEvent at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	case 307: { // EnemyEvent
-		auto* event = objectManager_.Spawn<EnemyEvent2>(nullptr, "Button");
-		event->SetPosition(spawn.position);
-		event->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned EnemyEvent at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	case 407: { // Door_EnemyEvent
-		auto* door = objectManager_.Spawn<EventDoor2>(nullptr, "Door");
-		door->SetPosition(spawn.position);
-		door->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned Door_EnemyEvent at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	case 308: { // EnemyEvent
-		auto* event = objectManager_.Spawn<EnemyEvent3>(nullptr, "Button");
-		event->SetPosition(spawn.position);
-		event->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned EnemyEvent at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	case 408: { // Door_EnemyEvent
-		auto* door = objectManager_.Spawn<EventDoor3>(nullptr, "Door");
-		door->SetPosition(spawn.position);
-		door->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned Door_EnemyEvent at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	case 309: { // EnemyEvent
-		auto* event = objectManager_.Spawn<EnemyEvent4>(nullptr, "Button");
-		event->SetPosition(spawn.position);
-		event->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned EnemyEvent at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	case 409: { // Door_EnemyEvent
-		auto* door = objectManager_.Spawn<EventDoor4>(nullptr, "Door");
-		door->SetPosition(spawn.position);
-		door->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned Door_EnemyEvent at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	case 310: { // Button7
-		auto* button = objectManager_.Spawn<Button7>(nullptr, "Button");
-		button->SetPosition(spawn.position);
-		button->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned Button at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	case 410: {
-		auto* door = objectManager_.Spawn<Door7>(nullptr, "Door");
-		door->SetPosition(spawn.position);
-		door->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawned Door at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	case 500: { // TipsTrigger
-		// customDataからtipsIdを取得
-		int tipsId = 1; // デフォルト値
-		if (spawn.customData.contains("tipsId")) {
-			tipsId = spawn.customData["tipsId"].get<int>();
-		}
-
-		// Spawn<T>(owner, tag, コンストラクタの引数...)
-		auto* trigger = objectManager_.Spawn<TipsTrigger>(
-			nullptr,              // owner
-			"TipsTrigger_1",        // tag
-			spawn.objectTypeId,   // id (TipsTriggerのコンストラクタ第1引数)
-			"TipsTrigger_1",        // name (TipsTriggerのコンストラクタ第2引数)
-			spawn.position,       // position (TipsTriggerのコンストラクタ第3引数)
-			tipsId                // tipsId (TipsTriggerのコンストラクタ第4引数)
-		);
-
-		// プレイヤーへの参照を設定
-		if (player_) {
-			trigger->SetPlayer(player_);
-		}
-
-		Novice::ConsolePrintf("[GamePlayScene] Spawned TipsTrigger (ID:%d) at (%.1f, %.1f)\n",
-			tipsId, spawn.position.x, spawn.position.y);
-		break;
-	}
-
-	case 501: { // TipsTrigger (別ID)
-		// customDataからtipsIdを取得
-		int tipsId = 2; // デフォルト値
-		if (spawn.customData.contains("tipsId")) {
-			tipsId = spawn.customData["tipsId"].get<int>();
-		}
-		// Spawn<T>(owner, tag, コンストラクタの引数...)
-		auto* trigger = objectManager_.Spawn<TipsTrigger>(
-			nullptr,              // owner
-			"TipsTrigger_2",        // tag
-			spawn.objectTypeId,   // id (TipsTriggerのコンストラクタ第1引数)
-			"TipsTrigger_2",        // name (TipsTriggerのコンストラクタ第2引数)
-			spawn.position,       // position (TipsTriggerのコンストラクタ第3引数)
-			tipsId                // tipsId (TipsTriggerのコンストラクタ第4引数)
-		);
-		// プレイヤーへの参照を設定
-		if (player_) {
-			trigger->SetPlayer(player_);
-		}
-		Novice::ConsolePrintf("[GamePlayScene] Spawned TipsTrigger (ID:%d) at (%.1f, %.1f)\n",
-			tipsId, spawn.position.x, spawn.position.y);
-		break;
-	}
-
-	case 502: { // TipsTrigger (別ID)
-		// customDataからtipsIdを取得
-		int tipsId = 3; // デフォルト値
-		if (spawn.customData.contains("tipsId")) {
-			tipsId = spawn.customData["tipsId"].get<int>();
-		}
-		// Spawn<T>(owner, tag, コンストラクタの引数...)
-		auto* trigger = objectManager_.Spawn<TipsTrigger>(
-			nullptr,              // owner
-			"TipsTrigger_3",        // tag
-			spawn.objectTypeId,   // id (TipsTriggerのコンストラクタ第1引数)
-			"TipsTrigger_3",        // name (TipsTriggerのコンストラクタ第2引数)
-			spawn.position,       // position (TipsTriggerのコンストラクタ第3引数)
-			tipsId                // tipsId (TipsTriggerのコンストラクタ第4引数)
-		);
-		// プレイヤーへの参照を設定
-		if (player_) {
-			trigger->SetPlayer(player_);
-		}
-		Novice::ConsolePrintf("[GamePlayScene] Spawned TipsTrigger (ID:%d) at (%.1f, %.1f)\n",
-			tipsId, spawn.position.x, spawn.position.y);
-		break;
-	}
-
-	case 503: { // TipsTrigger (別ID)
-		// customDataからtipsIdを取得
-		int tipsId = 4; // デフォルト値
-		if (spawn.customData.contains("tipsId")) {
-			tipsId = spawn.customData["tipsId"].get<int>();
-		}
-		// Spawn<T>(owner, tag, コンストラクタの引数...)
-		auto* trigger = objectManager_.Spawn<TipsTrigger>(
-			nullptr,              // owner
-			"TipsTrigger_4",        // tag
-			spawn.objectTypeId,   // id (TipsTriggerのコンストラクタ第1引数)
-			"TipsTrigger_4",        // name (TipsTriggerのコンストラクタ第2引数)
-			spawn.position,       // position (TipsTriggerのコンストラクタ第3引数)
-			tipsId                // tipsId (TipsTriggerのコンストラクタ第4引数)
-		);
-		// プレイヤーへの参照を設定
-		if (player_) {
-			trigger->SetPlayer(player_);
-		}
-		Novice::ConsolePrintf("[GamePlayScene] Spawned TipsTrigger (ID:%d) at (%.1f, %.1f)\n",
-			tipsId, spawn.position.x, spawn.position.y);
-		break;
-	}
-
-	case 999:{
-		auto* door = objectManager_.Spawn<EndButton>(nullptr, "EndButton");
-		door->SetPosition(spawn.position);
-		door->Initialize();
-		Novice::ConsolePrintf("[GamePlayScene] Spawn point for debugging at (%.1f, %.1f)\n",
-			spawn.position.x, spawn.position.y);
-		break;
-	}
-	default:
-		Novice::ConsolePrintf("[GamePlayScene] Unknown object type: %d\n", spawn.objectTypeId);
-		break;
-	}
-}
-
 void GamePlayScene::InitializeTipsSystem() {
 	// TipsManagerを初期化（データ層、起動時に毎回リセット）
 	TipsManager::GetInstance().Initialize();
@@ -562,8 +318,10 @@ void GamePlayScene::InitializeBackground() {
 
 
 	// プレイヤースポーン後、カメラ初期位置を設定
-	Vector2 spawnPos = { player_->GetPosition() };
-	backgroundManager_->SetInitialCameraPosition(spawnPos);
+	if (player_) {
+		Vector2 spawnPos = { player_->GetPosition() };
+		backgroundManager_->SetInitialCameraPosition(spawnPos);
+	}
 }
 
 void GamePlayScene::Update(float dt, const char* keys, const char* pre) {
@@ -595,13 +353,31 @@ void GamePlayScene::Update(float dt, const char* keys, const char* pre) {
 #endif
 
 	// 動的タイルの更新(カリングとアニメーション更新)
-	mapManager_.Update(dt, *camera_);
+	{
+		DebugScopedTimer timer(DebugTimer::Map);
+		mapManager_.Update(dt, *camera_);
+	}
+
+	// 敵AIを種類ごとに一括更新（プレイヤー位置はここで1回だけ取得）
+	{
+		DebugScopedTimer timer(DebugTimer::EnemyAI);
+		if (player_) {
+			const Vector2 playerPos = player_->GetPosition();
+			EnemyBehaviorSystem::GetInstance().Update(dt, &playerPos);
+		}
+		else {
+			EnemyBehaviorSystem::GetInstance().Update(dt, nullptr);
+		}
+	}
 
-	// GameObjectManager 経由で更新
-	objectManager_.Update(dt);
+	// GameObjectManager 経由で更新（当たり判定込み）
+	{
+		DebugScopedTimer timer(DebugTimer::Objects);
+		objectManager_.Update(dt);
 
-	// 当たり判定（物理演算)
-	CheckCollisions();
+		// 当たり判定（物理演算)
+		CheckCollisions();
+	}
 	/*auto& mapData = MapData::GetInstance();
 	if (player_) {
 		PhysicsManager::ResolveMapCollision(player_, mapData);
@@ -611,7 +387,10 @@ void GamePlayScene::Update(float dt, const char* keys, const char* pre) {
 	//objectManager_.Update(dt);
 
 	// パーティクル
-	particleManager_->Update(dt);
+	{
+		DebugScopedTimer timer(DebugTimer::Particles);
+		particleManager_->Update(dt);
+	}
 
 	// Tips UI更新  
 	if (tipsUIDrawer_) {  
@@ -664,12 +443,15 @@ void GamePlayScene::Update(float dt, const char* keys, const char* pre) {
 	//UIManager::GetInstance().Update(dt);
 	//UIManager::GetInstance().UpdateIcons(dt, player_ ? player_->GetSkillState() : PlayerSkillState{});
 	 // プレイヤーのスキル状態を取得
-	if (player_) {
-		PlayerSkillState skillState = player_->GetSkillState();
-		UIManager::GetInstance().UpdateIcons(dt, skillState);
-	}
+	{
+		DebugScopedTimer timer(DebugTimer::UI);
+		if (player_) {
+			PlayerSkillState skillState = player_->GetSkillState();
+			UIManager::GetInstance().UpdateIcons(dt, skillState);
+		}
 
-	UIManager::GetInstance().Update(dt);
+		UIManager::GetInstance().Update(dt);
+	}
 	UIManager::GetInstance().DrawImGui(); // ImGui描画
 
 	// プレイヤーHPの更新
@@ -739,6 +521,8 @@ void GamePlayScene::Draw() {
 		debugWindow_->DrawPlayerDebugWindow(player_);
 		debugWindow_->DrawParticleDebugWindow(particleManager_, player_);
 	}
+
+	EnemyBehaviorSystem::GetInstance().ShowDebugWindow();
 #endif
 
 	// Tips一覧UIのデバッグウィンドウ
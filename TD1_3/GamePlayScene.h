@@ -28,7 +28,18 @@ public:
     void Update(float dt, const char* keys, const char* pre) override;
     void Draw() override;
 
+    // タイル・定義データは常駐のまま、可変な状態だけをステージ開始時点に戻す
+    bool Retry() override;
+
 private:
+    // ステージ開始時点の可変状態（リトライで復元する）
+    struct StageSnapshot {
+        bool isValid = false;
+        Vector2 cameraPosition = { 0.0f, 0.0f };
+        float cameraZoom = 1.0f;
+        std::vector<int> unlockedTipsIds;
+    };
+
     SceneManager& manager_;
 
     // --- ゲームオブジェクト ---
@@ -71,6 +82,16 @@ private:
     // --- フェード ---
     float fade_ = 0.0f;
 
+    // --- リトライ用 ---
+    StageSnapshot stageSnapshot_;
+
+#ifdef _DEBUG
+    // --- ホットリロード（FileWatcher の登録ID） ---
+    std::vector<int> hotReloadWatchIds_;
+    // 非同期の反映が届く前にシーンが破棄された場合の判定用
+    std::shared_ptr<int> hotReloadToken_ = std::make_shared<int>(0);
+#endif
+
     // 初期化系
     void Initialize();
     void InitializeCamera();
@@ -78,7 +99,10 @@ private:
 
     void InitializeTipsSystem();
     void InitializeBackground();
-    void SpawnObjectFromData(const ObjectSpawnInfo& spawn);
+    void TakeStageSnapshot();
+#ifdef _DEBUG
+    void InitializeHotReload();
+#endif
 
     // ワールド原点取得
     Vector2 GetWorldOriginOffset() const {
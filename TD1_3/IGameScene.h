@@ -7,4 +7,8 @@ public:
 	virtual void Draw() = 0;
 
 	virtual int GetStageIndex() const { return -1; }
+
+	// その場でリトライできるシーンは状態を開始時点に巻き戻して true を返す
+	// false の場合はシーンを作り直す
+	virtual bool Retry() { return false; }
 };
\ No newline at end of file
@@ -1,6 +1,7 @@
 ﻿#include "MapChip.h"
 #include "TileRegistry.h"
 #include "TextureManager.h"
+#include "DebugStats.h"
 
 MapChip::MapChip() {
 }
@@ -52,8 +53,9 @@ void MapChip::DrawBackgroundDecorationBlock(Camera2D& camera, const MapData& map
 // --- カリング範囲計算 ---
 MapChip::CullingRange MapChip::CalculateCullingRange(Camera2D& camera, int width, int height,
 	float tileSize, int marginTiles) const {
-	Vector2 cameraTopLeft = camera.GetTopLeft();
-	Vector2 cameraBottomRight = camera.GetBottomRight();
+	// カメラがキャッシュしている表示範囲（シェイク・回転込み）
+	Vector2 cameraTopLeft = camera.GetVisibleMin();
+	Vector2 cameraBottomRight = camera.GetVisibleMax();
 
 	// マージンを適用
 	cameraTopLeft.x -= marginTiles * tileSize;
@@ -96,7 +98,7 @@ MapChip::DrawSize MapChip::CalculateDrawSize(TileLayer layer, int texW, int texH
 // --- タイル頂点計算 ---
 MapChip::TileVertices MapChip::CalculateTileVertices(int x, int y, float tileSize,
 	const Vector2& drawOffset, const DrawSize& drawSize,
-	const Matrix3x3& vpVp) const {
+	const Affine2x3& vpVp) const {
 	TileVertices vertices;
 
 	// ワールド座標
@@ -110,11 +112,14 @@ MapChip::TileVertices MapChip::CalculateTileVertices(int x, int y, float tileSiz
 	vertices.worldLB = { tileLeft,  tileBottom };
 	vertices.worldRB = { tileRight, tileBottom };
 
-	// スクリーン座標への変換
-	vertices.screenLT = Matrix3x3::Transform(vertices.worldLT, vpVp);
-	vertices.screenRT = Matrix3x3::Transform(vertices.worldRT, vpVp);
-	vertices.screenLB = Matrix3x3::Transform(vertices.worldLB, vpVp);
-	vertices.screenRB = Matrix3x3::Transform(vertices.worldRB, vpVp);
+	// スクリーン座標への変換（4頂点まとめて）
+	const Vector2 world[4] = { vertices.worldLT, vertices.worldRT, vertices.worldLB, vertices.worldRB };
+	Vector2 screen[4];
+	Affine2x3::TransformPoints(world, screen, 4, vpVp);
+	vertices.screenLT = screen[0];
+	vertices.screenRT = screen[1];
+	vertices.screenLB = screen[2];
+	vertices.screenRB = screen[3];
 
 	return vertices;
 }
@@ -199,9 +204,7 @@ void MapChip::preDrawSetup() {
 }
 
 void MapChip::postDrawCleanup() {
-#ifdef _DEBUG
-	Novice::ScreenPrintf(0, 50, "Draw CallsMapChip: %d", DrawMapChipCount);
-#endif
+	DebugStats::GetInstance().SetCounter(DebugCounter::MapChipDrawCalls, DrawMapChipCount);
 	DrawMapChipCount = 0;
 }
 
@@ -217,7 +220,7 @@ void MapChip::DrawLayer(Camera2D& camera, TileLayer layer,float alpha) {
 
 	// 1. カリング範囲計算
 	CullingRange range = CalculateCullingRange(camera, width, height, tileSize, cullingMarginTiles);
-	const Matrix3x3 vpVp = camera.GetVpVpMatrix();
+	const Affine2x3& vpVp = camera.GetVpVpAffine();
 
 	// 2. タイルループ
 	for (int y = range.startY; y < range.endY; ++y) {
@@ -58,7 +58,7 @@ private:
         Vector2 screenLT, screenRT, screenLB, screenRB;
     };
     TileVertices CalculateTileVertices(int x, int y, float tileSize, const Vector2& drawOffset,
-        const DrawSize& drawSize, const Matrix3x3& vpVp) const;
+        const DrawSize& drawSize, const Affine2x3& vpVp) const;
 
     /// <summary>
     /// オートタイルのマスク値を計算
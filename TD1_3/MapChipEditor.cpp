@@ -1,7 +1,8 @@
 ﻿#include "MapChipEditor.h"
 #include "SceneUtilityIncludes.h"
 #include "ObjectRegistry.h"
-#include <queue>
+#include <algorithm>
+#include <chrono>
 
 namespace {
 	void DrawSelectionRect_(Camera2D& camera, float startX, float startY, float endX, float endY, unsigned int fillColor, unsigned int wireColor) {
@@ -23,13 +24,15 @@ void MapChipEditor::Initialize(MapManager* manager) {
 	mapManager_ = manager;
 	selectedTileId_ = 1;
 	selectedObjectTypeId_ = 0;
-	selectedObjectIndex_ = -1;
+	selectedObjectIds_.clear();
+	isDraggingObject_ = false;
+	isBoxSelecting_ = false;
 	currentMode_ = ToolMode::Pen;
 	currentLayer_ = TileLayer::Block;
 
 	undoStack_.clear();
 	redoStack_.clear();
-	strokeCache_.clear();
+	ClearStroke();
 	isDragging_ = false;
 	dragStartCol_ = -1;
 }
@@ -65,18 +68,40 @@ void MapChipEditor::UpdateAndDrawImGui(MapData& mapData, Camera2D& camera) {
 
 	// 保存・ロード
 	if (ImGui::Button("Save Map")) {
-		mapData.Save(currentFilePath_);
+		// 書き込みはワーカーで行うので、計測するのはメインスレッドでの文字列化のみ
+		auto start = std::chrono::high_resolution_clock::now();
+		mapData.SaveAsync(currentFilePath_);
+		auto end = std::chrono::high_resolution_clock::now();
+		lastSaveMs_ = std::chrono::duration<float, std::milli>(end - start).count();
 		ImGui::OpenPopup("Saved");
 	}
 	ImGui::SameLine();
 	if (ImGui::Button("Load Map")) {
-		mapData.Load(currentFilePath_);
+		// 解析が終わった時点（次フレーム以降の同期点）でマップが差し替わる
+		mapData.LoadAsync(currentFilePath_);
 		undoStack_.clear();
 		redoStack_.clear();
 	}
+	ImGui::SameLine();
+	// タイルレイヤーの書き方（Auto はレイヤーごとに一番小さくなるものを選ぶ）
+	{
+		const char* encodingNames[] = { "Auto", "Dense", "RLE", "Sparse" };
+		int encoding = static_cast<int>(mapData.GetSaveEncoding());
+		ImGui::SetNextItemWidth(90.0f);
+		if (ImGui::Combo("##encoding", &encoding, encodingNames, IM_ARRAYSIZE(encodingNames))) {
+			mapData.SetSaveEncoding(static_cast<TileLayerEncoding>(encoding));
+		}
+	}
+	ImGui::SameLine();
+	if (mapData.IsSaving()) {
+		ImGui::TextDisabled("(saving...)");
+	}
+	else {
+		ImGui::TextDisabled(mapData.HasUnsavedChanges() ? "(unsaved)" : "(saved)");
+	}
 
 	if (ImGui::BeginPopup("Saved")) {
-		ImGui::Text("Save Complete!");
+		ImGui::Text("Save Queued! (%.1f ms on main thread)", lastSaveMs_);
 		ImGui::Text("Path: %s", currentFilePath_);
 		ImGui::EndPopup();
 	}
@@ -116,7 +141,7 @@ void MapChipEditor::UpdateAndDrawImGui(MapData& mapData, Camera2D& camera) {
 	if (ImGui::RadioButton("Tile Edit (1)", currentMode_ != ToolMode::Object)) {
 		if (currentMode_ == ToolMode::Object) {
 			currentMode_ = ToolMode::Pen;
-			selectedObjectIndex_ = -1;
+			selectedObjectIds_.clear();
 		}
 	}
 	ImGui::SameLine();
@@ -314,6 +339,11 @@ void MapChipEditor::UpdateAndDrawImGui(MapData& mapData, Camera2D& camera) {
 		HandleObjectMode(mapData, camera);
 	}
 
+	// このフレームの編集・Undo・ロードをまとめて反映
+	if (mapManager_) {
+		mapManager_->SyncDirtyChunks();
+	}
+
 	ImGui::End();
 
 }
@@ -331,8 +361,14 @@ void MapChipEditor::DrawObjectPalette() {
 }
 
 void MapChipEditor::DrawObjectList(MapData& mapData) {
-	mapData; // 未使用警告回避
 	ImGui::Text("Placed Objects (%d):", (int)mapData.GetObjectSpawns().size());
+	if (!selectedObjectIds_.empty()) {
+		ImGui::SameLine();
+		ImGui::Text("Selected: %d", (int)selectedObjectIds_.size());
+	}
+
+	// 一覧の途中で消すと添字がずれるので、消すものはループの後でまとめて消す
+	ObjectSpawnId removeId = kInvalidObjectSpawnId;
 
 	const auto& spawns = mapData.GetObjectSpawns();
 	for (size_t i = 0; i < spawns.size(); ++i) {
@@ -340,10 +376,10 @@ void MapChipEditor::DrawObjectList(MapData& mapData) {
 		const auto* objType = ObjectRegistry::GetObjectType(spawn.objectTypeId);
 		std::string name = objType ? objType->name : "Unknown";
 
-		ImGui::PushID((int)i);
+		ImGui::PushID((int)spawn.id);
 
 		// 選択状態の表示
-		bool isSelected = (selectedObjectIndex_ == (int)i);
+		bool isSelected = IsObjectSelected(spawn.id);
 		if (isSelected) {
 			ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 1.0f, 0.0f, 1.0f));
 		}
@@ -356,27 +392,49 @@ void MapChipEditor::DrawObjectList(MapData& mapData) {
 
 		ImGui::SameLine();
 		if (ImGui::Button("Delete")) {
-			mapData.RemoveObjectSpawn(i);
-			selectedObjectIndex_ = -1;
+			removeId = spawn.id;
 		}
 
 		ImGui::PopID();
 	}
+
+	if (removeId != kInvalidObjectSpawnId) {
+		mapData.RemoveObjectSpawn(removeId);
+		selectedObjectIds_.clear();
+	}
+}
+
+bool MapChipEditor::IsObjectSelected(ObjectSpawnId id) const {
+	return std::find(selectedObjectIds_.begin(), selectedObjectIds_.end(), id) != selectedObjectIds_.end();
 }
 
 void MapChipEditor::HandleObjectMode(MapData& mapData, Camera2D& camera) {
+	// ロードやホットリロードで消えたスポーンは選択から外す
+	selectedObjectIds_.erase(
+		std::remove_if(selectedObjectIds_.begin(), selectedObjectIds_.end(),
+			[&mapData](ObjectSpawnId id) { return mapData.FindObjectSpawn(id) == nullptr; }),
+		selectedObjectIds_.end());
+
+	// アイコンサイズ（32x32ピクセル）
+	const float iconSize = 32.0f;
+
 	// 配置済みオブジェクトの描画（マップ上にアイコン表示）
-	// この部分はマウスキャプチャに関係なく常に描画
-	const auto& spawns = mapData.GetObjectSpawns();
-	for (size_t i = 0; i < spawns.size(); ++i) {
-		const auto& spawn = spawns[i];
+	// この部分はマウスキャプチャに関係なく常に描画。空間インデックスで画面内のものだけを見る
+	const Vector2 viewMin = camera.GetTopLeft();
+	const Vector2 viewMax = camera.GetBottomRight();
+	visibleSpawnIds_.clear();
+	mapData.QueryObjectSpawns(
+		{ viewMin.x - iconSize, viewMin.y - iconSize },
+		{ viewMax.x + iconSize, viewMax.y + iconSize },
+		visibleSpawnIds_);
+
+	for (ObjectSpawnId id : visibleSpawnIds_) {
+		const ObjectSpawnInfo& spawn = *mapData.FindObjectSpawn(id);
 
 		// ObjectRegistryから色を取得
 		const auto* objType = ObjectRegistry::GetObjectType(spawn.objectTypeId);
 		unsigned int baseColor = objType ? objType->color : 0x0000FFFF;
 
-		// アイコンサイズ（32x32ピクセル）
-		const float iconSize = 32.0f;
 		Vector2 iconWorldMin = { spawn.position.x - iconSize / 2.0f, spawn.position.y - iconSize / 2.0f };
 		Vector2 iconWorldMax = { spawn.position.x + iconSize / 2.0f, spawn.position.y + iconSize / 2.0f };
 
@@ -384,7 +442,7 @@ void MapChipEditor::HandleObjectMode(MapData& mapData, Camera2D& camera) {
 		Vector2 screenMax = camera.WorldToScreen(iconWorldMax);
 
 		// 選択中は黄色、それ以外はオブジェクトタイプの色
-		unsigned int color = (selectedObjectIndex_ == (int)i) ? 0xFFFF00FF : baseColor;
+		unsigned int color = IsObjectSelected(id) ? 0xFFFF00FF : baseColor;
 
 		Novice::DrawBox(
 			(int)screenMin.x, (int)screenMin.y,
@@ -393,42 +451,64 @@ void MapChipEditor::HandleObjectMode(MapData& mapData, Camera2D& camera) {
 		);
 
 		// 中心に小さい点
+		Vector2 screenCenter = camera.WorldToScreen(spawn.position);
 		Novice::DrawBox(
-			(int)camera.WorldToScreen(spawn.position).x - 2,
-			(int)camera.WorldToScreen(spawn.position).y - 2,
+			(int)screenCenter.x - 2,
+			(int)screenCenter.y - 2,
 			4, 4, 0.0f, color, kFillModeSolid
 		);
 	}
 
-	// --- ここから入力処理 ---
-	// マウスがImGuiウィンドウ上にある場合は入力処理をスキップ
-	if (ImGui::GetIO().WantCaptureMouse) return;
-
 	// マウス位置取得
 	int mouseX, mouseY;
 	Novice::GetMousePosition(&mouseX, &mouseY);
 	Vector2 worldPos = camera.ScreenToWorld({ (float)mouseX, (float)mouseY });
 
-	// 左クリック：オブジェクト配置
+	// 範囲選択中の枠
+	if (isBoxSelecting_) {
+		DrawSelectionRect_(camera, boxSelectStart_.x, boxSelectStart_.y, worldPos.x, worldPos.y, 0xFFFF0020, 0xFFFF00FF);
+	}
+
+	// --- ドラッグ・範囲選択の継続（ImGui 上に出ても離すまでは続ける） ---
+	if (isDraggingObject_) {
+		if (Novice::IsPressMouse(0) && selectedObjectIds_.size() == 1) {
+			mapData.UpdateObjectSpawnPosition(selectedObjectIds_.front(),
+				{ worldPos.x + objectDragOffset_.x, worldPos.y + objectDragOffset_.y });
+		}
+		else {
+			isDraggingObject_ = false;
+		}
+	}
+	if (isBoxSelecting_ && !Novice::IsPressMouse(0)) {
+		isBoxSelecting_ = false;
+		selectedObjectIds_.clear();
+		mapData.QueryObjectSpawns(boxSelectStart_, worldPos, selectedObjectIds_);
+	}
+
+	// --- ここから入力処理 ---
+	// マウスがImGuiウィンドウ上にある場合は入力処理をスキップ
+	if (ImGui::GetIO().WantCaptureMouse) return;
+
+	// 左クリック：選択・ドラッグ開始・範囲選択・オブジェクト配置
 	if (Novice::IsTriggerMouse(0)) {
-		// 既存のオブジェクトをクリックしたか判定
-		bool clickedExisting = false;
+		const bool isShiftPressed = Input().PressKey(DIK_LSHIFT) || Input().PressKey(DIK_RSHIFT);
 		const float clickRadius = 16.0f;
+		const ObjectSpawnId clickedId = mapData.PickObjectSpawn(worldPos, clickRadius);
 
-		for (size_t i = 0; i < spawns.size(); ++i) {
-			float dx = worldPos.x - spawns[i].position.x;
-			float dy = worldPos.y - spawns[i].position.y;
-			float distSq = dx * dx + dy * dy;
-
-			if (distSq < clickRadius * clickRadius) {
-				selectedObjectIndex_ = (int)i;
-				clickedExisting = true;
-				break;
-			}
+		if (isShiftPressed) {
+			// Shift+ドラッグで範囲選択
+			isBoxSelecting_ = true;
+			boxSelectStart_ = worldPos;
+		}
+		else if (clickedId != kInvalidObjectSpawnId) {
+			// 既存のオブジェクトをクリックしたら選択して、そのままドラッグで移動できるようにする
+			const Vector2& spawnPos = mapData.FindObjectSpawn(clickedId)->position;
+			selectedObjectIds_.assign(1, clickedId);
+			isDraggingObject_ = true;
+			objectDragOffset_ = { spawnPos.x - worldPos.x, spawnPos.y - worldPos.y };
 		}
-
 		// 既存をクリックしていなければ新規配置
-		if (!clickedExisting) {
+		else {
 			const auto* objType = ObjectRegistry::GetObjectType(selectedObjectTypeId_);
 			std::string tag = objType ? objType->tag : "";
 
@@ -436,11 +516,12 @@ void MapChipEditor::HandleObjectMode(MapData& mapData, Camera2D& camera) {
 			if (selectedObjectTypeId_ == 0 || selectedObjectTypeId_ == 100) {
 				// 既存の同じタイプを探す
 				bool alreadyExists = false;
-				for (size_t i = 0; i < spawns.size(); ++i) {
-					if (spawns[i].objectTypeId == selectedObjectTypeId_) {
+				for (const auto& spawn : mapData.GetObjectSpawns()) {
+					if (spawn.objectTypeId == selectedObjectTypeId_) {
 						// 既に存在する場合は位置を更新（移動）
-						mapData.UpdateObjectSpawnPosition(i, worldPos);
-						selectedObjectIndex_ = (int)i;
+						const ObjectSpawnId movedId = spawn.id;
+						mapData.UpdateObjectSpawnPosition(movedId, worldPos);
+						selectedObjectIds_.assign(1, movedId);
 						alreadyExists = true;
 						Novice::ConsolePrintf("[MapEditor] Moved %s to (%.1f, %.1f)\n",
 							objType->name.c_str(), worldPos.x, worldPos.y);
@@ -451,7 +532,7 @@ void MapChipEditor::HandleObjectMode(MapData& mapData, Camera2D& camera) {
 				// 存在しない場合は新規配置
 				if (!alreadyExists) {
 					mapData.AddObjectSpawn(selectedObjectTypeId_, worldPos, tag);
-					selectedObjectIndex_ = -1;
+					selectedObjectIds_.clear();
 					Novice::ConsolePrintf("[MapEditor] Placed %s at (%.1f, %.1f)\n",
 						objType->name.c_str(), worldPos.x, worldPos.y);
 				}
@@ -459,7 +540,7 @@ void MapChipEditor::HandleObjectMode(MapData& mapData, Camera2D& camera) {
 			// それ以外のオブジェクトは複数配置可能
 			else {
 				mapData.AddObjectSpawn(selectedObjectTypeId_, worldPos, tag);
-				selectedObjectIndex_ = -1;
+				selectedObjectIds_.clear();
 				Novice::ConsolePrintf("[MapEditor] Placed object type %d at (%.1f, %.1f)\n",
 					selectedObjectTypeId_, worldPos.x, worldPos.y);
 			}
@@ -468,13 +549,16 @@ void MapChipEditor::HandleObjectMode(MapData& mapData, Camera2D& camera) {
 
 	// 右クリック：選択解除
 	if (Novice::IsTriggerMouse(1)) {
-		selectedObjectIndex_ = -1;
+		selectedObjectIds_.clear();
 	}
 
-	// Deleteキー：選択中のオブジェクト削除
-	if (selectedObjectIndex_ >= 0 && Input().TriggerKey(DIK_DELETE)) {
-		mapData.RemoveObjectSpawn(selectedObjectIndex_);
-		selectedObjectIndex_ = -1;
+	// Deleteキー：選択中のオブジェクトをまとめて削除
+	if (!selectedObjectIds_.empty() && Input().TriggerKey(DIK_DELETE)) {
+		for (ObjectSpawnId id : selectedObjectIds_) {
+			mapData.RemoveObjectSpawn(id);
+		}
+		selectedObjectIds_.clear();
+		isDraggingObject_ = false;
 	}
 }
 
@@ -539,22 +623,15 @@ void MapChipEditor::HandleInput(MapData& mapData, Camera2D& camera) {
 		// 右クリック開始
 		if (Novice::IsTriggerMouse(1)) {
 			isRightDragging = true;
-			strokeCache_.clear();
+			ClearStroke();
 		}
 
 		// 右クリック中：消しゴムとして動作
 		if (Novice::IsPressMouse(1) && isRightDragging) {
 			int currentId = mapData.GetTile(col, row, currentLayer_);
 			if (currentId != TileID::Air) {
-				std::pair<int, int> key = { col, row };
-				if (strokeCache_.find(key) == strokeCache_.end()) {
-					strokeCache_[key] = currentId;
-				}
+				RecordStrokeCell(mapData, col, row, currentId);
 				mapData.SetTile(col, row, TileID::Air, currentLayer_);
-
-				if (mapManager_) {
-					mapManager_->OnTileChanged(col, row, currentLayer_);
-				}
 			}
 		}
 
@@ -575,7 +652,7 @@ void MapChipEditor::HandleInput(MapData& mapData, Camera2D& camera) {
 	// 左クリック開始
 	if (Novice::IsTriggerMouse(0) && isInside) {
 		isDragging_ = true;
-		strokeCache_.clear();
+		ClearStroke();
 
 		if (currentMode_ == ToolMode::Rectangle) {
 			dragStartCol_ = col;
@@ -593,15 +670,8 @@ void MapChipEditor::HandleInput(MapData& mapData, Camera2D& camera) {
 		if ((currentMode_ == ToolMode::Pen || currentMode_ == ToolMode::Eraser) && isInside) {
 			int currentId = mapData.GetTile(col, row, currentLayer_);
 			if (currentId != applyTileId) {
-				std::pair<int, int> key = { col, row };
-				if (strokeCache_.find(key) == strokeCache_.end()) {
-					strokeCache_[key] = currentId;
-				}
+				RecordStrokeCell(mapData, col, row, currentId);
 				mapData.SetTile(col, row, applyTileId, currentLayer_);
-
-				if (mapManager_) {
-					mapManager_->OnTileChanged(col, row, currentLayer_);
-				}
 			}
 		}
 	}
@@ -612,9 +682,6 @@ void MapChipEditor::HandleInput(MapData& mapData, Camera2D& camera) {
 
 		if (currentMode_ == ToolMode::Rectangle) {
 			ToolRectangleApply(mapData, col, row, applyTileId);
-			if (mapManager_) {
-				mapManager_->OnTileChanged(col, row, currentLayer_);
-			}
 		}
 
 		CommitStroke(mapData);
@@ -623,56 +690,49 @@ void MapChipEditor::HandleInput(MapData& mapData, Camera2D& camera) {
 }
 
 // バケツツール（塗りつぶしアルゴリズム）
+// 行単位のスキャンライン法：同じIDが続く区間を左右に広げて一気に塗り、
+// 上下の行から次の区間の起点を拾う。塗ったマスは targetId でなくなるので訪問済み判定は不要
 void MapChipEditor::ToolBucket(MapData& mapData, int startCol, int startRow, int newId) {
 	int targetId = mapData.GetTile(startCol, startRow, currentLayer_);
 	if (targetId == newId) return; // 同じ色なら何もしない
 
+	const auto* layerData = mapData.GetLayerData(currentLayer_);
+	if (!layerData) return;
+	const auto& tiles = *layerData;
+
 	int w = mapData.GetWidth();
 	int h = mapData.GetHeight();
 
-	// 幅優先探索(BFS)用のキュー
-	std::queue<std::pair<int, int>> q;
-	q.push({ startCol, startRow });
-
-	// 既に処理したかどうかのチェック用（無限ループ防止）
-	// strokeCache_ を訪問済みリストとして兼用する
-	std::pair<int, int> startKey = { startCol, startRow };
-	strokeCache_[startKey] = targetId;
-	mapData.SetTile(startCol, startRow, newId, currentLayer_);
-
-	// 4方向の移動量
-	const int dx[] = { 0, 0, -1, 1 };
-	const int dy[] = { -1, 1, 0, 0 };
-
-	while (!q.empty()) {
-		std::pair<int, int> current = q.front();
-		q.pop();
-
-		int cx = current.first;
-		int cy = current.second;
-
-		// 4方向をチェック
-		for (int i = 0; i < 4; ++i) {
-			int nx = cx + dx[i];
-			int ny = cy + dy[i];
-
-			// 範囲内かつ、塗りつぶし対象の色か？
-			if (nx >= 0 && nx < w && ny >= 0 && ny < h) {
-				int nId = mapData.GetTile(nx, ny, currentLayer_);
-				if (nId == targetId) {
-					// まだキャッシュにない（未訪問）なら処理
-					std::pair<int, int> nKey = { nx, ny };
-					if (strokeCache_.find(nKey) == strokeCache_.end()) {
-						strokeCache_[nKey] = targetId; // 元の色を記録
-						mapData.SetTile(nx, ny, newId, currentLayer_); // 塗る
-
-						// MapManagerへの通知
-						if (mapManager_) {
-							mapManager_->OnTileChanged(nx, ny, currentLayer_);
-						}
-
-						q.push({ nx, ny }); // 次の探索へ
-					}
+	// 区間の起点（列, 行）
+	std::vector<std::pair<int, int>> stack;
+	stack.push_back({ startCol, startRow });
+
+	while (!stack.empty()) {
+		auto [x, y] = stack.back();
+		stack.pop_back();
+
+		// 既に別の区間で塗られていたら飛ばす
+		if (tiles[y][x] != targetId) continue;
+
+		// 左右に広げる
+		int left = x;
+		while (left > 0 && tiles[y][left - 1] == targetId) --left;
+		int right = x;
+		while (right < w - 1 && tiles[y][right + 1] == targetId) ++right;
+
+		// 区間をまとめて塗り、そのまま Undo 用のランとして記録
+		int length = right - left + 1;
+		mapData.FillRun(left, y, length, newId, currentLayer_);
+		strokeRuns_.push_back({ left, y, length, targetId, newId, currentLayer_ });
+
+		// 上下の行で targetId が始まる位置を次の起点にする
+		for (int ny : { y - 1, y + 1 }) {
+			if (ny < 0 || ny >= h) continue;
+
+			const auto& rowTiles = tiles[ny];
+			for (int nx = left; nx <= right; ++nx) {
+				if (rowTiles[nx] == targetId && (nx == left || rowTiles[nx - 1] != targetId)) {
+					stack.push_back({ nx, ny });
 				}
 			}
 		}
@@ -736,47 +796,88 @@ void MapChipEditor::ToolRectangleApply(MapData& mapData, int endCol, int endRow,
 	maxY = (maxY >= mapData.GetHeight()) ? mapData.GetHeight() - 1 : maxY;
 
 	for (int y = minY; y <= maxY; ++y) {
-		for (int x = minX; x <= maxX; ++x) {
-			int currentId = mapData.GetTile(x, y, currentLayer_);
-			if (currentId != applyTileId) {
-				std::pair<int, int> key = { x, y };
-				if (strokeCache_.find(key) == strokeCache_.end()) {
-					strokeCache_[key] = currentId;
-				}
-				mapData.SetTile(x, y, applyTileId, currentLayer_);
-
-				if (mapManager_) {
-					mapManager_->OnTileChanged(x, y, currentLayer_);
-				}
+		// 元のIDが同じ間はまとめて1つのランとして記録する
+		int x = minX;
+		while (x <= maxX) {
+			int prevId = mapData.GetTile(x, y, currentLayer_);
+			int runStart = x;
+			while (x <= maxX && mapData.GetTile(x, y, currentLayer_) == prevId) ++x;
+
+			// 既に同じIDの区間は書き込まない（変わらない行を変更済みにしない）
+			if (prevId != applyTileId) {
+				strokeRuns_.push_back({ runStart, y, x - runStart, prevId, applyTileId, currentLayer_ });
+				mapData.FillRun(runStart, y, x - runStart, applyTileId, currentLayer_);
 			}
 		}
 	}
 }
 
 void MapChipEditor::CommitStroke(MapData& mapData) {
-	if (strokeCache_.empty()) return;
+	if (strokeLogs_.empty() && strokeRuns_.empty()) return;
 
 	EditCommand cmd;
-	// キャッシュの内容をコマンドに変換
-	for (auto const& [pos, prevId] : strokeCache_) {
-		int col = pos.first;
-		int row = pos.second;
-		int currentId = mapData.GetTile(col, row, currentLayer_); // 今（書き換え後）のID
+
+	// バケツ・矩形はまとめ済みのランをそのまま使う
+	cmd.runs = std::move(strokeRuns_);
+
+	// ペン・消しゴムは行・列順に並べ、同じ行で隣り合う同じ変更を1つのランにまとめる
+	std::sort(strokeLogs_.begin(), strokeLogs_.end(), [](const TileChangeLog& a, const TileChangeLog& b) {
+		return a.row != b.row ? a.row < b.row : a.col < b.col;
+	});
+
+	const size_t firstLogRun = cmd.runs.size();
+	for (const TileChangeLog& log : strokeLogs_) {
+		int currentId = mapData.GetTile(log.col, log.row, currentLayer_); // 今（書き換え後）のID
 
 		// 実際に値が変わったものだけ記録
-		if (prevId != currentId) {
-			cmd.logs.push_back({ col, row, prevId, currentId, currentLayer_ });
+		if (log.prevId == currentId) continue;
+
+		if (cmd.runs.size() > firstLogRun) {
+			TileChangeRun& last = cmd.runs.back();
+			if (last.row == log.row && last.col + last.length == log.col &&
+				last.prevId == log.prevId && last.newId == currentId) {
+				last.length++;
+				continue;
+			}
 		}
+		cmd.runs.push_back({ log.col, log.row, 1, log.prevId, currentId, currentLayer_ });
 	}
 
-	if (!cmd.logs.empty()) {
-		undoStack_.push_back(cmd);
+	if (!cmd.runs.empty()) {
+		undoStack_.push_back(std::move(cmd));
 
 		// 新しい操作をしたのでRedoスタックは無効になる
 		redoStack_.clear();
 	}
 
-	strokeCache_.clear();
+	ClearStroke();
+}
+
+void MapChipEditor::RecordStrokeCell(const MapData& mapData, int col, int row, int prevId) {
+	const size_t cellCount = static_cast<size_t>(mapData.GetWidth()) * mapData.GetHeight();
+	const size_t wordCount = (cellCount + 63) / 64;
+	if (strokeMask_.size() != wordCount || strokeMaskWidth_ != mapData.GetWidth()) {
+		strokeMask_.assign(wordCount, 0);
+		strokeMaskWidth_ = mapData.GetWidth();
+	}
+
+	const size_t index = static_cast<size_t>(row) * mapData.GetWidth() + col;
+	uint64_t& word = strokeMask_[index / 64];
+	const uint64_t bit = uint64_t(1) << (index % 64);
+	if (word & bit) return; // このストロークで既に記録済み
+
+	word |= bit;
+	strokeLogs_.push_back({ col, row, prevId });
+}
+
+void MapChipEditor::ClearStroke() {
+	// 立てたビットだけ戻す（マップ全体を0埋めしない）
+	for (const TileChangeLog& log : strokeLogs_) {
+		const size_t index = static_cast<size_t>(log.row) * strokeMaskWidth_ + log.col;
+		strokeMask_[index / 64] &= ~(uint64_t(1) << (index % 64));
+	}
+	strokeLogs_.clear();
+	strokeRuns_.clear();
 }
 
 // ヘルパー関数の実装
@@ -808,33 +909,31 @@ void MapChipEditor::ExecuteUndo(MapData& mapData) {
 	if (undoStack_.empty()) return;
 
 	// 最新のコマンドを取り出す
-	EditCommand cmd = undoStack_.back();
+	EditCommand cmd = std::move(undoStack_.back());
 	undoStack_.pop_back();
 
-	// 変更を「元に戻す（prevIdにする）」
-	for (const auto& log : cmd.logs) {
-		mapData.SetTile(log.col, log.row, log.prevId, log.layer);
-		mapManager_->OnTileChanged(log.col, log.row, log.layer);
+	// 変更を「元に戻す（prevIdにする）」（記録と逆順に戻す）
+	for (auto it = cmd.runs.rbegin(); it != cmd.runs.rend(); ++it) {
+		mapData.FillRun(it->col, it->row, it->length, it->prevId, it->layer);
 	}
 
 	// Redoスタックに積む
-	redoStack_.push_back(cmd);
+	redoStack_.push_back(std::move(cmd));
 }
 
 void MapChipEditor::ExecuteRedo(MapData& mapData) {
 	if (redoStack_.empty()) return;
 
 	// 最新のRedoコマンドを取り出す
-	EditCommand cmd = redoStack_.back();
+	EditCommand cmd = std::move(redoStack_.back());
 	redoStack_.pop_back();
 
 	// 変更を「やり直す（newIdにする）」
-	for (const auto& log : cmd.logs) {
-		mapData.SetTile(log.col, log.row, log.newId, log.layer);
-		mapManager_->OnTileChanged(log.col, log.row, log.layer);
+	for (const auto& run : cmd.runs) {
+		mapData.FillRun(run.col, run.row, run.length, run.newId, run.layer);
 	}
 
 	// Undoスタックに戻す
-	undoStack_.push_back(cmd);
+	undoStack_.push_back(std::move(cmd));
 }
 #endif // _DEBUG
\ No newline at end of file
@@ -3,8 +3,8 @@
 #include "Camera2D.h"
 #include "TileRegistry.h"
 #include <Novice.h>
+#include <cstdint>
 #include <vector>
-#include <map>
 #include "MapManager.h"
 
 #ifdef _DEBUG
@@ -12,11 +12,19 @@
 #endif // _DEBUG
 
 
-// 1マスの変更履歴
+// 1マスの変更履歴（ストローク中の記録用）
 struct TileChangeLog {
     int col;
     int row;
     int prevId;
+};
+
+// 同じ行で連続するマスの変更をまとめた履歴（ランレングス）
+struct TileChangeRun {
+    int col;     // 開始列
+    int row;
+    int length;
+    int prevId;
     int newId;
     TileLayer layer;
 };
@@ -32,7 +40,7 @@ enum class ToolMode {
 
 // 1回のアクション（一筆書き）をまとめたコマンド
 struct EditCommand {
-    std::vector<TileChangeLog> logs;
+    std::vector<TileChangeRun> runs;
 };
 
 class MapChipEditor {
@@ -65,14 +73,27 @@ private:
 
     // オブジェクトモード用
     int selectedObjectTypeId_ = 100;  // デフォルト: PlayerStart
-    int selectedObjectIndex_ = -1;    // 選択中のオブジェクトインデックス（-1=未選択）
+    std::vector<ObjectSpawnId> selectedObjectIds_; // 選択中のスポーン（空=未選択）
+    bool isDraggingObject_ = false;   // 選択中のスポーンをドラッグ移動中
+    Vector2 objectDragOffset_ = { 0.0f, 0.0f };
+    bool isBoxSelecting_ = false;     // Shift+ドラッグの範囲選択中
+    Vector2 boxSelectStart_ = { 0.0f, 0.0f };
+    std::vector<ObjectSpawnId> visibleSpawnIds_; // 画面内のスポーン（毎フレーム使い回す）
 
     // Undo / Redo用
     std::vector<EditCommand> undoStack_;
     std::vector<EditCommand> redoStack_;
-    std::map<std::pair<int, int>, int> strokeCache_;
     bool isDragging_ = false;
 
+    // ストローク中の変更記録
+    std::vector<TileChangeLog> strokeLogs_;    // ペン・消しゴム（1マスずつ）
+    std::vector<TileChangeRun> strokeRuns_;    // バケツ・矩形（行ごとにまとめ済み）
+    std::vector<uint64_t> strokeMask_;         // 記録済みのマス（1マス1ビット）
+    int strokeMaskWidth_ = 0;
+
+    // 保存でメインスレッドが止まった時間（表示用）
+    float lastSaveMs_ = 0.0f;
+
     // 矩形ツール用
     int dragStartCol_ = -1;
     int dragStartRow_ = -1;
@@ -82,11 +103,16 @@ private:
     void HandleObjectMode(MapData& mapData, Camera2D& camera);
     void DrawObjectPalette();
     void DrawObjectList(MapData& mapData);
+    bool IsObjectSelected(ObjectSpawnId id) const;
 
     void ExecuteUndo(MapData& mapData);
     void ExecuteRedo(MapData& mapData);
     void CommitStroke(MapData& mapData);
 
+    // ストロークで初めて触れたマスなら元のIDを記録する
+    void RecordStrokeCell(const MapData& mapData, int col, int row, int prevId);
+    void ClearStroke();
+
     // レイヤーを変更する関数、モードチェンジに呼び出す
     void ChangeLayer(TileLayer newLayer);
 
@@ -1,4 +1,9 @@
 ﻿#include "MapData.h"
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include "AsyncIO.h"
+#include "MapFileParser.h"
 
 MapData::MapData() {
     Reset(kMapChipWidth, kMapChipHeight);
@@ -16,86 +21,400 @@ void MapData::Reset(int width, int height, float tileSize) {
     tilesBlock_.assign(height_, std::vector<int>(width_, 0));
 
     // オブジェクトスポーン情報をクリア
-    objectSpawns_.clear();
+    ClearObjectSpawns();
+
+    MarkAllDirty();
+}
+
+namespace {
+    bool IsSameSpawn(const ObjectSpawnInfo& a, const ObjectSpawnInfo& b) {
+        return a.objectTypeId == b.objectTypeId &&
+            a.position.x == b.position.x && a.position.y == b.position.y &&
+            a.tag == b.tag && a.customData == b.customData;
+    }
 }
 
 bool MapData::Load(const std::string& filePath) {
-    json j;
-    if (!JsonUtil::LoadFromFile(filePath, j)) {
+    MapFileContent content;
+    if (!ReadContent(filePath, content)) {
         Novice::ConsolePrintf("[MapData] Failed to load: %s\n", filePath.c_str());
         return false;
     }
 
-    try {
-        width_ = JsonUtil::GetValue<int>(j, "width", kMapChipWidth);
-        height_ = JsonUtil::GetValue<int>(j, "height", kMapChipHeight);
-        tileSize_ = JsonUtil::GetValue<float>(j, "tileSize", 64.0f);
+    ApplyContent(std::move(content));
+    return true;
+}
 
-        // 配列リセット（全レイヤーを初期化）
-        Reset(width_, height_, tileSize_);
+void MapData::ParseAsync(const std::string& filePath, std::function<void(bool, MapFileContent&)> onParsed) {
+    struct Result {
+        bool isSuccess = false;
+        MapFileContent content;
+    };
+    auto result = std::make_shared<Result>();
 
-        // タイルレイヤー読み込み
-        if (j.contains("layers")) {
-            auto& layers = j["layers"];
+    // 読み込み・解析までワーカーで行う（MapData 自体には触らない）
+    AsyncIO::GetInstance().Submit(
+        [filePath, result]() {
+            result->isSuccess = ReadContent(filePath, result->content);
+        },
+        [result, onParsed = std::move(onParsed)]() {
+            onParsed(result->isSuccess, result->content);
+        });
+}
 
-            if (layers.contains("background")) {
-                tilesBackground_ = layers["background"].get<std::vector<std::vector<int>>>();
-            }
-			if (layers.contains("backgroundDecoration")) {
-                tilesBackgroundDecoration_ = layers["backgroundDecoration"].get<std::vector<std::vector<int>>>();
-            }
-            if (layers.contains("decoration")) {
-                tilesDecoration_ = layers["decoration"].get<std::vector<std::vector<int>>>();
-            }
-            if (layers.contains("block")) {
-                tilesBlock_ = layers["block"].get<std::vector<std::vector<int>>>();
-            }
+void MapData::LoadAsync(const std::string& filePath, std::function<void(bool)> onLoaded) {
+    ParseAsync(filePath, [this, filePath, onLoaded = std::move(onLoaded)](bool isSuccess, MapFileContent& content) {
+        if (isSuccess) {
+            ApplyContent(std::move(content));
         }
-        // 互換性: 古い形式
-        else if (j.contains("tiles")) {
-            tilesBlock_ = j["tiles"].get<std::vector<std::vector<int>>>();
-        }
-
-        // オブジェクトスポーン情報読み込み
-        objectSpawns_.clear();
-        if (j.contains("objects")) {
-            for (auto& obj : j["objects"]) {
-                ObjectSpawnInfo spawn;
-                spawn.objectTypeId = obj["type"];
-                spawn.position.x = obj["position"]["x"];
-                spawn.position.y = obj["position"]["y"];
-                spawn.tag = obj.value("tag", "");
-                spawn.customData = obj.value("data", json::object());
-                objectSpawns_.push_back(spawn);
-            }
-            Novice::ConsolePrintf("[MapData] Loaded %d object spawns\n", (int)objectSpawns_.size());
+        else {
+            Novice::ConsolePrintf("[MapData] Failed to load: %s\n", filePath.c_str());
+        }
+        if (onLoaded) {
+            onLoaded(isSuccess);
         }
+    });
+}
 
-        Novice::ConsolePrintf("[MapData] Loaded map: %dx%d\n", width_, height_);
-        return true;
-    }
-    catch (const std::exception& e) {
-        Novice::ConsolePrintf("[MapData] Parse error: %s\n", e.what());
+void MapData::ReloadAsync(const std::string& filePath, std::function<void(const MapReloadResult&)> onReloaded) {
+    ParseAsync(filePath, [this, filePath, onReloaded = std::move(onReloaded)](bool isSuccess, MapFileContent& content) {
+        MapReloadResult result;
+        if (isSuccess) {
+            result = ApplyContentDiff(std::move(content));
+        }
+        else {
+            Novice::ConsolePrintf("[MapData] Failed to reload: %s\n", filePath.c_str());
+        }
+        if (onReloaded) {
+            onReloaded(result);
+        }
+    });
+}
+
+bool MapData::ReadContent(const std::string& filePath, MapFileContent& out) {
+    // タイルは DOM を作らずに直接配列へ読み込む（ワーカースレッドからも呼ぶのでログは出さない）
+    if (!MapFileParser::ParseFile(filePath, out)) {
         return false;
     }
+
+    // 幅・高さが書かれていない場合は既定値
+    if (out.width <= 0) out.width = kMapChipWidth;
+    if (out.height <= 0) out.height = kMapChipHeight;
+
+    // ファイルに無いレイヤーは0で埋める
+    for (auto& layer : out.layers) {
+        if (layer.empty()) {
+            layer.assign(out.height, std::vector<int>(out.width, 0));
+        }
+    }
+    return true;
+}
+
+void MapData::ApplyContent(MapFileContent&& content) {
+    static_assert(std::tuple_size<decltype(content.layers)>::value == kTileLayerCount, "MapFileContent::layers must match kTileLayerCount");
+
+    width_ = content.width;
+    height_ = content.height;
+    tileSize_ = content.tileSize;
+
+    for (int layerIndex = 0; layerIndex < kTileLayerCount; ++layerIndex) {
+        *GetLayerDataMutable(static_cast<TileLayer>(layerIndex)) = std::move(content.layers[layerIndex]);
+    }
+
+    // レイヤーを丸ごと差し替えたので、キャッシュ類を作り直す
+    MarkAllDirty();
+
+    objectSpawns_ = std::move(content.objectSpawns);
+    RebuildObjectSpawnIndex();
+    if (!objectSpawns_.empty()) {
+        Novice::ConsolePrintf("[MapData] Loaded %d object spawns\n", (int)objectSpawns_.size());
+    }
+
+    Novice::ConsolePrintf("[MapData] Loaded map: %dx%d\n", width_, height_);
+#ifdef _DEBUG
+    hasUnsavedChanges_ = false;
+#endif
+}
+
+MapReloadResult MapData::ApplyContentDiff(MapFileContent&& content) {
+    MapReloadResult result;
+    result.isApplied = true;
+
+    // サイズが変わった場合は差分を取れないので丸ごと差し替える
+    bool isSameSize = content.width == width_ && content.height == height_ && content.tileSize == tileSize_;
+    for (int layerIndex = 0; isSameSize && layerIndex < kTileLayerCount; ++layerIndex) {
+        const auto& rows = content.layers[layerIndex];
+        isSameSize = static_cast<int>(rows.size()) == height_ &&
+            std::all_of(rows.begin(), rows.end(), [this](const std::vector<int>& row) { return static_cast<int>(row.size()) == width_; });
+    }
+    if (!isSameSize) {
+        ApplyContent(std::move(content));
+        result.isFullReload = true;
+        result.hasSpawnChanges = true;
+        return result;
+    }
+
+    // 行単位で比べ、変わった行だけ差し替えて変更範囲をチャンクに記録する
+    const size_t dirtyBefore = dirtyChunks_.size();
+    for (int layerIndex = 0; layerIndex < kTileLayerCount; ++layerIndex) {
+        const TileLayer layer = static_cast<TileLayer>(layerIndex);
+        auto& rows = *GetLayerDataMutable(layer);
+        auto& newRows = content.layers[layerIndex];
+
+        for (int y = 0; y < height_; ++y) {
+            if (rows[y] == newRows[y]) continue;
+
+            auto first = std::mismatch(rows[y].begin(), rows[y].end(), newRows[y].begin());
+            auto last = std::mismatch(rows[y].rbegin(), rows[y].rend(), newRows[y].rbegin());
+            const int colBegin = static_cast<int>(first.first - rows[y].begin());
+            const int colEnd = width_ - static_cast<int>(last.first - rows[y].rbegin());
+
+            rows[y].swap(newRows[y]);
+            MarkDirty(colBegin, colEnd, y, layer);
+            ++result.changedRows;
+        }
+    }
+    result.changedChunks = static_cast<int>(dirtyChunks_.size() - dirtyBefore);
+
+    // スポーン情報は件数が少ないので、1つでも違えば丸ごと差し替える
+    result.hasSpawnChanges = content.objectSpawns.size() != objectSpawns_.size() ||
+        !std::equal(objectSpawns_.begin(), objectSpawns_.end(), content.objectSpawns.begin(), IsSameSpawn);
+    if (result.hasSpawnChanges) {
+        objectSpawns_ = std::move(content.objectSpawns);
+        RebuildObjectSpawnIndex();
+    }
+
+#ifdef _DEBUG
+    // ファイルの内容と一致したので未保存扱いにはしない
+    hasUnsavedChanges_ = false;
+#endif
+    return result;
 }
 
 #ifdef _DEBUG
+namespace {
+    // 保存時のレイヤー順（ファイル上の並び）
+    struct SaveLayer {
+        const char* name;
+        TileLayer layer;
+    };
+    constexpr SaveLayer kSaveLayers[] = {
+        { "background", TileLayer::Background },
+        { "backgroundDecoration", TileLayer::BackgroundDecoration },
+        { "decoration", TileLayer::Decoration },
+        { "block", TileLayer::Block },
+    };
+
+    void AppendInt(std::string& out, int value) {
+        char buffer[16];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        out.append(buffer, result.ptr);
+    }
+
+    // 1行分を "[1,0,0]" の形で書き出す
+    void BuildRowText(const std::vector<int>& row, std::string& out) {
+        out.clear();
+        out.reserve(row.size() * 2 + 2);
+        out.push_back('[');
+
+        for (size_t x = 0; x < row.size(); ++x) {
+            if (x > 0) out.push_back(',');
+            AppendInt(out, row[x]);
+        }
+        out.push_back(']');
+    }
+
+    // 1行分を "[0,12,3,4]"（ID, 個数 の繰り返し）の形で書き出す
+    void BuildRleRowText(const std::vector<int>& row, std::string& out) {
+        out.clear();
+        out.push_back('[');
+
+        for (size_t x = 0; x < row.size();) {
+            size_t runEnd = x + 1;
+            while (runEnd < row.size() && row[runEnd] == row[x]) ++runEnd;
+
+            if (x > 0) out.push_back(',');
+            AppendInt(out, row[x]);
+            out.push_back(',');
+            AppendInt(out, static_cast<int>(runEnd - x));
+            x = runEnd;
+        }
+        out.push_back(']');
+    }
+
+    // 1行分の0以外のマスを "[x,y,id],[x,y,id]" の形で書き出す（無ければ空文字列）
+    void BuildSparseRowText(const std::vector<int>& row, int y, std::string& out) {
+        out.clear();
+
+        for (size_t x = 0; x < row.size(); ++x) {
+            if (row[x] == 0) continue;
+
+            if (!out.empty()) out.push_back(',');
+            out.push_back('[');
+            AppendInt(out, static_cast<int>(x));
+            out.push_back(',');
+            AppendInt(out, y);
+            out.push_back(',');
+            AppendInt(out, row[x]);
+            out.push_back(']');
+        }
+    }
+}
+
 bool MapData::Save(const std::string& filePath) {
-    json j;
-    JsonUtil::SetValue(j, "width", width_);
-    JsonUtil::SetValue(j, "height", height_);
-    JsonUtil::SetValue(j, "tileSize", tileSize_);
-
-    // タイルレイヤーを保存
-    j["layers"]["background"] = tilesBackground_;
-	j["layers"]["backgroundDecoration"] = tilesBackgroundDecoration_;
-    j["layers"]["decoration"] = tilesDecoration_;
-    j["layers"]["block"] = tilesBlock_;
-
-    // オブジェクトスポーン情報を保存
-    json objectsArray = json::array();
-    for (auto& spawn : objectSpawns_) {
+    std::string text;
+    int rebuiltRows = 0;
+    BuildSaveText(text, rebuiltRows);
+
+    std::ofstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        Novice::ConsolePrintf("[MapData] Failed to open for writing: %s\n", filePath.c_str());
+        return false;
+    }
+    file.write(text.data(), static_cast<std::streamsize>(text.size()));
+    if (!file) {
+        Novice::ConsolePrintf("[MapData] Write error: %s\n", filePath.c_str());
+        return false;
+    }
+
+    hasUnsavedChanges_ = false;
+    Novice::ConsolePrintf("[MapData] Saved map: %s (rebuilt rows: %d)\n", filePath.c_str(), rebuiltRows);
+    return true;
+}
+
+void MapData::SaveAsync(const std::string& filePath, std::function<void(bool)> onSaved) {
+    // 文字列化は行キャッシュがあるのでメインスレッドで済ませ、ディスク書き込みだけをワーカーに回す
+    std::string text;
+    int rebuiltRows = 0;
+    BuildSaveText(text, rebuiltRows);
+
+    // この時点の内容を保存したことにする（書き込み中の編集は再び未保存になる）
+    hasUnsavedChanges_ = false;
+    ++saveRequestCount_;
+
+    AsyncIO::GetInstance().WriteText(filePath, std::move(text),
+        [this, filePath, rebuiltRows, onSaved = std::move(onSaved)](bool isSuccess) {
+            if (isSuccess) {
+                Novice::ConsolePrintf("[MapData] Saved map: %s (rebuilt rows: %d)\n", filePath.c_str(), rebuiltRows);
+            }
+            else {
+                hasUnsavedChanges_ = true;
+                Novice::ConsolePrintf("[MapData] Write error: %s\n", filePath.c_str());
+            }
+            --saveRequestCount_;
+            if (onSaved) {
+                onSaved(isSuccess);
+            }
+        });
+}
+
+TileLayerEncoding MapData::ChooseEncoding(const std::vector<std::vector<int>>& rows) const {
+    if (saveEncoding_ != TileLayerEncoding::Auto) {
+        return saveEncoding_;
+    }
+
+    // 1マス・1ラン・1タイルあたりのおおよその文字数で見積もる
+    size_t cellCount = 0;
+    size_t runCount = 0;
+    size_t nonZeroCount = 0;
+    for (const auto& row : rows) {
+        cellCount += row.size();
+        for (size_t x = 0; x < row.size(); ++x) {
+            if (x == 0 || row[x] != row[x - 1]) ++runCount;
+            if (row[x] != 0) ++nonZeroCount;
+        }
+    }
+
+    const size_t denseSize = cellCount * 2;
+    const size_t rleSize = runCount * 6;
+    const size_t sparseSize = nonZeroCount * 14;
+    if (sparseSize <= rleSize && sparseSize <= denseSize) return TileLayerEncoding::Sparse;
+    if (rleSize <= denseSize) return TileLayerEncoding::Rle;
+    return TileLayerEncoding::Dense;
+}
+
+void MapData::BuildSaveText(std::string& text, int& rebuiltRows) {
+    // JSON の DOM を作らず、レイヤーごとに選んだ書き方で直接書き出す
+    text.clear();
+    text.reserve(static_cast<size_t>(width_) * height_ * kTileLayerCount * 2 + 1024);
+
+    text += "{\n";
+    text += " \"width\": " + std::to_string(width_) + ",\n";
+    text += " \"height\": " + std::to_string(height_) + ",\n";
+    text += " \"tileSize\": " + json(tileSize_).dump() + ",\n";
+    text += " \"layers\": {\n";
+
+    rebuiltRows = 0;
+    bool firstLayer = true;
+    for (const SaveLayer& saveLayer : kSaveLayers) {
+        const auto& rows = *GetLayerData(saveLayer.layer);
+        const int layerIndex = static_cast<int>(saveLayer.layer);
+        auto& cache = rowTextCache_[layerIndex];
+        auto& valid = rowTextValid_[layerIndex];
+
+        // ファイルの行数が width/height と食い違っていた場合や、書き方が変わった場合は作り直す
+        const TileLayerEncoding encoding = ChooseEncoding(rows);
+        if (cache.size() != rows.size() || rowTextEncoding_[layerIndex] != encoding) {
+            cache.resize(rows.size());
+            valid.assign(rows.size(), 0);
+            rowTextEncoding_[layerIndex] = encoding;
+        }
+
+        if (!firstLayer) text += ",\n";
+        firstLayer = false;
+
+        text += "  \"";
+        text += saveLayer.name;
+        switch (encoding) {
+        case TileLayerEncoding::Rle:
+            text += "\": { \"encoding\": \"rle\", \"rows\": [\n";
+            break;
+        case TileLayerEncoding::Sparse:
+            text += "\": { \"encoding\": \"sparse\", \"tiles\": [\n";
+            break;
+        default:
+            text += "\": [\n";
+            break;
+        }
+
+        bool isFirstLine = true;
+        for (size_t y = 0; y < rows.size(); ++y) {
+            // 変更のあった行だけ文字列を作り直す
+            if (!valid[y]) {
+                switch (encoding) {
+                case TileLayerEncoding::Rle:
+                    BuildRleRowText(rows[y], cache[y]);
+                    break;
+                case TileLayerEncoding::Sparse:
+                    BuildSparseRowText(rows[y], static_cast<int>(y), cache[y]);
+                    break;
+                default:
+                    BuildRowText(rows[y], cache[y]);
+                    break;
+                }
+                valid[y] = 1;
+                ++rebuiltRows;
+            }
+
+            // 疎な書き方ではタイルの無い行は出力しない（1行1行なので差分も行単位で出る）
+            if (cache[y].empty()) continue;
+
+            if (!isFirstLine) text += ",\n";
+            isFirstLine = false;
+            text += "   ";
+            text += cache[y];
+        }
+        if (!isFirstLine) text += "\n";
+
+        text += (encoding == TileLayerEncoding::Dense) ? "  ]" : "  ] }";
+    }
+
+    text += "\n },\n";
+
+    // オブジェクトスポーン情報（件数が少ないので毎回作る）
+    text += " \"objects\": [\n";
+    for (size_t i = 0; i < objectSpawns_.size(); ++i) {
+        const ObjectSpawnInfo& spawn = objectSpawns_[i];
         json obj;
         obj["type"] = spawn.objectTypeId;
         obj["position"]["x"] = spawn.position.x;
@@ -106,33 +425,108 @@ bool MapData::Save(const std::string& filePath) {
         if (!spawn.customData.empty()) {
             obj["data"] = spawn.customData;
         }
-        objectsArray.push_back(obj);
-    }
-    j["objects"] = objectsArray;
 
-    // コンパクトフォーマットで保存
-    return JsonUtil::SaveMapCompact(filePath, j);
+        text += "  " + obj.dump();
+        if (i < objectSpawns_.size() - 1) text += ",";
+        text += "\n";
+    }
+    text += " ]\n";
+    text += "}\n";
 }
 #endif
 
-void MapData::AddObjectSpawn(int typeId, const Vector2& position, const std::string& tag, const json& customData) {
+ObjectSpawnId MapData::AddObjectSpawn(int typeId, const Vector2& position, const std::string& tag, const json& customData) {
     ObjectSpawnInfo spawn;
     spawn.objectTypeId = typeId;
     spawn.position = position;
     spawn.tag = tag;
     spawn.customData = customData;
+    spawn.id = nextSpawnId_++;
+
+    spawnIndexById_[spawn.id] = objectSpawns_.size();
+    spawnGrid_.Insert(spawn.id, spawn.position);
     objectSpawns_.push_back(spawn);
+    return spawn.id;
 }
 
-void MapData::RemoveObjectSpawn(size_t index) {
-    if (index < objectSpawns_.size()) {
-        objectSpawns_.erase(objectSpawns_.begin() + index);
+void MapData::RemoveObjectSpawn(ObjectSpawnId id) {
+    auto it = spawnIndexById_.find(id);
+    if (it == spawnIndexById_.end()) return;
+
+    const size_t index = it->second;
+    spawnGrid_.Remove(id, objectSpawns_[index].position);
+    spawnIndexById_.erase(it);
+
+    // ファイル上の並びを保つため詰めて消し、後ろの添字だけずらす（編集操作でしか呼ばれない）
+    objectSpawns_.erase(objectSpawns_.begin() + index);
+    for (size_t i = index; i < objectSpawns_.size(); ++i) {
+        spawnIndexById_[objectSpawns_[i].id] = i;
     }
 }
 
-void MapData::UpdateObjectSpawnPosition(size_t index, const Vector2& newPosition) {
-    if (index < objectSpawns_.size()) {
-        objectSpawns_[index].position = newPosition;
+void MapData::UpdateObjectSpawnPosition(ObjectSpawnId id, const Vector2& newPosition) {
+    auto it = spawnIndexById_.find(id);
+    if (it == spawnIndexById_.end()) return;
+
+    ObjectSpawnInfo& spawn = objectSpawns_[it->second];
+    spawnGrid_.Move(id, spawn.position, newPosition);
+    spawn.position = newPosition;
+}
+
+void MapData::ClearObjectSpawns() {
+    objectSpawns_.clear();
+    spawnIndexById_.clear();
+    spawnGrid_.Clear();
+}
+
+const ObjectSpawnInfo* MapData::FindObjectSpawn(ObjectSpawnId id) const {
+    auto it = spawnIndexById_.find(id);
+    return it != spawnIndexById_.end() ? &objectSpawns_[it->second] : nullptr;
+}
+
+ObjectSpawnId MapData::PickObjectSpawn(const Vector2& position, float radius) const {
+    std::vector<ObjectSpawnId> candidates;
+    spawnGrid_.QueryCells({ position.x - radius, position.y - radius }, { position.x + radius, position.y + radius }, candidates);
+
+    ObjectSpawnId nearestId = kInvalidObjectSpawnId;
+    float nearestDistSq = radius * radius;
+    for (ObjectSpawnId id : candidates) {
+        const Vector2& spawnPos = FindObjectSpawn(id)->position;
+        const float dx = position.x - spawnPos.x;
+        const float dy = position.y - spawnPos.y;
+        const float distSq = dx * dx + dy * dy;
+        if (distSq < nearestDistSq) {
+            nearestDistSq = distSq;
+            nearestId = id;
+        }
+    }
+    return nearestId;
+}
+
+void MapData::QueryObjectSpawns(const Vector2& min, const Vector2& max, std::vector<ObjectSpawnId>& out) const {
+    const size_t begin = out.size();
+    spawnGrid_.QueryCells(min, max, out);
+
+    // セル単位で集めたものを矩形内だけに絞る
+    const float minX = (std::min)(min.x, max.x);
+    const float maxX = (std::max)(min.x, max.x);
+    const float minY = (std::min)(min.y, max.y);
+    const float maxY = (std::max)(min.y, max.y);
+    auto last = std::remove_if(out.begin() + begin, out.end(), [&](ObjectSpawnId id) {
+        const Vector2& spawnPos = FindObjectSpawn(id)->position;
+        return spawnPos.x < minX || spawnPos.x > maxX || spawnPos.y < minY || spawnPos.y > maxY;
+    });
+    out.erase(last, out.end());
+}
+
+void MapData::RebuildObjectSpawnIndex() {
+    spawnIndexById_.clear();
+    spawnGrid_.Clear();
+    for (size_t i = 0; i < objectSpawns_.size(); ++i) {
+        ObjectSpawnInfo& spawn = objectSpawns_[i];
+        spawn.id = nextSpawnId_++;
+        spawnIndexById_[spawn.id] = i;
+        spawnGrid_.Insert(spawn.id, spawn.position);
     }
 }
 
@@ -183,6 +577,90 @@ void MapData::SetTile(int col, int row, int tileID, TileLayer layer) {
 
     auto* data = GetLayerDataMutable(layer);
     if (data && !data->empty()) {
-        (*data)[row][col] = tileID;
+        int& tile = (*data)[row][col];
+        if (tile == tileID) return;
+
+        tile = tileID;
+        MarkDirty(col, col + 1, row, layer);
     }
+}
+
+bool MapData::FillRun(int col, int row, int length, int tileID, TileLayer layer) {
+    if (row < 0 || row >= height_) return false;
+
+    int colBegin = (std::max)(col, 0);
+    int colEnd = (std::min)(col + length, width_);
+    if (colBegin >= colEnd) return false;
+
+    auto* data = GetLayerDataMutable(layer);
+    if (!data || data->empty()) return false;
+
+    // 両端の、既に同じIDのマスは書き込みも変更扱いもしない
+    auto& rowData = (*data)[row];
+    while (colBegin < colEnd && rowData[colBegin] == tileID) ++colBegin;
+    while (colBegin < colEnd && rowData[colEnd - 1] == tileID) --colEnd;
+    if (colBegin >= colEnd) return false;
+
+    std::fill(rowData.begin() + colBegin, rowData.begin() + colEnd, tileID);
+    MarkDirty(colBegin, colEnd, row, layer);
+    return true;
+}
+
+// ========== 変更チャンク ==========
+void MapData::MarkDirty(int colBegin, int colEnd, int row, TileLayer layer) {
+    const int layerIndex = static_cast<int>(layer);
+    if (layerIndex < 0 || layerIndex >= kTileLayerCount) return;
+
+#ifdef _DEBUG
+    rowTextValid_[layerIndex][row] = 0;
+    hasUnsavedChanges_ = true;
+#endif
+
+    const int cy = row / kChunkSize;
+    const int chunkBase = (layerIndex * chunkCountY_ + cy) * chunkCountX_;
+    for (int cx = colBegin / kChunkSize; cx <= (colEnd - 1) / kChunkSize; ++cx) {
+        uint8_t& flag = dirtyChunkFlags_[chunkBase + cx];
+        if (!flag) {
+            flag = 1;
+            dirtyChunks_.push_back({ cx, cy, layer });
+        }
+    }
+}
+
+void MapData::MarkAllDirty() {
+    chunkCountX_ = (width_ + kChunkSize - 1) / kChunkSize;
+    chunkCountY_ = (height_ + kChunkSize - 1) / kChunkSize;
+
+    dirtyChunkFlags_.assign(static_cast<size_t>(chunkCountX_) * chunkCountY_ * kTileLayerCount, 1);
+    dirtyChunks_.clear();
+    dirtyChunks_.reserve(dirtyChunkFlags_.size());
+    for (int layerIndex = 0; layerIndex < kTileLayerCount; ++layerIndex) {
+        for (int cy = 0; cy < chunkCountY_; ++cy) {
+            for (int cx = 0; cx < chunkCountX_; ++cx) {
+                dirtyChunks_.push_back({ cx, cy, static_cast<TileLayer>(layerIndex) });
+            }
+        }
+    }
+
+#ifdef _DEBUG
+    for (int layerIndex = 0; layerIndex < kTileLayerCount; ++layerIndex) {
+        rowTextCache_[layerIndex].assign(height_, std::string());
+        rowTextValid_[layerIndex].assign(height_, 0);
+    }
+    hasUnsavedChanges_ = true;
+#endif
+}
+
+void MapData::TakeDirtyChunks(std::vector<TileChunkCoord>& out) {
+    for (const TileChunkCoord& chunk : dirtyChunks_) {
+        const int layerIndex = static_cast<int>(chunk.layer);
+        dirtyChunkFlags_[(layerIndex * chunkCountY_ + chunk.cy) * chunkCountX_ + chunk.cx] = 0;
+    }
+    out.insert(out.end(), dirtyChunks_.begin(), dirtyChunks_.end());
+    dirtyChunks_.clear();
+}
+
+void MapData::ClearDirtyChunks() {
+    std::fill(dirtyChunkFlags_.begin(), dirtyChunkFlags_.end(), 0);
+    dirtyChunks_.clear();
 }
\ No newline at end of file
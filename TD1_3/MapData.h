@@ -1,10 +1,22 @@
 ﻿#pragma once
+#include <array>
+#include <cstdint>
+#include <functional>
 #include <vector>
 #include <string>
+#include <unordered_map>
 #include <Novice.h>
 #include "Vector2.h"
 #include "JsonUtil.h"
 #include "TileRegistry.h"
+#include "ObjectSpawnGrid.h"
+
+// 変更のあったチャンク（kChunkSize マス四方の区画）
+struct TileChunkCoord {
+    int cx;
+    int cy;
+    TileLayer layer;
+};
 
 // オブジェクトスポーン情報
 struct ObjectSpawnInfo {
@@ -12,6 +24,33 @@ struct ObjectSpawnInfo {
     Vector2 position;       // ワールド座標（自由配置）
     std::string tag;        // タグ（検索用、例: "player", "enemy"）
     json customData;        // カスタムパラメータ（向き、HP、AI設定等）
+    ObjectSpawnId id = kInvalidObjectSpawnId; // MapData が振る安定ID（保存・比較の対象外）
+};
+
+// マップファイルを解析した結果（MapData に反映する前の中間データ）
+struct MapFileContent {
+    int width = 0;
+    int height = 0;
+    float tileSize = 64.0f;
+    std::array<std::vector<std::vector<int>>, 4> layers; // TileLayer の値で引く（Object は含まない）
+    std::vector<ObjectSpawnInfo> objectSpawns;
+};
+
+// 保存時のタイルレイヤーの書き方
+enum class TileLayerEncoding {
+    Auto,   // レイヤーごとに一番短くなる書き方を選ぶ
+    Dense,  // 従来の2次元配列 [[0,1,...],...]
+    Rle,    // 行ごとの (ID, 個数) の並び {"encoding":"rle","rows":[[0,12,3,4,...],...]}
+    Sparse, // 0以外のマスの (x, y, ID) {"encoding":"sparse","tiles":[[x,y,id],...]}
+};
+
+// 再読み込みで反映した差分
+struct MapReloadResult {
+    bool isApplied = false;       // 読み込み・解析に成功して反映したか
+    bool isFullReload = false;    // サイズが変わったため丸ごと差し替えたか
+    bool hasSpawnChanges = false; // オブジェクトスポーン情報が変わったか
+    int changedRows = 0;          // 差し替えた行数（全レイヤー合計）
+    int changedChunks = 0;        // 新たに変更扱いになったチャンク数
 };
 
 /// <summary>
@@ -39,45 +78,106 @@ public:
     /// </summary>
     bool Load(const std::string& filePath);
 
+    /// <summary>
+    /// 読み込みと解析をワーカースレッドで行い、完了後の同期点でデータを差し替える
+    /// </summary>
+    void LoadAsync(const std::string& filePath, std::function<void(bool)> onLoaded = nullptr);
+
+    /// <summary>
+    /// ファイルの変更を取り込む（解析はワーカー、反映は変わった行とスポーン情報だけ）
+    /// 変わった範囲は変更チャンクとして記録されるので、MapManager::SyncDirtyChunks で描画・当たり判定に反映される
+    /// </summary>
+    void ReloadAsync(const std::string& filePath, std::function<void(const MapReloadResult&)> onReloaded = nullptr);
+
     /// <summary>
     /// 現在のマップデータをJSONファイルに保存する
+    /// タイルは行ごとに書き出した文字列をキャッシュしておき、前回の保存から変わった行だけ作り直す
     /// </summary>
 #ifdef _DEBUG
     bool Save(const std::string& filePath);
+
+    // 保存時のタイルレイヤーの書き方（読み込みはどの書き方でも受け付ける）
+    void SetSaveEncoding(TileLayerEncoding encoding) { saveEncoding_ = encoding; }
+    TileLayerEncoding GetSaveEncoding() const { return saveEncoding_; }
+
+    // 文字列化だけをその場で行い、ファイルへの書き込みはワーカースレッドに任せる
+    void SaveAsync(const std::string& filePath, std::function<void(bool)> onSaved = nullptr);
+
+    // 前回の保存（読み込み）から変更があるか
+    bool HasUnsavedChanges() const { return hasUnsavedChanges_; }
+
+    // 書き込みが終わっていない保存があるか
+    bool IsSaving() const { return saveRequestCount_ > 0; }
 #endif
 
     // --- タイルデータアクセサ ---
     int GetTile(int col, int row, TileLayer layer) const;
+
+    // 値が変わったときだけ書き込み、チャンクを変更済みにする
     void SetTile(int col, int row, int tileID, TileLayer layer);
 
+    /// <summary>
+    /// 同じ行の連続したマスをまとめて書き換える（範囲外は切り詰める）
+    /// SetTile と同じく、値が変わったマスの範囲だけを変更済みにする。1マスも変わらなければ false
+    /// </summary>
+    bool FillRun(int col, int row, int length, int tileID, TileLayer layer);
+
+    // --- 変更チャンク ---
+    static constexpr int kChunkSize = 32;
+
+    int GetChunkCountX() const { return chunkCountX_; }
+    int GetChunkCountY() const { return chunkCountY_; }
+
+    /// <summary>
+    /// 前回の取り出し以降に変更されたチャンクを out に追加し、記録をクリアする
+    /// （MapManager の差分再構築用）
+    /// </summary>
+    void TakeDirtyChunks(std::vector<TileChunkCoord>& out);
+
+    // 変更チャンクの記録を捨てる（全体を作り直した直後など）
+    void ClearDirtyChunks();
+
     // 既存コード互換用（Blockレイヤーを返す）
     int GetTile(int col, int row) const {
         return GetTile(col, row, TileLayer::Block);
     }
 
     // --- オブジェクトスポーン情報アクセサ ---
+    // 並びはファイル上の順番（保存時の差分が出にくいように追加順を保つ）
     const std::vector<ObjectSpawnInfo>& GetObjectSpawns() const { return objectSpawns_; }
 
     /// <summary>
-    /// オブジェクトスポーンを追加
+    /// オブジェクトスポーンを追加（振った安定IDを返す）
     /// </summary>
-    void AddObjectSpawn(int typeId, const Vector2& position, const std::string& tag = "", const json& customData = json::object());
+    ObjectSpawnId AddObjectSpawn(int typeId, const Vector2& position, const std::string& tag = "", const json& customData = json::object());
 
     /// <summary>
-    /// オブジェクトスポーンを削除（インデックス指定）
+    /// オブジェクトスポーンを削除（ID指定）
     /// </summary>
-    void RemoveObjectSpawn(size_t index);
-
+    void RemoveObjectSpawn(ObjectSpawnId id);
 
 	/// <summary>
-	/// オブジェクトスポーンの位置を更新（インデックス指定）
+	/// オブジェクトスポーンの位置を更新（ID指定）
 	/// </summary>
-    void UpdateObjectSpawnPosition(size_t index, const Vector2& newPosition);
+    void UpdateObjectSpawnPosition(ObjectSpawnId id, const Vector2& newPosition);
 
     /// <summary>
     /// オブジェクトスポーンを全削除
     /// </summary>
-    void ClearObjectSpawns() { objectSpawns_.clear(); }
+    void ClearObjectSpawns();
+
+    // ID からスポーン情報を引く（削除済みなら nullptr）
+    const ObjectSpawnInfo* FindObjectSpawn(ObjectSpawnId id) const;
+
+    /// <summary>
+    /// 指定位置から radius 以内で一番近いスポーンを返す（無ければ kInvalidObjectSpawnId）
+    /// </summary>
+    ObjectSpawnId PickObjectSpawn(const Vector2& position, float radius) const;
+
+    /// <summary>
+    /// 矩形内にあるスポーンの ID を集める（out は呼び出し側で使い回す）
+    /// </summary>
+    void QueryObjectSpawns(const Vector2& min, const Vector2& max, std::vector<ObjectSpawnId>& out) const;
 
     // --- メタデータアクセサ ---
     int GetWidth() const { return width_; }
@@ -85,10 +185,38 @@ public:
     float GetTileSize() const { return tileSize_; }
 
     // レイヤーデータ取得
+    // Mutable で直接書き換えた場合は変更チャンクが記録されないので、SetTile / FillRun を使うこと
     std::vector<std::vector<int>>* GetLayerDataMutable(TileLayer layer);
     const std::vector<std::vector<int>>* GetLayerData(TileLayer layer) const;
 
 private:
+    // ファイルを中間データに読み込む（MapData に触らないのでワーカーからも呼べる）
+    static bool ReadContent(const std::string& filePath, MapFileContent& out);
+
+    // ワーカーで読み込み・解析し、結果をメインスレッドで受け取る
+    static void ParseAsync(const std::string& filePath, std::function<void(bool, MapFileContent&)> onParsed);
+
+    // 中間データを丸ごと反映する / 変わったところだけ反映する
+    void ApplyContent(MapFileContent&& content);
+    MapReloadResult ApplyContentDiff(MapFileContent&& content);
+
+#ifdef _DEBUG
+    // 保存用の文字列を作る（変更のあった行だけ作り直す）
+    void BuildSaveText(std::string& text, int& rebuiltRows);
+
+    // レイヤーの書き方を決める（Auto の場合は書き出す文字数の見積もりで選ぶ）
+    TileLayerEncoding ChooseEncoding(const std::vector<std::vector<int>>& rows) const;
+#endif
+
+    // 保存・変更記録の対象になるタイルレイヤー数（Object は実行時に使わない）
+    static constexpr int kTileLayerCount = 4;
+
+    // 範囲内のマスが変わったことを記録する
+    void MarkDirty(int colBegin, int colEnd, int row, TileLayer layer);
+
+    // 全体を変更済みにする（読み込み・リセット時）
+    void MarkAllDirty();
+
     // タイルレイヤー
     std::vector<std::vector<int>> tilesBackground_;
     std::vector<std::vector<int>> tilesBackgroundDecoration_;
@@ -98,10 +226,34 @@ private:
     // オブジェクトスポーン情報（座標管理）
     std::vector<ObjectSpawnInfo> objectSpawns_;
 
+    // スポーンの ID → objectSpawns_ の添字、位置の空間インデックス
+    std::unordered_map<ObjectSpawnId, size_t> spawnIndexById_;
+    ObjectSpawnGrid spawnGrid_;
+    ObjectSpawnId nextSpawnId_ = 1;
+
+    // objectSpawns_ を丸ごと差し替えたあとに ID を振り直し、インデックスを作り直す
+    void RebuildObjectSpawnIndex();
+
     static const int kMapChipWidth = 1000;
     static const int kMapChipHeight = 1000;
 
     int width_ = 1000;
     int height_ = 1000;
     float tileSize_ = 64.0f;
+
+    // 変更チャンク（フラグで重複を防ぎ、リストで変更分だけを返す）
+    int chunkCountX_ = 0;
+    int chunkCountY_ = 0;
+    std::vector<uint8_t> dirtyChunkFlags_;
+    std::vector<TileChunkCoord> dirtyChunks_;
+
+#ifdef _DEBUG
+    // 保存用の行キャッシュ（"[1,0,0,...]" の形で1行ずつ持つ）
+    std::array<std::vector<std::string>, kTileLayerCount> rowTextCache_;
+    std::array<std::vector<uint8_t>, kTileLayerCount> rowTextValid_;
+    std::array<TileLayerEncoding, kTileLayerCount> rowTextEncoding_ = {}; // 行キャッシュを作ったときの書き方
+    TileLayerEncoding saveEncoding_ = TileLayerEncoding::Auto;
+    bool hasUnsavedChanges_ = false;
+    int saveRequestCount_ = 0;
+#endif
 };
\ No newline at end of file
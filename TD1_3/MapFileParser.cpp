@@ -0,0 +1,393 @@
+﻿#include "MapFileParser.h"
+#include <charconv>
+#include <fstream>
+#include <vector>
+
+namespace {
+    using json = nlohmann::json;
+
+    /// <summary>
+    /// 先頭から順に読み進めるだけの JSON リーダー（DOM を作らない）
+    /// タイルの配列は数字を直接 int にし、objects だけは範囲を切り出して nlohmann::json で解析する
+    /// </summary>
+    class MapFileReader {
+        // 展開待ちの疎なレイヤー（x, y, id を平らに並べたもの）
+        struct SparseLayer {
+            std::vector<std::vector<int>>* layer;
+            std::vector<int> tiles;
+        };
+
+    public:
+        MapFileReader(const char* begin, const char* end, MapFileContent& out)
+            : cursor_(begin), end_(end), out_(out) {}
+
+        bool ReadRoot() {
+            // UTF-8 の BOM（ツールで保存したファイルに付く）を読み飛ばす
+            if (end_ - cursor_ >= 3 &&
+                static_cast<unsigned char>(cursor_[0]) == 0xEF &&
+                static_cast<unsigned char>(cursor_[1]) == 0xBB &&
+                static_cast<unsigned char>(cursor_[2]) == 0xBF) {
+                cursor_ += 3;
+            }
+
+            std::vector<std::vector<int>> legacyTiles;
+            bool hasLayers = false;
+
+            const bool isValid = ReadObject([&](const std::string& key) {
+                if (key == "width") return ReadInt(out_.width);
+                if (key == "height") return ReadInt(out_.height);
+                if (key == "tileSize") return ReadFloat(out_.tileSize);
+                if (key == "layers") {
+                    hasLayers = true;
+                    return ReadLayers();
+                }
+                if (key == "tiles") return ReadTileLayer(legacyTiles); // 互換性: 古い形式（ブロックレイヤーのみ）
+                if (key == "objects") return ReadObjects();
+                return SkipValue();
+            });
+            if (!isValid) return false;
+
+            // 疎な書き方のレイヤーは幅・高さが分かってから展開する（キーの順番に依存しない）
+            for (SparseLayer& sparse : sparseLayers_) {
+                if (!ExpandSparse(sparse)) return false;
+            }
+
+            if (!hasLayers && !legacyTiles.empty()) {
+                out_.layers[static_cast<int>(TileLayer::Block)] = std::move(legacyTiles);
+            }
+
+            SkipWhitespace();
+            return cursor_ == end_;
+        }
+
+    private:
+        // ========== 基本 ==========
+        void SkipWhitespace() {
+            while (cursor_ < end_ && (*cursor_ == ' ' || *cursor_ == '\n' || *cursor_ == '\r' || *cursor_ == '\t')) {
+                ++cursor_;
+            }
+        }
+
+        bool Consume(char c) {
+            SkipWhitespace();
+            if (cursor_ < end_ && *cursor_ == c) {
+                ++cursor_;
+                return true;
+            }
+            return false;
+        }
+
+        bool Peek(char c) {
+            SkipWhitespace();
+            return cursor_ < end_ && *cursor_ == c;
+        }
+
+        // キー用の文字列（エスケープは最低限だけ解釈する）
+        bool ReadString(std::string& out) {
+            if (!Consume('"')) return false;
+            out.clear();
+            while (cursor_ < end_ && *cursor_ != '"') {
+                if (*cursor_ == '\\') {
+                    if (++cursor_ >= end_) return false;
+                }
+                out.push_back(*cursor_++);
+            }
+            return Consume('"');
+        }
+
+        // { "key": value, ... } を読み、値の読み方は onMember に任せる
+        template <typename OnMember>
+        bool ReadObject(OnMember&& onMember) {
+            if (!Consume('{')) return false;
+            if (Consume('}')) return true;
+
+            std::string key;
+            do {
+                if (!ReadString(key) || !Consume(':')) return false;
+                if (!onMember(key)) return false;
+            } while (Consume(','));
+
+            return Consume('}');
+        }
+
+        // ========== 数値 ==========
+        bool ReadInt(int& out) {
+            SkipWhitespace();
+            const char* start = cursor_;
+            auto result = std::from_chars(start, end_, out);
+            if (result.ec != std::errc()) return false;
+            cursor_ = result.ptr;
+
+            // "3.0" のように小数で書かれていた場合は小数として読み直す
+            if (cursor_ < end_ && (*cursor_ == '.' || *cursor_ == 'e' || *cursor_ == 'E')) {
+                float value = 0.0f;
+                cursor_ = start;
+                if (!ReadFloat(value)) return false;
+                out = static_cast<int>(value);
+            }
+            return true;
+        }
+
+        bool ReadFloat(float& out) {
+            SkipWhitespace();
+            auto result = std::from_chars(cursor_, end_, out);
+            if (result.ec != std::errc()) return false;
+            cursor_ = result.ptr;
+            return true;
+        }
+
+        // ========== タイル ==========
+        bool ReadLayers() {
+            return ReadObject([this](const std::string& key) {
+                std::vector<std::vector<int>>* layer = FindLayer(key);
+                return layer ? ReadTileLayer(*layer) : SkipValue();
+            });
+        }
+
+        std::vector<std::vector<int>>* FindLayer(const std::string& name) {
+            if (name == "background") return &out_.layers[static_cast<int>(TileLayer::Background)];
+            if (name == "backgroundDecoration") return &out_.layers[static_cast<int>(TileLayer::BackgroundDecoration)];
+            if (name == "decoration") return &out_.layers[static_cast<int>(TileLayer::Decoration)];
+            if (name == "block") return &out_.layers[static_cast<int>(TileLayer::Block)];
+            return nullptr;
+        }
+
+        // レイヤー1つ分を読む（従来の2次元配列か、{"encoding": ...} のオブジェクト）
+        bool ReadTileLayer(std::vector<std::vector<int>>& layer) {
+            if (!Peek('{')) {
+                return ReadDenseLayer(layer);
+            }
+
+            std::string encoding;
+            bool hasRows = false;
+            bool hasTiles = false;
+            const bool isValid = ReadObject([&](const std::string& key) {
+                if (key == "encoding") return ReadString(encoding);
+                if (key == "rows") {
+                    hasRows = true;
+                    return ReadRleLayer(layer);
+                }
+                if (key == "tiles") {
+                    hasTiles = true;
+                    sparseLayers_.push_back({ &layer, {} });
+                    return ReadSparseTiles(sparseLayers_.back().tiles);
+                }
+                return SkipValue();
+            });
+            if (!isValid) return false;
+
+            // "rows" は RLE、"tiles" は疎な書き方。encoding が書かれていれば食い違いを弾く
+            if (hasRows == hasTiles) return false;
+            if (!encoding.empty() && encoding != (hasRows ? "rle" : "sparse")) return false;
+            return true;
+        }
+
+        // [[1,0,0],[0,2,0],...] を行ごとの配列に読み込む（幅・高さが先に分かっていれば確保済みの領域に書く）
+        bool ReadDenseLayer(std::vector<std::vector<int>>& layer) {
+            layer.clear();
+            if (out_.height > 0) {
+                layer.reserve(out_.height);
+            }
+
+            if (!Consume('[')) return false;
+            if (Consume(']')) return true;
+
+            do {
+                std::vector<int>& row = layer.emplace_back();
+                if (out_.width > 0) {
+                    row.reserve(out_.width);
+                }
+
+                if (!Consume('[')) return false;
+                if (Consume(']')) continue;
+
+                do {
+                    int tileId = 0;
+                    if (!ReadInt(tileId)) return false;
+                    row.push_back(tileId);
+                } while (Consume(','));
+
+                if (!Consume(']')) return false;
+            } while (Consume(','));
+
+            return Consume(']');
+        }
+
+        // [[id,count,id,count,...],...] を展開する（行の幅は個数の合計）
+        bool ReadRleLayer(std::vector<std::vector<int>>& layer) {
+            layer.clear();
+            if (out_.height > 0) {
+                layer.reserve(out_.height);
+            }
+
+            if (!Consume('[')) return false;
+            if (Consume(']')) return true;
+
+            do {
+                std::vector<int>& row = layer.emplace_back();
+                if (out_.width > 0) {
+                    row.reserve(out_.width);
+                }
+
+                if (!Consume('[')) return false;
+                if (Consume(']')) continue;
+
+                do {
+                    int tileId = 0;
+                    int count = 0;
+                    if (!ReadInt(tileId) || !Consume(',') || !ReadInt(count)) return false;
+
+                    // 壊れたファイルで巨大な確保をしないよう、幅が分かっていればはみ出しを弾く
+                    if (count < 0 || (out_.width > 0 && row.size() + count > static_cast<size_t>(out_.width))) return false;
+                    row.insert(row.end(), static_cast<size_t>(count), tileId);
+                } while (Consume(','));
+
+                if (!Consume(']')) return false;
+            } while (Consume(','));
+
+            return Consume(']');
+        }
+
+        // [[x,y,id],...] を読む（展開は ExpandSparse で行う）
+        bool ReadSparseTiles(std::vector<int>& tiles) {
+            if (!Consume('[')) return false;
+            if (Consume(']')) return true;
+
+            do {
+                int x = 0;
+                int y = 0;
+                int tileId = 0;
+                if (!Consume('[') || !ReadInt(x) || !Consume(',') || !ReadInt(y) || !Consume(',') || !ReadInt(tileId) || !Consume(']')) {
+                    return false;
+                }
+                tiles.push_back(x);
+                tiles.push_back(y);
+                tiles.push_back(tileId);
+            } while (Consume(','));
+
+            return Consume(']');
+        }
+
+        bool ExpandSparse(SparseLayer& sparse) {
+            // 疎な書き方は幅・高さが無いと大きさが決まらない
+            if (out_.width <= 0 || out_.height <= 0) return false;
+
+            auto& layer = *sparse.layer;
+            layer.assign(out_.height, std::vector<int>(out_.width, 0));
+            for (size_t i = 0; i + 2 < sparse.tiles.size(); i += 3) {
+                const int x = sparse.tiles[i];
+                const int y = sparse.tiles[i + 1];
+                if (x < 0 || x >= out_.width || y < 0 || y >= out_.height) return false;
+                layer[y][x] = sparse.tiles[i + 2];
+            }
+            return true;
+        }
+
+        // ========== オブジェクト ==========
+        bool ReadObjects() {
+            // 件数が少ないので、範囲を切り出して DOM で解析する（customData をそのまま持つため）
+            SkipWhitespace();
+            const char* start = cursor_;
+            if (!SkipValue()) return false;
+
+            json objects = json::parse(start, cursor_, nullptr, false);
+            if (objects.is_discarded() || !objects.is_array()) return false;
+
+            out_.objectSpawns.clear();
+            out_.objectSpawns.reserve(objects.size());
+            try {
+                for (auto& obj : objects) {
+                    ObjectSpawnInfo spawn;
+                    spawn.objectTypeId = obj["type"];
+                    spawn.position.x = obj["position"]["x"];
+                    spawn.position.y = obj["position"]["y"];
+                    spawn.tag = obj.value("tag", "");
+                    spawn.customData = obj.contains("data") ? std::move(obj["data"]) : json::object();
+                    out_.objectSpawns.push_back(std::move(spawn));
+                }
+            }
+            catch (const std::exception&) {
+                return false;
+            }
+            return true;
+        }
+
+        // ========== 読み飛ばし ==========
+        // 知らないキーの値を、中身を解釈せずに1つ分読み飛ばす
+        bool SkipValue() {
+            SkipWhitespace();
+            if (cursor_ >= end_) return false;
+
+            int depth = 0;
+            do {
+                if (cursor_ >= end_) return false;
+
+                const char c = *cursor_;
+                if (c == '"') {
+                    ++cursor_;
+                    while (cursor_ < end_ && *cursor_ != '"') {
+                        cursor_ += (*cursor_ == '\\') ? 2 : 1;
+                    }
+                    if (cursor_ >= end_) return false;
+                    ++cursor_;
+                }
+                else if (c == '{' || c == '[') {
+                    ++depth;
+                    ++cursor_;
+                }
+                else if (c == '}' || c == ']') {
+                    if (depth == 0) return false;
+                    --depth;
+                    ++cursor_;
+                }
+                else if (depth == 0 && c == ',') {
+                    return false;
+                }
+                else {
+                    // 数値・true/false/null・区切り文字（次の構造文字まで進める）
+                    ++cursor_;
+                    while (cursor_ < end_ && *cursor_ != ',' && *cursor_ != '}' && *cursor_ != ']' && *cursor_ != '"' &&
+                        *cursor_ != '{' && *cursor_ != '[') {
+                        ++cursor_;
+                    }
+                }
+            } while (depth > 0);
+
+            return true;
+        }
+
+        const char* cursor_;
+        const char* end_;
+        MapFileContent& out_;
+        std::vector<SparseLayer> sparseLayers_;
+    };
+}
+
+bool MapFileParser::ParseFile(const std::string& filePath, MapFileContent& out) {
+    // ファイル全体を一度に読んでから解析する
+    std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    const std::streamsize size = file.tellg();
+    if (size <= 0) {
+        return false;
+    }
+    std::string text(static_cast<size_t>(size), '\0');
+    file.seekg(0);
+    if (!file.read(text.data(), size)) {
+        return false;
+    }
+
+    return Parse(text.data(), text.data() + text.size(), out);
+}
+
+bool MapFileParser::Parse(const char* begin, const char* end, MapFileContent& out) {
+    out = MapFileContent{};
+    out.width = 0;
+    out.height = 0;
+
+    MapFileReader reader(begin, end, out);
+    return reader.ReadRoot();
+}
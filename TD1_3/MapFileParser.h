@@ -0,0 +1,23 @@
+﻿#pragma once
+#include <string>
+#include "MapData.h"
+
+/// <summary>
+/// マップファイル（JSON）をストリーミングで解析するパーサー
+/// タイルレイヤーは従来の2次元配列・RLE・疎な書き方（TileLayerEncoding）のどれでも読み、
+/// DOM を作らずに数値を直接配列へ書き込む。
+/// DOM を作るのは件数の少ない objects（customData を含む）だけにする
+/// </summary>
+class MapFileParser {
+public:
+    /// <summary>
+    /// ファイルを読み込んで解析する（MapData に触らないのでワーカースレッドからも呼べる）
+    /// </summary>
+    static bool ParseFile(const std::string& filePath, MapFileContent& out);
+
+    /// <summary>
+    /// メモリ上の JSON テキストを解析する
+    /// 書かれていない width / height は 0、無いレイヤーは空のまま返す（既定値で埋めるのは呼び出し側）
+    /// </summary>
+    static bool Parse(const char* begin, const char* end, MapFileContent& out);
+};
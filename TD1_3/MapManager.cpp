@@ -1,18 +1,119 @@
 ﻿#include "MapManager.h"
 #include "TileRegistry.h"
+#include "AnimationClip.h"
 #include "WindowSize.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <thread>
+
+namespace {
+    // タイルのアニメーション開始位置の乱数シード（同じマップなら毎回同じ見た目になる）
+    constexpr uint32_t kTileAnimSeed = 0x7D1A3u;
+
+    // チャンクごとの乱数（どのスレッドがどの順で処理しても結果が変わらない）
+    std::mt19937 MakeChunkRandom(int cx, int cy) {
+        std::seed_seq seq{ kTileAnimSeed, static_cast<uint32_t>(cx), static_cast<uint32_t>(cy) };
+        return std::mt19937(seq);
+    }
+
+    // [0, 1) の float（分布クラスは実装ごとに結果が違うので使わない）
+    float NextUnitFloat(std::mt19937& rng) {
+        return static_cast<float>(rng() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    /// <summary>
+    /// 0 ～ count-1 の処理をコア数分のスレッドで分け合う（呼び出し元のスレッドも参加する）
+    /// 重さの偏りがあっても空いたスレッドが次を取るので、最後まで均等に埋まる
+    /// </summary>
+    template <class Func>
+    void ParallelFor(int count, const Func& func) {
+        if (count <= 0) return;
+
+        const int threadCount = (std::min)((std::max)(static_cast<int>(std::thread::hardware_concurrency()), 1), count);
+
+        std::atomic<int> next{ 0 };
+        auto worker = [&]() {
+            for (int i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+                func(i);
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount - 1);
+        for (int i = 1; i < threadCount; ++i) {
+            threads.emplace_back(worker);
+        }
+        worker();
+
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+}
 
 void MapManager::Initialize() {
     dynamicTiles_.clear();
     auto& mapData = MapData::GetInstance();
-    float tileSize = mapData.GetTileSize();
 
-    // 全レイヤーを走査してComponent指定のタイルを探す
-    std::vector<TileLayer> layers = { TileLayer::Decoration, TileLayer::Block };
+    // 生成中にクリップが追加されるとスレッド間で競合するので、先に全部登録しておく
+    WarmUpTileClips();
+
+    // チャンク単位で並列に生成する（出力先はチャンクごとに分けて、書き込みが衝突しないようにする）
+    const int chunkCountX = mapData.GetChunkCountX();
+    const int chunkCount = chunkCountX * mapData.GetChunkCountY();
+    std::vector<std::vector<std::unique_ptr<TileInstance>>> chunkTiles(chunkCount);
+
+    ParallelFor(chunkCount, [&](int index) {
+        BuildChunkTiles(index % chunkCountX, index / chunkCountX, nullptr, chunkTiles[index]);
+    });
+
+    // チャンク順に連結する（スレッド数に関係なく同じ並びになる）
+    size_t totalCount = 0;
+    for (const auto& tiles : chunkTiles) {
+        totalCount += tiles.size();
+    }
+    dynamicTiles_.reserve(totalCount);
+    for (auto& tiles : chunkTiles) {
+        std::move(tiles.begin(), tiles.end(), std::back_inserter(dynamicTiles_));
+    }
+
+    // 全体を作り直したので、それまでの変更記録は不要
+    mapData.ClearDirtyChunks();
+}
+
+void MapManager::WarmUpTileClips() {
+    auto& clips = AnimationClipRegistry::GetInstance();
+    for (const TileDefinition& def : TileRegistry::GetAllTiles()) {
+        if (def.renderMode != RenderMode::Component) continue;
+
+        // DrawComponent2D のコンストラクタと同じキーで登録する
+        const TileAnimConfig& anim = def.animConfig;
+        clips.GetClip(def.textureId, anim.divX, anim.divY, anim.totalFrames, anim.speed, anim.isLoop);
+    }
+}
+
+void MapManager::BuildChunkTiles(int cx, int cy, const std::vector<int>* existingCells,
+    std::vector<std::unique_ptr<TileInstance>>& out) {
+    const auto& mapData = MapData::GetInstance();
+    const float tileSize = mapData.GetTileSize();
+    const int width = mapData.GetWidth();
+
+    const int colBegin = cx * MapData::kChunkSize;
+    const int rowBegin = cy * MapData::kChunkSize;
+    const int colEnd = (std::min)(colBegin + MapData::kChunkSize, width);
+    const int rowEnd = (std::min)(rowBegin + MapData::kChunkSize, mapData.GetHeight());
+
+    std::mt19937 rng = MakeChunkRandom(cx, cy);
+
+    // Component指定のタイルを持つレイヤーを走査
+    const TileLayer layers[] = { TileLayer::Decoration, TileLayer::Block };
 
     for (auto layer : layers) {
-        for (int y = 0; y < mapData.GetHeight(); ++y) {
-            for (int x = 0; x < mapData.GetWidth(); ++x) {
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            for (int x = colBegin; x < colEnd; ++x) {
                 int id = mapData.GetTile(x, y, layer);
                 if (id == 0) continue;
 
@@ -23,13 +124,26 @@ void MapManager::Initialize() {
                         x * tileSize + tileSize * 0.5f,
                         y * tileSize + tileSize * 0.5f
                     };
-                    dynamicTiles_.push_back(std::make_unique<TileInstance>(*def, worldPos));
+                    float animOffset = def->animConfig.isAnimated ? NextUnitFloat(rng) : 0.0f;
+                    out.push_back(std::make_unique<TileInstance>(*def, worldPos, animOffset));
+
+                    // 新しく置かれたマスならリアクション
+                    if (existingCells &&
+                        !std::binary_search(existingCells->begin(), existingCells->end(), y * width + x)) {
+                        out.back()->OnHit();
+                    }
                 }
             }
         }
     }
 }
 
+void MapManager::ResetTileStates() {
+    for (auto& tile : dynamicTiles_) {
+        tile->ResetState();
+    }
+}
+
 void MapManager::Update(float deltaTime, Camera2D& camera) {
     // カメラ表示範囲より少し広い矩形（アクティブエリア）を計算
     float margin = 128.0f;
@@ -73,35 +187,54 @@ void MapManager::InteractionTile(const Vector2& worldPos) {
     }
 }
 
-void MapManager::OnTileChanged(int col, int row, TileLayer layer) {
+void MapManager::SyncDirtyChunks() {
     auto& mapData = MapData::GetInstance();
-    float tileSize = mapData.GetTileSize();
 
-    // 1. 座標の特定（タイルの中心点）
-    Vector2 targetPos = {
-        col * tileSize + tileSize * 0.5f,
-        row * tileSize + tileSize * 0.5f
-    };
+    dirtyChunkBuffer_.clear();
+    mapData.TakeDirtyChunks(dirtyChunkBuffer_);
+    if (dirtyChunkBuffer_.empty()) return;
+
+    // TileInstance はレイヤーを持たないので、Decoration / Block の変更を位置だけでまとめる
+    const int chunkCountX = mapData.GetChunkCountX();
+    const int chunkCountY = mapData.GetChunkCountY();
+    std::vector<uint8_t> rebuild(static_cast<size_t>(chunkCountX) * chunkCountY, 0);
+    bool hasRebuild = false;
+
+    for (const TileChunkCoord& chunk : dirtyChunkBuffer_) {
+        if (chunk.layer != TileLayer::Decoration && chunk.layer != TileLayer::Block) continue;
+        rebuild[chunk.cy * chunkCountX + chunk.cx] = 1;
+        hasRebuild = true;
+    }
+    if (!hasRebuild) return;
+
+    const float tileSize = mapData.GetTileSize();
+    const int width = mapData.GetWidth();
 
-    // 2. 削除処理：リストから指定座標に一致するインスタンスを探して削除
-    // std::remove_if を使うのが、スマートポインタのリスト操作として最も合理的で高速です
+    // 1. 対象チャンクのタイルを1回の走査でまとめて削除（元の位置は覚えておく）
+    std::vector<int> existingCells;
     dynamicTiles_.erase(
         std::remove_if(dynamicTiles_.begin(), dynamicTiles_.end(),
             [&](const std::unique_ptr<TileInstance>& tile) {
                 Vector2 p = tile->GetWorldPos();
-                // 浮動小数点の誤差が心配な場合は、0.1f程度の誤差を許容して判定します
-                return (std::abs(p.x - targetPos.x) < 0.1f && std::abs(p.y - targetPos.y) < 0.1f);
+                int col = static_cast<int>(p.x / tileSize);
+                int row = static_cast<int>(p.y / tileSize);
+                int cx = col / MapData::kChunkSize;
+                int cy = row / MapData::kChunkSize;
+                if (cx < 0 || cx >= chunkCountX || cy < 0 || cy >= chunkCountY) return false;
+                if (!rebuild[cy * chunkCountX + cx]) return false;
+
+                existingCells.push_back(row * width + col);
+                return true;
             }),
         dynamicTiles_.end()
     );
+    std::sort(existingCells.begin(), existingCells.end());
 
-    // 3. 再生成（削除だけの場合は、ここでの ID チェックで終了します）
-    int id = mapData.GetTile(col, row, layer);
-    if (id == 0) return; // IDが0（空気）なら、削除だけで終了
-
-    const TileDefinition* def = TileRegistry::GetTile(id);
-    if (def && def->renderMode == RenderMode::Component) {
-        dynamicTiles_.push_back(std::make_unique<TileInstance>(*def, targetPos));
-        dynamicTiles_.back()->OnHit(); // 置いた瞬間のリアクション
+    // 2. 対象チャンクを作り直す
+    for (int cy = 0; cy < chunkCountY; ++cy) {
+        for (int cx = 0; cx < chunkCountX; ++cx) {
+            if (!rebuild[cy * chunkCountX + cx]) continue;
+            BuildChunkTiles(cx, cy, &existingCells, dynamicTiles_);
+        }
     }
-}
\ No newline at end of file
+}
@@ -24,9 +24,30 @@ public:
     // 特定座標のタイルに干渉
     void InteractionTile(const Vector2& worldPos);
 
-	// タイル変更通知(Editorで使用)
-    void OnTileChanged(int x, int y, TileLayer layer);
+    /// <summary>
+    /// MapData の変更を反映する（Editorで使用）
+    /// 変更のあったチャンクのタイルだけを作り直すので、広い塗りつぶしでも1回の走査で済む
+    /// </summary>
+    void SyncDirtyChunks();
+
+    // タイルは作り直さずに、揺れなどの演出状態だけを初期状態に戻す（リトライ用）
+    void ResetTileStates();
 
 private:
+    /// <summary>
+    /// 1チャンク分の Component タイルを生成して out に追加する
+    /// MapData は読むだけで、乱数もチャンク座標から作るので、別スレッドから並列に呼んでよい
+    /// （共有クリップの登録だけは事前に WarmUpTileClips で済ませておくこと）
+    /// existingCells が指定されていれば、そこに無かったマスのタイルは置いた瞬間のリアクションをする
+    /// </summary>
+    static void BuildChunkTiles(int cx, int cy, const std::vector<int>* existingCells,
+        std::vector<std::unique_ptr<TileInstance>>& out);
+
+    // Component タイルが使うアニメーションクリップをメインスレッドで登録しておく
+    static void WarmUpTileClips();
+
     std::vector<std::unique_ptr<TileInstance>> dynamicTiles_;
+
+    // SyncDirtyChunks の作業用（毎回の確保を避ける）
+    std::vector<TileChunkCoord> dirtyChunkBuffer_;
 };
\ No newline at end of file
@@ -1,4 +1,17 @@
 ﻿#include "ObjectRegistry.h"
+#include "GameObjectManager.h"
+#include "MapData.h"
+#include "WorldOrigin.h"
+#include "Usagi.hpp"
+#include "KinokoSpawner.hpp"
+#include "Button.hpp"
+#include "Door.hpp"
+#include "UsagiCheckPoint.hpp"
+#include "TipsTrigger.hpp"
+
+#include <Novice.h>
+#include <algorithm>
+#include <cassert>
 
 enum class ObjectRegistryType {
 	WorldOrigin = 0,
@@ -22,6 +35,54 @@ enum class ObjectRegistryType {
 // 静的メンバの定義
 std::vector<ObjectTypeInfo> ObjectRegistry::objectTypes_;
 
+namespace {
+	// Spawn して配置するだけの標準の生成関数
+	template <typename T>
+	GameObject2D* CreateAt(ObjectSpawnContext& context, const ObjectTypeInfo& type, const ObjectSpawnInfo& spawn) {
+		// Initialize で位置を使う（敵の巡回範囲など）ので、生成時に位置を渡す
+		return context.manager->SpawnAt<T>(nullptr, type.prefab.spawnTag, spawn.position);
+	}
+
+	// 敵用：巡回の基準位置がマップ上の配置位置になっているかを確認する
+	template <typename T>
+	GameObject2D* CreateEnemyAt(ObjectSpawnContext& context, const ObjectTypeInfo& type, const ObjectSpawnInfo& spawn) {
+		T* enemy = static_cast<T*>(CreateAt<T>(context, type, spawn));
+#ifdef _DEBUG
+		const Vector2& anchor = EnemyBehaviorSystem::GetInstance().GetBrain(enemy->GetBrainId()).initialPosition;
+		assert(anchor.x == spawn.position.x && anchor.y == spawn.position.y && "敵の巡回基準がマップの配置位置と一致しません");
+#endif
+		return enemy;
+	}
+
+	GameObject2D* CreateWorldOrigin(ObjectSpawnContext& context, const ObjectTypeInfo& type, const ObjectSpawnInfo& spawn) {
+		context.worldOrigin = CreateAt<WorldOrigin>(context, type, spawn);
+		return context.worldOrigin;
+	}
+
+	GameObject2D* CreatePlayer(ObjectSpawnContext& context, const ObjectTypeInfo& type, const ObjectSpawnInfo& spawn) {
+		context.player = CreateAt<Usagi>(context, type, spawn);
+		return context.player;
+	}
+
+	GameObject2D* CreateTipsTrigger(ObjectSpawnContext& context, const ObjectTypeInfo& type, const ObjectSpawnInfo& spawn) {
+		// customDataに tipsId があればそちらを優先
+		int tipsId = type.prefab.defaultParam;
+		if (spawn.customData.contains("tipsId")) {
+			tipsId = spawn.customData.at("tipsId").get<int>();
+		}
+
+		auto* trigger = context.manager->Spawn<TipsTrigger>(
+			nullptr, type.prefab.spawnTag,
+			spawn.objectTypeId, type.prefab.spawnTag, spawn.position, tipsId);
+
+		// プレイヤーへの参照を設定
+		if (context.player) {
+			trigger->SetPlayer(context.player);
+		}
+		return trigger;
+	}
+}
+
 void ObjectRegistry::Initialize() {
 	objectTypes_.clear();
 
@@ -320,6 +381,106 @@ void ObjectRegistry::Initialize() {
 	//     0xFF8800FF,     // color（オレンジ）
 	//     "PowerUp"
 	// });
+
+	// ===================================================================
+	// 生成関数とプレハブ（ゲーム内での生成方法）
+	// ===================================================================
+	BindFactory(0, &CreateWorldOrigin, { "WorldOrigin", 0, true });
+	BindFactory(99, &CreateAt<UsagiCheckPoint>, { "UsagiCheckPoint" });
+	BindFactory(100, &CreatePlayer, { "Player", 0, true });
+
+	BindFactory(101, &CreateEnemyAt<Enemy>, { "Enemy" });
+	BindFactory(102, &CreateAt<KinokoSpawner>, { "KinokoSpawner" });
+	BindFactory(103, &CreateEnemyAt<AttackEnemy>, { "Enemy" });
+	BindFactory(104, &CreateAt<AttackKinokoSpawner>, { "KinokoSpawner" });
+	BindFactory(105, &CreateEnemyAt<FatEnemy>, { "Enemy" });
+
+	BindFactory(300, &CreateAt<Button1>, { "Button" });
+	BindFactory(301, &CreateAt<Button2>, { "Button" });
+	BindFactory(302, &CreateAt<Button3>, { "Button" });
+	BindFactory(303, &CreateAt<Button4>, { "Button" });
+	BindFactory(304, &CreateAt<Button5>, { "Button" });
+	BindFactory(305, &CreateAt<Button6>, { "Button" });
+	BindFactory(310, &CreateAt<Button7>, { "Button" });
+	BindFactory(306, &CreateAt<EnemyEvent>, { "Button" });
+	BindFactory(307, &CreateAt<EnemyEvent2>, { "Button" });
+	BindFactory(308, &CreateAt<EnemyEvent3>, { "Button" });
+	BindFactory(309, &CreateAt<EnemyEvent4>, { "Button" });
+
+	BindFactory(400, &CreateAt<Door1>, { "Door" });
+	BindFactory(401, &CreateAt<Door2>, { "Door" });
+	BindFactory(402, &CreateAt<Door3>, { "Door" });
+	BindFactory(403, &CreateAt<Door4>, { "Door" });
+	BindFactory(404, &CreateAt<Door5>, { "Door" });
+	BindFactory(405, &CreateAt<Door6>, { "Door" });
+	BindFactory(410, &CreateAt<Door7>, { "Door" });
+	BindFactory(406, &CreateAt<EventDoor>, { "Door" });
+	BindFactory(407, &CreateAt<EventDoor2>, { "Door" });
+	BindFactory(408, &CreateAt<EventDoor3>, { "Door" });
+	BindFactory(409, &CreateAt<EventDoor4>, { "Door" });
+
+	BindFactory(500, &CreateTipsTrigger, { "TipsTrigger_1", 1 });
+	BindFactory(501, &CreateTipsTrigger, { "TipsTrigger_2", 2 });
+	BindFactory(502, &CreateTipsTrigger, { "TipsTrigger_3", 3 });
+	BindFactory(503, &CreateTipsTrigger, { "TipsTrigger_4", 4 });
+
+	BindFactory(999, &CreateAt<EndButton>, { "EndButton" });
+}
+
+void ObjectRegistry::BindFactory(int objectTypeId, ObjectFactory factory, const ObjectPrefab& prefab) {
+	for (auto& objType : objectTypes_) {
+		if (objType.id == objectTypeId) {
+			objType.factory = factory;
+			objType.prefab = prefab;
+			return;
+		}
+	}
+	Novice::ConsolePrintf("[ObjectRegistry] BindFactory: unregistered type %d\n", objectTypeId);
+}
+
+void ObjectRegistry::SpawnAll(const std::vector<ObjectSpawnInfo>& spawns, ObjectSpawnContext& context) {
+	// タイプIDでまとめる（同じタイプ内は配置順のまま）
+	std::vector<const ObjectSpawnInfo*> sorted;
+	sorted.reserve(spawns.size());
+	for (const auto& spawn : spawns) {
+		sorted.push_back(&spawn);
+	}
+	std::stable_sort(sorted.begin(), sorted.end(),
+		[](const ObjectSpawnInfo* a, const ObjectSpawnInfo* b) {
+			return a->objectTypeId < b->objectTypeId;
+		});
+
+	// 生成中に配列が伸び直さないように先に確保
+	context.manager->Reserve(sorted.size());
+
+	size_t begin = 0;
+	while (begin < sorted.size()) {
+		const int typeId = sorted[begin]->objectTypeId;
+		size_t end = begin + 1;
+		while (end < sorted.size() && sorted[end]->objectTypeId == typeId) {
+			++end;
+		}
+
+		const ObjectTypeInfo* objType = GetObjectType(typeId);
+		if (!objType || !objType->factory) {
+			Novice::ConsolePrintf("[ObjectRegistry] Unknown object type: %d (x%d)\n",
+				typeId, static_cast<int>(end - begin));
+			begin = end;
+			continue;
+		}
+
+		// ステージに1つだけのものは最初の配置だけを使う
+		const size_t count = objType->prefab.isUnique ? 1 : end - begin;
+		for (size_t i = begin; i < begin + count; ++i) {
+			objType->factory(context, *objType, *sorted[i]);
+		}
+
+#ifdef _DEBUG
+		Novice::ConsolePrintf("[ObjectRegistry] Spawned %s x%d\n",
+			objType->name.c_str(), static_cast<int>(count));
+#endif
+		begin = end;
+	}
 }
 
 const std::vector<ObjectTypeInfo>& ObjectRegistry::GetAllObjectTypes() {
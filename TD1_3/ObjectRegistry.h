@@ -2,6 +2,32 @@
 #include <vector>
 #include <string>
 
+class GameObject2D;
+class GameObjectManager;
+struct ObjectSpawnInfo;
+struct ObjectTypeInfo;
+
+/// <summary>
+/// 生成時の既定値（プレハブ）
+/// </summary>
+struct ObjectPrefab {
+    std::string spawnTag;    // 生成したオブジェクトに付けるタグ（ゲーム内の検索用）
+    int defaultParam = 0;    // 種類ごとの既定パラメータ（TipsTrigger の tipsId など）
+    bool isUnique = false;   // ステージに1つだけ（2つ目以降の配置は無視する）
+};
+
+/// <summary>
+/// まとめて生成する間に共有する情報
+/// </summary>
+struct ObjectSpawnContext {
+    GameObjectManager* manager = nullptr;
+    GameObject2D* player = nullptr;       // 生成済みのプレイヤー（TipsTrigger などが参照）
+    GameObject2D* worldOrigin = nullptr;  // 生成済みのワールド原点
+};
+
+// 配置データ1つ分を生成する関数（Initialize は Spawn 内の1回だけ）
+using ObjectFactory = GameObject2D* (*)(ObjectSpawnContext& context, const ObjectTypeInfo& type, const ObjectSpawnInfo& spawn);
+
 /// <summary>
 /// オブジェクトタイプの定義（メタデータ）
 /// ゲーム内で使用可能なオブジェクトの「種類」を定義する設計図
@@ -12,6 +38,8 @@ struct ObjectTypeInfo {
     std::string category;    // カテゴリ（System, Player, Enemy, Item等）
     unsigned int color;      // エディタでの表示色（RGBA形式）
     std::string tag;         // ゲーム内で使用するデフォルトタグ
+    ObjectFactory factory = nullptr; // 生成関数（未設定ならゲーム内では生成しない）
+    ObjectPrefab prefab;     // 生成時の既定値
 };
 
 /// <summary>
@@ -39,7 +67,18 @@ public:
     /// <returns>該当するObjectTypeInfo（存在しない場合はnullptr）</returns>
     static const ObjectTypeInfo* GetObjectType(int objectTypeId);
 
+    /// <summary>
+    /// 配置データをタイプごとにまとめて生成する
+    /// タイプID順に生成するので、プレイヤー(100)は TipsTrigger(500～) より先に揃う
+    /// </summary>
+    /// <param name="spawns">マップの配置データ</param>
+    /// <param name="context">生成先のマネージャーと、生成されたプレイヤー等の受け取り先</param>
+    static void SpawnAll(const std::vector<ObjectSpawnInfo>& spawns, ObjectSpawnContext& context);
+
 private:
+    // 登録済みのタイプに生成関数とプレハブを設定する
+    static void BindFactory(int objectTypeId, ObjectFactory factory, const ObjectPrefab& prefab);
+
     static std::vector<ObjectTypeInfo> objectTypes_;  // 全オブジェクトタイプの定義
 };
 
@@ -0,0 +1,66 @@
+﻿#include "ObjectSpawnGrid.h"
+#include <algorithm>
+#include <cmath>
+
+void ObjectSpawnGrid::Insert(ObjectSpawnId id, const Vector2& position) {
+    cells_[CellKey(ToCell(position.x), ToCell(position.y))].push_back(id);
+}
+
+void ObjectSpawnGrid::Remove(ObjectSpawnId id, const Vector2& position) {
+    auto it = cells_.find(CellKey(ToCell(position.x), ToCell(position.y)));
+    if (it == cells_.end()) return;
+
+    // セル内の並びは問わないので末尾と入れ替えて消す
+    auto& ids = it->second;
+    auto found = std::find(ids.begin(), ids.end(), id);
+    if (found != ids.end()) {
+        *found = ids.back();
+        ids.pop_back();
+    }
+    if (ids.empty()) {
+        cells_.erase(it);
+    }
+}
+
+void ObjectSpawnGrid::Move(ObjectSpawnId id, const Vector2& from, const Vector2& to) {
+    if (ToCell(from.x) == ToCell(to.x) && ToCell(from.y) == ToCell(to.y)) return;
+
+    Remove(id, from);
+    Insert(id, to);
+}
+
+void ObjectSpawnGrid::QueryCells(const Vector2& min, const Vector2& max, std::vector<ObjectSpawnId>& out) const {
+    const int cellMinX = ToCell((std::min)(min.x, max.x));
+    const int cellMaxX = ToCell((std::max)(min.x, max.x));
+    const int cellMinY = ToCell((std::min)(min.y, max.y));
+    const int cellMaxY = ToCell((std::max)(min.y, max.y));
+
+    // 大きくズームアウトしているときなど、範囲のセル数が使用中のセルより多ければ使用中のセルを全部見る
+    const int64_t rangeCells = (static_cast<int64_t>(cellMaxX) - cellMinX + 1) * (static_cast<int64_t>(cellMaxY) - cellMinY + 1);
+    if (rangeCells > static_cast<int64_t>(cells_.size())) {
+        for (const auto& [key, ids] : cells_) {
+            const int cellX = static_cast<int32_t>(static_cast<uint32_t>(key >> 32));
+            const int cellY = static_cast<int32_t>(static_cast<uint32_t>(key));
+            if (cellX < cellMinX || cellX > cellMaxX || cellY < cellMinY || cellY > cellMaxY) continue;
+            out.insert(out.end(), ids.begin(), ids.end());
+        }
+        return;
+    }
+
+    for (int cellY = cellMinY; cellY <= cellMaxY; ++cellY) {
+        for (int cellX = cellMinX; cellX <= cellMaxX; ++cellX) {
+            auto it = cells_.find(CellKey(cellX, cellY));
+            if (it != cells_.end()) {
+                out.insert(out.end(), it->second.begin(), it->second.end());
+            }
+        }
+    }
+}
+
+int ObjectSpawnGrid::ToCell(float value) const {
+    return static_cast<int>(std::floor(value / cellSize_));
+}
+
+uint64_t ObjectSpawnGrid::CellKey(int cellX, int cellY) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32) | static_cast<uint32_t>(cellY);
+}
@@ -0,0 +1,39 @@
+﻿#pragma once
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "Vector2.h"
+
+// オブジェクトスポーンの安定ID（MapData 内で振る。ファイルには保存しない）
+using ObjectSpawnId = uint32_t;
+constexpr ObjectSpawnId kInvalidObjectSpawnId = 0;
+
+/// <summary>
+/// オブジェクトスポーンの位置を一定サイズのセルに分けて持つ空間インデックス
+/// スポーンはマップ外にも置けるので、セルは座標をキーにしたハッシュで持つ
+/// </summary>
+class ObjectSpawnGrid {
+public:
+    explicit ObjectSpawnGrid(float cellSize = 256.0f) : cellSize_(cellSize) {}
+
+    void Clear() { cells_.clear(); }
+
+    void Insert(ObjectSpawnId id, const Vector2& position);
+    void Remove(ObjectSpawnId id, const Vector2& position);
+
+    // 位置の変更（同じセル内なら何もしない）
+    void Move(ObjectSpawnId id, const Vector2& from, const Vector2& to);
+
+    /// <summary>
+    /// 矩形と重なるセルにある ID を集める
+    /// セル単位の絞り込みなので、正確な判定は呼び出し側で位置を見て行う
+    /// </summary>
+    void QueryCells(const Vector2& min, const Vector2& max, std::vector<ObjectSpawnId>& out) const;
+
+private:
+    int ToCell(float value) const;
+    static uint64_t CellKey(int cellX, int cellY);
+
+    float cellSize_;
+    std::unordered_map<uint64_t, std::vector<ObjectSpawnId>> cells_;
+};
@@ -35,6 +35,7 @@ public:
 	void CheckGroundCollision(float groundY);
 
 	bool IsAlive() const { return isAlive_; }
+	void Kill() { isAlive_ = false; }
 	ParticleType GetType() const { return type_; }
 	void SetType(ParticleType type) { type_ = type; }
 	void SetBehavior(ParticleBehavior behavior) { behavior_ = behavior; }
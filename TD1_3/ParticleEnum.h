@@ -41,5 +41,10 @@ enum class ParticleType {
 	Sparkle,     // キラキラ（particle_sparkle.png）
 	Slash,       // 斬撃・軌跡（particle_scratch.png）
 	SmokeCloud,  // 雲・煙（particle_smoke.png）
-	DigitalSpark
-};
\ No newline at end of file
+	DigitalSpark,
+
+	Count // 総数（配列のサイズに使う）
+};
+
+// パーティクルタイプの総数
+constexpr int kParticleTypeCount = static_cast<int>(ParticleType::Count);
\ No newline at end of file
@@ -3,12 +3,15 @@
 #include <cstdlib>
 #include <algorithm>
 #include "JsonUtil.h"
+#include "AsyncIO.h"
 #include "json.hpp"
 #include "Camera2D.h"
 #include "Effect.h"
 #include "TextureManager.h"
 
 #include "ParticleRegistry.h"
+#include "AnimationClip.h"
+#include "DebugStats.h"
 
 // nlohmann/json の警告を抑制
 #pragma warning(push)
@@ -37,6 +40,12 @@ static const float kDeg2Rad = 3.14159265f / 180.0f;
 static const std::string kDefaultParamPath = "Resources/Data/particle_params.json";
 
 ParticleManager::ParticleManager() {
+	// 全スロットを空きにする（後ろから積んで 0 番から使われるようにする）
+	freeList_.reserve(kMaxParticles);
+	for (int i = kMaxParticles - 1; i >= 0; --i) {
+		freeList_.push_back(i);
+	}
+
 	Initialize();
 }
 
@@ -62,14 +71,19 @@ void ParticleManager::Initialize() {
 
 #ifdef _DEBUG
 	Novice::ConsolePrintf("=== ParticleManager::Initialize Complete ===\n");
-	Novice::ConsolePrintf("  Loaded %d particle types\n", static_cast<int>(params_.size()));
+	int loadedCount = 0;
+	for (bool has : hasParam_) {
+		if (has) loadedCount++;
+	}
+	Novice::ConsolePrintf("  Loaded %d particle types\n", loadedCount);
 
 	// 全パラメータのテクスチャハンドルを確認
-	for (const auto& [type, param] : params_) {
-		const auto* info = ParticleRegistry::GetParticleType(type);
+	for (int i = 0; i < kParticleTypeCount; ++i) {
+		if (!hasParam_[i]) continue;
+		const auto* info = ParticleRegistry::GetParticleType(static_cast<ParticleType>(i));
 		if (info) {
 			Novice::ConsolePrintf("  Final: %s -> Handle=%d\n",
-				info->name.c_str(), param.textureHandle);
+				info->name.c_str(), params_[i].textureHandle);
 		}
 	}
 #endif
@@ -100,13 +114,41 @@ BlendMode ParticleManager::StringToBlendMode(const std::string& str) {
 	return kBlendModeNormal;
 }
 
+// 優先度変換ヘルパー
+const char* ParticleManager::PriorityToString(ParticlePriority priority) {
+	switch (priority) {
+	case ParticlePriority::Low: return "Low";
+	case ParticlePriority::Normal: return "Normal";
+	case ParticlePriority::High: return "High";
+	case ParticlePriority::Critical: return "Critical";
+	default: return "Normal";
+	}
+}
+
+ParticlePriority ParticleManager::StringToPriority(const std::string& str, ParticlePriority defaultValue) {
+	if (str == "Low") return ParticlePriority::Low;
+	if (str == "Normal") return ParticlePriority::Normal;
+	if (str == "High") return ParticlePriority::High;
+	if (str == "Critical") return ParticlePriority::Critical;
+	return defaultValue;
+}
+
 void ParticleManager::Update(float deltaTime) {
+	// エディタなどで書き換えられたパラメータの事前計算をやり直す
+	for (int i = 0; i < kParticleTypeCount; ++i) {
+		if (derivedDirty_[i]) {
+			RefreshDerived(static_cast<ParticleType>(i));
+		}
+	}
+
 	// 連続発生の処理（追従モード対応）
-	for (auto& [type, emitter] : continuousEmitters_) {
+	for (int i = 0; i < kParticleTypeCount; ++i) {
+		ContinuousEmitter& emitter = continuousEmitters_[i];
 		if (!emitter.isActive) continue;
-		if (params_.find(type) == params_.end()) continue;
+		if (!hasParam_[i]) continue;
 
-		const ParticleParam& param = params_[type];
+		const ParticleType type = static_cast<ParticleType>(i);
+		const ParticleParam& param = params_[i];
 		if (!param.isContinuous) continue;
 
 		// タイマー更新
@@ -138,14 +180,15 @@ void ParticleManager::Update(float deltaTime) {
 	}
 
 	// パーティクルの更新
-	for (auto& p : particles_) {
+	for (int i = 0; i < kMaxParticles; ++i) {
+		Particle& p = particles_[i];
 		if (p.IsAlive()) {
 			// 環境パーティクルの特殊処理
 			ParticleType pType = p.GetType();
 
 			// 雪の横揺れ処理
-			if (pType == ParticleType::Snow && params_.find(pType) != params_.end()) {
-				const ParticleParam& param = params_[pType];
+			if (pType == ParticleType::Snow && hasParam_[ToIndex(pType)]) {
+				const ParticleParam& param = params_[ToIndex(pType)];
 				if (param.windStrength > 0.0f) {
 					// sine波で横揺れ
 					float windOffset = sinf(p.GetPosition().y * 0.01f) * param.windStrength * deltaTime / 60.0f;
@@ -163,47 +206,70 @@ void ParticleManager::Update(float deltaTime) {
 				p.CheckGroundCollision(groundLevel_);
 			}
 		}
+
+		// 寿命が尽きたスロットを空きに戻す
+		if (slotUsed_[i] && !p.IsAlive()) {
+			ReleaseSlot(i);
+		}
 	}
+	DebugStats::GetInstance().SetCounter(DebugCounter::ActiveParticles, GetLiveCount());
 }
 
 // ========== Draw メソッド ==========
 void ParticleManager::Draw(const Camera2D& camera) {
+	// 次フレームの発生判定（カリング・LOD）用に表示範囲を覚えておく
+	SetView(camera);
+
 	// カメラから ViewProjectionMatrix を取得
-	Matrix3x3 vpMatrix = camera.GetVpVpMatrix();
+	const Affine2x3& vpMatrix = camera.GetVpVpAffine();
 
 	// ズーム倍率（描画サイズにも反映させる）
 	const float cameraZoom = camera.GetZoom();
 
-	// パーティクルタイプごとにブレンドモードをグループ化して描画
-	for (auto it = params_.begin(); it != params_.end(); ++it) {
-		ParticleType type = it->first;
-		const ParticleParam& param = it->second;
+	// 生存パーティクルを、タイプに設定されたブレンドモードごとに振り分ける（1回の走査）
+	for (auto& bucket : drawBuckets_) {
+		bucket.clear();
+	}
+	for (int i = 0; i < kMaxParticles; ++i) {
+		const Particle& p = particles_[i];
+		if (!p.IsAlive() || !HasParam(p.GetType())) continue;
+
+		const int blend = static_cast<int>(params_[ToIndex(p.GetType())].blendMode);
+		if (blend < 0 || blend >= kCountOfBlendMode) continue;
+		drawBuckets_[blend].push_back(i);
+	}
 
-		Novice::SetBlendMode(param.blendMode);
+	// ブレンドモードごとにまとめて描画
+	for (int blend = 0; blend < kCountOfBlendMode; ++blend) {
+		const auto& bucket = drawBuckets_[blend];
+		if (bucket.empty()) continue;
 
-		for (auto& p : particles_) {
-			if (!p.IsAlive() || p.GetType() != type) continue;
+		Novice::SetBlendMode(static_cast<BlendMode>(blend));
+
+		for (int index : bucket) {
+			const Particle& p = particles_[index];
+			const ParticleDerived& derived = derived_[ToIndex(p.GetType())];
 
 			// ワールド座標（中心）
 			Vector2 worldPos = p.GetPosition();
 
-			// テクスチャ情報
-			int texWidth, texHeight;
-			Novice::GetTextureSize(p.GetTextureHandle(), &texWidth, &texHeight);
-
-			// ソース矩形
+			// ソース矩形（タイプのテクスチャなら事前計算済みの表を使う）
 			int srcX = 0, srcY = 0;
-			int srcW = texWidth, srcH = texHeight;
-			if (p.UseAnimation()) {
-				int divX = p.GetDivX();
-				int divY = p.GetDivY();
-				int frame = p.GetCurrentFrame();
-				srcW = texWidth / divX;
-				srcH = texHeight / divY;
-				int frameX = frame % divX;
-				int frameY = frame / divX;
-				srcX = frameX * srcW;
-				srcY = frameY * srcH;
+			int srcW = 0, srcH = 0;
+			if (derived.clip && derived.clip->graphHandle == p.GetTextureHandle() && !derived.clip->frames.empty()) {
+				int frame = p.UseAnimation() ? p.GetCurrentFrame() : 0;
+				if (frame < 0 || frame >= static_cast<int>(derived.clip->frames.size())) {
+					frame = 0;
+				}
+				const AnimationFrameRect& rect = derived.clip->frames[frame];
+				srcX = rect.x;
+				srcY = rect.y;
+				srcW = rect.w;
+				srcH = rect.h;
+			}
+			else {
+				// 残像など、タイプと別のテクスチャを使うもの
+				Novice::GetTextureSize(p.GetTextureHandle(), &srcW, &srcH);
 			}
 
 			// 描画サイズ（ピクセル基準）
@@ -239,15 +305,17 @@ void ParticleManager::Draw(const Camera2D& camera) {
 					};
 					};
 
-				Vector2 wLT = RotateAddCenter(ltLocal);
-				Vector2 wRT = RotateAddCenter(rtLocal);
-				Vector2 wLB = RotateAddCenter(lbLocal);
-				Vector2 wRB = RotateAddCenter(rbLocal);
+				Vector2 world[4] = {
+					RotateAddCenter(ltLocal), RotateAddCenter(rtLocal),
+					RotateAddCenter(lbLocal), RotateAddCenter(rbLocal)
+				};
+				Vector2 screen[4];
+				Affine2x3::TransformPoints(world, screen, 4, vpMatrix);
 
-				Vector2 vLT = Matrix3x3::Transform(wLT, vpMatrix);
-				Vector2 vRT = Matrix3x3::Transform(wRT, vpMatrix);
-				Vector2 vLB = Matrix3x3::Transform(wLB, vpMatrix);
-				Vector2 vRB = Matrix3x3::Transform(wRB, vpMatrix);
+				const Vector2& vLT = screen[0];
+				const Vector2& vRT = screen[1];
+				const Vector2& vLB = screen[2];
+				const Vector2& vRB = screen[3];
 
 				Novice::DrawQuad(
 					static_cast<int>(vLT.x), static_cast<int>(vLT.y),
@@ -260,7 +328,7 @@ void ParticleManager::Draw(const Camera2D& camera) {
 				);
 			}
 			else {
-				Vector2 screenPos = Matrix3x3::Transform(worldPos, vpMatrix);
+				Vector2 screenPos = Affine2x3::Transform(worldPos, vpMatrix);
 
 				float offsetX = screenPos.x - drawWidth * 0.5f;
 				float offsetY = screenPos.y - drawHeight * 0.5f;
@@ -284,14 +352,15 @@ void ParticleManager::Draw(const Camera2D& camera) {
 // ========== Emit メソッド（拡張版） ==========
 void ParticleManager::Emit(ParticleType type, const Vector2& pos) {
 	// 指定されたタイプの設定を取得
-	if (params_.find(type) == params_.end()) {
+	if (!HasParam(type)) {
 #ifdef _DEBUG
 		Novice::ConsolePrintf("ParticleManager::Emit - Invalid ParticleType\n");
 #endif
 		return;
 	}
 
-	const ParticleParam& param = params_[type];
+	const ParticleParam& param = params_[ToIndex(type)];
+	const ParticleDerived& derived = GetDerived(type);
 
 	// テクスチャが無効な場合はスキップ
 	if (param.textureHandle < 0) {
@@ -301,9 +370,24 @@ void ParticleManager::Emit(ParticleType type, const Vector2& pos) {
 		return;
 	}
 
-	// 設定された個数ぶん発生させる
-	for (int i = 0; i < param.count; ++i) {
-		Particle& p = GetNextParticle();
+	// 画面外なら発生させない
+	ParticleTypeStats& stats = stats_[ToIndex(type)];
+	if (!IsEmitVisible(pos, param)) {
+		stats.culled += param.count;
+		return;
+	}
+
+	// 設定された個数ぶん発生させる（遠い・小さく見えるときは減らす）
+	const int count = ComputeLodCount(pos, param);
+	stats.lodReduced += param.count - count;
+
+	for (int i = 0; i < count; ++i) {
+		Particle* slot = AllocateParticle(type);
+		if (!slot) {
+			stats.dropped += count - i;
+			break;
+		}
+		Particle& p = *slot;
 
 		// パーティクルタイプを設定
 		p.SetType(type);
@@ -316,13 +400,11 @@ void ParticleManager::Emit(ParticleType type, const Vector2& pos) {
 
 		// 速度ベクトル
 		float speed = RandomFloat(param.speedMin, param.speedMax);
-		float halfRange = param.angleRange / 2.0f;
-		float angleDeg = param.angleBase + RandomFloat(-halfRange, halfRange);
-		float angleRad = angleDeg * (3.14159265f / 180.0f);
+		float angleRad = derived.angleBaseRad + RandomFloat(-derived.halfRangeRad, derived.halfRangeRad);
 		Vector2 vel = { cosf(angleRad) * speed, sinf(angleRad) * speed };
 
-		// 加速度の合成（重力 + acceleration）
-		Vector2 totalAcc = param.gravity + param.acceleration;
+		// 加速度の合成（重力 + acceleration、事前計算済み）
+		const Vector2& totalAcc = derived.totalAcc;
 
 		// 回転速度のランダム化
 		float rotSpeed = RandomFloat(param.rotationSpeedMin, param.rotationSpeedMax);
@@ -388,13 +470,30 @@ Vector2 ParticleManager::GenerateEmitPosition(const Vector2& basePos, const Part
 
 // ターゲット指定版 Emit（Homing用）
 void ParticleManager::EmitWithTarget(ParticleType type, const Vector2& pos, const Vector2* target) {
-	if (params_.find(type) == params_.end()) return;
+	if (!HasParam(type)) return;
 
-	const ParticleParam& param = params_[type];
+	const ParticleParam& param = params_[ToIndex(type)];
 	if (param.textureHandle < 0) return;
+	const ParticleDerived& derived = GetDerived(type);
+
+	// 追尾先があるもの（チャージなど）はプレイヤーに集まってくるので画面外でも出す
+	ParticleTypeStats& stats = stats_[ToIndex(type)];
+	const bool isHoming = param.useHoming && target != nullptr;
+	if (!isHoming && !IsEmitVisible(pos, param)) {
+		stats.culled += param.count;
+		return;
+	}
+
+	const int count = ComputeLodCount(pos, param);
+	stats.lodReduced += param.count - count;
 
-	for (int i = 0; i < param.count; ++i) {
-		Particle& p = GetNextParticle();
+	for (int i = 0; i < count; ++i) {
+		Particle* slot = AllocateParticle(type);
+		if (!slot) {
+			stats.dropped += count - i;
+			break;
+		}
+		Particle& p = *slot;
 		p.SetType(type);
 
 		int life = static_cast<int>(RandomFloat(static_cast<float>(param.lifeMin), static_cast<float>(param.lifeMax)));
@@ -404,12 +503,10 @@ void ParticleManager::EmitWithTarget(ParticleType type, const Vector2& pos, cons
 
 		// 速度ベクトル
 		float speed = RandomFloat(param.speedMin, param.speedMax);
-		float halfRange = param.angleRange / 2.0f;
-		float angleDeg = param.angleBase + RandomFloat(-halfRange, halfRange);
-		float angleRad = angleDeg * (3.14159265f / 180.0f);
+		float angleRad = derived.angleBaseRad + RandomFloat(-derived.halfRangeRad, derived.halfRangeRad);
 		Vector2 vel = { cosf(angleRad) * speed, sinf(angleRad) * speed };
 
-		Vector2 totalAcc = param.gravity + param.acceleration;
+		const Vector2& totalAcc = derived.totalAcc;
 		float rotSpeed = RandomFloat(param.rotationSpeedMin, param.rotationSpeedMax);
 		float size = RandomFloat(param.sizeMin, param.sizeMax);
 
@@ -444,7 +541,13 @@ void ParticleManager::EmitDashGhost(const Vector2& pos, float scale, float rotat
 	isFlipX; // 未使用警告回避
 	if (texHandle < 0) return;
 
-	Particle& p = GetNextParticle();
+	// 残像は Dust 扱いで予算・統計を共有する
+	Particle* slot = AllocateParticle(ParticleType::Dust);
+	if (!slot) {
+		stats_[ToIndex(ParticleType::Dust)].dropped++;
+		return;
+	}
+	Particle& p = *slot;
 
 	// Ghost タイプのパーティクルとして初期化
 	p.Initialize(
@@ -470,17 +573,152 @@ void ParticleManager::EmitDashGhost(const Vector2& pos, float scale, float rotat
 
 void ParticleManager::Clear() {
 	for (auto& p : particles_) {
-		p.Initialize(
-			{ 0,0 }, { 0,0 }, { 0,0 }, 0, 0,
-			1.0f, 1.0f, WHITE, 0xFFFFFF00,
-			0.0f, 0.0f, kBlendModeNone,
-			0.0f,                        // 描画サイズ
-			false, 1, 1, 1, 0.0f         // アニメーションなし
-		);
+		p.Kill();
+	}
+
+	freeList_.clear();
+	for (int i = kMaxParticles - 1; i >= 0; --i) {
+		freeList_.push_back(i);
+	}
+	slotUsed_.fill(false);
+	for (auto& stats : stats_) {
+		stats.live = 0;
 	}
 	nextIndex_ = 0;
 }
 
+void ParticleManager::ResetStats() {
+	// 生存数はそのまま、累計値だけを 0 に戻す
+	for (auto& stats : stats_) {
+		const int live = stats.live;
+		stats = ParticleTypeStats{};
+		stats.live = live;
+		stats.peak = live;
+	}
+}
+
+// =================================
+//  予算・カリング・LOD
+// =================================
+void ParticleManager::SetView(const Camera2D& camera) {
+	const Vector2& visibleMin = camera.GetVisibleMin();
+	const Vector2& visibleMax = camera.GetVisibleMax();
+
+	viewCenter_ = { (visibleMin.x + visibleMax.x) * 0.5f, (visibleMin.y + visibleMax.y) * 0.5f };
+	viewHalfSize_ = { (visibleMax.x - visibleMin.x) * 0.5f, (visibleMax.y - visibleMin.y) * 0.5f };
+	viewZoom_ = camera.GetZoom();
+	hasView_ = true;
+}
+
+bool ParticleManager::IsEmitVisible(const Vector2& pos, const ParticleParam& param) const {
+	if (!isCullingEnabled_ || !hasView_) return true;
+
+	// 発生源の広がり + 粒の大きさ + 寿命の間に飛ぶ距離（上限あり）ぶん余白をとる
+	Vector2 extent = { param.emitRange.x * 0.5f, param.emitRange.y * 0.5f };
+	if (param.emitterShape != EmitterShape::Point) {
+		extent.x = std::fmax(extent.x, param.emitterSize.x * 0.5f);
+		extent.y = std::fmax(extent.y, param.emitterSize.y * 0.5f);
+	}
+	const float travel = std::fmin(param.speedMax * static_cast<float>(param.lifeMax) / 60.0f, 512.0f);
+	const float margin = param.sizeMax * param.scaleStart + travel + 32.0f;
+
+	return std::fabs(pos.x - viewCenter_.x) <= viewHalfSize_.x + extent.x + margin &&
+		std::fabs(pos.y - viewCenter_.y) <= viewHalfSize_.y + extent.y + margin;
+}
+
+int ParticleManager::ComputeLodCount(const Vector2& pos, const ParticleParam& param) const {
+	if (param.count <= 1) return param.count;
+	if (!isLodEnabled_ || !param.useLod || !hasView_) return param.count;
+
+	float lod = 1.0f;
+
+	// ズームアウトしているほど粒が小さく見えるので減らす
+	if (viewZoom_ < 1.0f) {
+		lod *= viewZoom_;
+	}
+
+	// 画面中心から離れるほど減らす（半画面の半分より外で、画面端で 0.5 倍）
+	const float halfExtent = std::fmax(viewHalfSize_.x, viewHalfSize_.y);
+	if (halfExtent > 0.0f) {
+		const float dx = pos.x - viewCenter_.x;
+		const float dy = pos.y - viewCenter_.y;
+		const float t = std::sqrt(dx * dx + dy * dy) / halfExtent;
+		if (t > 0.5f) {
+			lod *= 1.0f - 0.5f * std::fmin((t - 0.5f) / 0.5f, 1.0f);
+		}
+	}
+
+	// 画面上で数ピクセルにしかならない粒はさらに減らす
+	const float screenSize = param.sizeMax * param.scaleStart * viewZoom_;
+	if (screenSize < 4.0f) {
+		lod *= 0.5f;
+	}
+
+	lod = std::fmax(lod, 0.25f);
+	const int count = static_cast<int>(static_cast<float>(param.count) * lod + 0.5f);
+	return count < 1 ? 1 : count;
+}
+
+Particle* ParticleManager::AllocateParticle(ParticleType type) {
+	if (!IsValidType(type)) return nullptr;
+
+	const int typeIndex = ToIndex(type);
+	ParticleTypeStats& stats = stats_[typeIndex];
+	const ParticlePriority priority = hasParam_[typeIndex] ? params_[typeIndex].priority : ParticlePriority::Normal;
+
+	// タイプごとの予算
+	const int budget = hasParam_[typeIndex] ? params_[typeIndex].budget : 0;
+	if (budget > 0 && stats.live >= budget) {
+		return nullptr;
+	}
+
+	int index = -1;
+	if (!freeList_.empty()) {
+		index = freeList_.back();
+		freeList_.pop_back();
+	}
+	else {
+		// 空きがなければ、自分より優先度の低い生存中のものを上書きする（Low を優先して探す）
+		int victim = -1;
+		for (int n = 0; n < kMaxParticles; ++n) {
+			const int i = (nextIndex_ + n) % kMaxParticles;
+			if (slotPriority_[i] >= priority) continue;
+			if (victim < 0 || slotPriority_[i] < slotPriority_[victim]) {
+				victim = i;
+				if (slotPriority_[i] == ParticlePriority::Low) break;
+			}
+		}
+		if (victim < 0) {
+			return nullptr;
+		}
+
+		nextIndex_ = (victim + 1) % kMaxParticles;
+		stats_[ToIndex(slotType_[victim])].evicted++;
+		particles_[victim].Kill();
+		ReleaseSlot(victim);
+		freeList_.pop_back();
+		index = victim;
+	}
+
+	slotUsed_[index] = true;
+	slotType_[index] = type;
+	slotPriority_[index] = priority;
+
+	stats.live++;
+	if (stats.live > stats.peak) {
+		stats.peak = stats.live;
+	}
+	return &particles_[index];
+}
+
+void ParticleManager::ReleaseSlot(int index) {
+	if (!slotUsed_[index]) return;
+
+	slotUsed_[index] = false;
+	stats_[ToIndex(slotType_[index])].live--;
+	freeList_.push_back(index);
+}
+
 // =================================
 //  連続発生の管理メソッド（既存）
 // =================================
@@ -489,9 +727,9 @@ void ParticleManager::StartContinuousEmit(ParticleType type, const Vector2& pos)
 }
 
 void ParticleManager::StartContinuousEmitWithTarget(ParticleType type, const Vector2& pos, const Vector2* target) {
-	if (params_.find(type) == params_.end()) return;
+	if (!HasParam(type)) return;
 
-	ContinuousEmitter& emitter = continuousEmitters_[type];
+	ContinuousEmitter& emitter = continuousEmitters_[ToIndex(type)];
 	emitter.type = type;
 	emitter.position = pos;
 	emitter.followMode = EmitterFollowMode::None;  // デフォルトは固定
@@ -502,13 +740,13 @@ void ParticleManager::StartContinuousEmitWithTarget(ParticleType type, const Vec
 }
 
 void ParticleManager::StopContinuousEmit(ParticleType type) {
-	if (continuousEmitters_.find(type) != continuousEmitters_.end()) {
-		continuousEmitters_[type].isActive = false;
+	if (IsValidType(type)) {
+		continuousEmitters_[ToIndex(type)].isActive = false;
 	}
 }
 
 void ParticleManager::StopAllContinuousEmit() {
-	for (auto& [type, emitter] : continuousEmitters_) {
+	for (auto& emitter : continuousEmitters_) {
 		emitter.isActive = false;
 	}
 }
@@ -517,34 +755,37 @@ void ParticleManager::StopAllContinuousEmit() {
 //  環境パーティクル専用API
 // =================================
 void ParticleManager::StartEnvironmentEffect(ParticleType type, EmitterFollowMode mode, const Vector2& basePos) {
-	if (params_.find(type) == params_.end()) return;
+	if (!HasParam(type)) return;
 
 	// 強制設定：環境パーティクルは必ず連続発生にする
-	params_[type].isContinuous = true;
-	if (params_[type].emitInterval <= 0.0f) {
+	ParticleParam& param = params_[ToIndex(type)];
+	param.isContinuous = true;
+	if (param.emitInterval <= 0.0f) {
 		switch (type) {
 		case ParticleType::Rain:
-			params_[type].emitInterval = 0.1f;
-			params_[type].emitterShape = EmitterShape::Line;
-			params_[type].emitterSize = { 1280.0f, 0.0f };
+			param.emitInterval = 0.1f;
+			param.emitterShape = EmitterShape::Line;
+			param.emitterSize = { 1280.0f, 0.0f };
 			break;
 		case ParticleType::Snow:
-			params_[type].emitInterval = 0.15f;
-			params_[type].emitterShape = EmitterShape::Line;
-			params_[type].emitterSize = { 1280.0f, 0.0f };
+			param.emitInterval = 0.15f;
+			param.emitterShape = EmitterShape::Line;
+			param.emitterSize = { 1280.0f, 0.0f };
 			break;
 		case ParticleType::Orb:
-			params_[type].emitInterval = 0.2f;
-			params_[type].emitterShape = EmitterShape::Rectangle;
-			params_[type].emitterSize = { 1280.0f, 720.0f };
+			param.emitInterval = 0.2f;
+			param.emitterShape = EmitterShape::Rectangle;
+			param.emitterSize = { 1280.0f, 720.0f };
 			break;
 		default:
-			params_[type].emitInterval = 0.1f;
+			param.emitInterval = 0.1f;
 			break;
 		}
 	}
 
-	ContinuousEmitter& emitter = continuousEmitters_[type];
+	RefreshDerived(type);
+
+	ContinuousEmitter& emitter = continuousEmitters_[ToIndex(type)];
 	emitter.type = type;
 	emitter.position = basePos;
 	emitter.followMode = mode;
@@ -561,8 +802,8 @@ void ParticleManager::StartEnvironmentEffect(ParticleType type, EmitterFollowMod
 	case EmitterFollowMode::WorldPoint: modeName = "WorldPoint"; break;
 	}
 	Novice::ConsolePrintf("[INFO] StartEnvironmentEffect: Type=%d, Mode=%s, isContinuous=%d, Interval=%.2f, EmitterShape=%d\n",
-		static_cast<int>(type), modeName, params_[type].isContinuous, params_[type].emitInterval,
-		static_cast<int>(params_[type].emitterShape));
+		static_cast<int>(type), modeName, param.isContinuous, param.emitInterval,
+		static_cast<int>(param.emitterShape));
 #endif
 }
 
@@ -571,20 +812,20 @@ void ParticleManager::StopEnvironmentEffect(ParticleType type) {
 }
 
 void ParticleManager::UpdateEnvironmentParams(ParticleType type, const ParticleParam& newParams) {
-	if (params_.find(type) != params_.end()) {
-		params_[type] = newParams;
+	if (HasParam(type)) {
+		SetParam(type, newParams);
 	}
 }
 
 void ParticleManager::SetFollowTarget(ParticleType type, const Vector2* target) {
-	if (continuousEmitters_.find(type) != continuousEmitters_.end()) {
-		continuousEmitters_[type].followTarget = target;
+	if (IsValidType(type)) {
+		continuousEmitters_[ToIndex(type)].followTarget = target;
 	}
 }
 
 void ParticleManager::UpdateFollowPosition(ParticleType type, const Vector2& newPos) {
-	if (continuousEmitters_.find(type) != continuousEmitters_.end()) {
-		continuousEmitters_[type].position = newPos;
+	if (IsValidType(type)) {
+		continuousEmitters_[ToIndex(type)].position = newPos;
 	}
 }
 
@@ -593,13 +834,57 @@ void ParticleManager::SetGroundLevel(float groundY) {
 }
 
 ParticleParam* ParticleManager::GetParam(ParticleType type) {
-	auto it = params_.find(type);
-	return (it != params_.end()) ? &it->second : nullptr;
+	if (!HasParam(type)) return nullptr;
+
+	// 書き換えられる可能性があるので、次に使うときに事前計算をやり直す
+	derivedDirty_[ToIndex(type)] = true;
+	return &params_[ToIndex(type)];
 }
 
 const ParticleParam* ParticleManager::GetParam(ParticleType type) const {
-	auto it = params_.find(type);
-	return (it != params_.end()) ? &it->second : nullptr;
+	return HasParam(type) ? &params_[ToIndex(type)] : nullptr;
+}
+
+void ParticleManager::SetParam(ParticleType type, const ParticleParam& param) {
+	if (!IsValidType(type)) return;
+
+	params_[ToIndex(type)] = param;
+	hasParam_[ToIndex(type)] = true;
+	RefreshDerived(type);
+}
+
+void ParticleManager::ClearParams() {
+	hasParam_.fill(false);
+	derived_.fill(ParticleDerived{});
+	derivedDirty_.fill(false);
+}
+
+const ParticleManager::ParticleDerived& ParticleManager::GetDerived(ParticleType type) {
+	if (derivedDirty_[ToIndex(type)]) {
+		RefreshDerived(type);
+	}
+	return derived_[ToIndex(type)];
+}
+
+void ParticleManager::RefreshDerived(ParticleType type) {
+	const int index = ToIndex(type);
+	const ParticleParam& param = params_[index];
+	ParticleDerived& derived = derived_[index];
+
+	// テクスチャサイズとフレームごとのソース矩形（同じ画像・分割なら共有される）
+	if (param.useAnimation) {
+		derived.clip = AnimationClipRegistry::GetInstance().GetClip(
+			param.textureHandle, param.divX, param.divY, param.totalFrames, param.animSpeed, true);
+	}
+	else {
+		derived.clip = AnimationClipRegistry::GetInstance().GetClip(param.textureHandle, 1, 1, 1, 0.0f, false);
+	}
+
+	derived.angleBaseRad = param.angleBase * kDeg2Rad;
+	derived.halfRangeRad = param.angleRange * 0.5f * kDeg2Rad;
+	derived.totalAcc = param.gravity + param.acceleration;
+
+	derivedDirty_[index] = false;
 }
 
 void ParticleManager::LoadCommonResources() {
@@ -611,20 +896,21 @@ void ParticleManager::LoadCommonResources() {
 
 	for (const auto& typeInfo : allTypes) {
 		// エントリが存在しない場合は作成
-		if (params_.find(typeInfo.type) == params_.end()) {
-			params_[typeInfo.type] = GenerateDefaultParam(typeInfo.type);
+		if (!HasParam(typeInfo.type)) {
+			SetParam(typeInfo.type, GenerateDefaultParam(typeInfo.type));
 		}
 
 		// テクスチャを再取得
 		int texHandle = TextureManager::GetInstance().GetTexture(typeInfo.defaultTexture);
-		params_[typeInfo.type].textureHandle = texHandle;
+		params_[ToIndex(typeInfo.type)].textureHandle = texHandle;
+		RefreshDerived(typeInfo.type);
 
 #ifdef _DEBUG
 		Novice::ConsolePrintf("  %s: TextureId=%d -> Handle=%d (Before: %d)\n",
 			typeInfo.name.c_str(),
 			static_cast<int>(typeInfo.defaultTexture),
 			texHandle,
-			params_[typeInfo.type].textureHandle);
+			params_[ToIndex(typeInfo.type)].textureHandle);
 #endif
 	}
 
@@ -633,12 +919,6 @@ void ParticleManager::LoadCommonResources() {
 #endif
 }
 
-Particle& ParticleManager::GetNextParticle() {
-	Particle& p = particles_[nextIndex_];
-	nextIndex_ = (nextIndex_ + 1) % kMaxParticles;
-	return p;
-}
-
 float ParticleManager::RandomFloat(float min, float max) {
 	if (min >= max) return min;
 	return min + static_cast<float>(rand()) / (static_cast<float>(RAND_MAX / (max - min)));
@@ -654,23 +934,13 @@ void ParticleManager::DrawDebugWindow() {
 	ImGui::InputText("File Path", filepath, sizeof(filepath));
 
 	ImGui::BeginGroup();
+	// 結果は完了時にコンソールへ出る
 	if (ImGui::Button("Save Parameters", ImVec2(140, 30))) {
-		if (SaveParamsToJson(filepath)) {
-			Novice::ConsolePrintf("Successfully saved to: %s\n", filepath);
-		}
-		else {
-			Novice::ConsolePrintf("Failed to save to: %s\n", filepath);
-		}
+		SaveParamsToJsonAsync(filepath);
 	}
 	ImGui::SameLine();
 	if (ImGui::Button("Load Parameters", ImVec2(140, 30))) {
-		if (LoadParamsFromJson(filepath)) {
-			LoadCommonResources();
-			Novice::ConsolePrintf("Successfully loaded from: %s\n", filepath);
-		}
-		else {
-			Novice::ConsolePrintf("Failed to load from: %s\n", filepath);
-		}
+		LoadParamsFromJsonAsync(filepath);
 	}
 	ImGui::EndGroup();
 
@@ -724,8 +994,8 @@ void ParticleManager::DrawDebugWindow() {
 				ImGui::Separator();
 
 				// ★パラメータ編集UI（既存のものを使用）
-				if (params_.find(currentDebugType_) != params_.end()) {
-					ParticleParam& p = params_[currentDebugType_];
+				if (ParticleParam* editParam = GetParam(currentDebugType_)) {
+					ParticleParam& p = *editParam;
 
 					// 現在選択中のパーティクル名を表示
 					const auto* currentInfo = ParticleRegistry::GetParticleType(currentDebugType_);
@@ -743,6 +1013,22 @@ void ParticleManager::DrawDebugWindow() {
 
 					ImGui::Separator();
 
+					// ========== 予算・優先度 ==========
+					ImGui::Text("=== Budget ===");
+					static const char* kPriorityNames[] = { "Low", "Normal", "High", "Critical" };
+					int priorityIndex = static_cast<int>(p.priority);
+					if (ImGui::Combo("Priority", &priorityIndex, kPriorityNames, IM_ARRAYSIZE(kPriorityNames))) {
+						p.priority = static_cast<ParticlePriority>(priorityIndex);
+					}
+					ImGui::SliderInt("Budget (0 = unlimited)", &p.budget, 0, kMaxParticles);
+					ImGui::Checkbox("Use LOD", &p.useLod);
+
+					const ParticleTypeStats& stats = stats_[ToIndex(currentDebugType_)];
+					ImGui::Text("Live %d (peak %d)  Dropped %d  Culled %d  LOD -%d  Evicted %d",
+						stats.live, stats.peak, stats.dropped, stats.culled, stats.lodReduced, stats.evicted);
+
+					ImGui::Separator();
+
 					// ========== サイズ設定 ==========
 					ImGui::Text("=== Size (Pixels) ===");
 					ImGui::SliderFloat("Size Min", &p.sizeMin, 4.0f, 256.0f);
@@ -825,12 +1111,15 @@ void ParticleManager::DrawDebugWindow() {
 	}
 
 	// 活性パーティクル数表示
-	int aliveCount = 0;
-	for (const auto& particle : particles_) {
-		if (particle.IsAlive()) aliveCount++;
-	}
 	ImGui::Separator();
-	ImGui::Text("Active Particles: %d / %d", aliveCount, kMaxParticles);
+	ImGui::Text("Active Particles: %d / %d", GetLiveCount(), kMaxParticles);
+	ImGui::Checkbox("Off-screen Culling", &isCullingEnabled_);
+	ImGui::SameLine();
+	ImGui::Checkbox("LOD", &isLodEnabled_);
+	ImGui::SameLine();
+	if (ImGui::Button("Reset Stats")) {
+		ResetStats();
+	}
 
 	ImGui::End();
 #endif
@@ -844,15 +1133,17 @@ void ParticleManager::DrawDebugWindow() {
 json ParticleManager::SerializeParams() const {
 	json root = json::object();
 
-	for (const auto& [type, param] : params_) {
+	for (int i = 0; i < kParticleTypeCount; ++i) {
+		if (!hasParam_[i]) continue;
+
 		// レジストリから名前を取得
-		const auto* typeInfo = ParticleRegistry::GetParticleType(type);
+		const auto* typeInfo = ParticleRegistry::GetParticleType(static_cast<ParticleType>(i));
 		if (!typeInfo) {
 			// レジストリに登録されていない場合はスキップ
 			continue;
 		}
 
-		root[typeInfo->name] = SerializeParam(param);
+		root[typeInfo->name] = SerializeParam(params_[i]);
 	}
 
 	return root;
@@ -860,14 +1151,14 @@ json ParticleManager::SerializeParams() const {
 
 bool ParticleManager::DeserializeParams(const nlohmann::json& j) {
 	try {
-		params_.clear();
+		ClearParams();
 
 		// レジストリから全タイプを取得
 		const auto& allTypes = ParticleRegistry::GetAllParticleTypes();
 
 		for (const auto& typeInfo : allTypes) {
 			if (j.contains(typeInfo.name)) {
-				params_[typeInfo.type] = DeserializeParam(j[typeInfo.name], typeInfo.type);
+				SetParam(typeInfo.type, DeserializeParam(j[typeInfo.name], typeInfo.type));
 			}
 		}
 
@@ -932,11 +1223,91 @@ bool ParticleManager::LoadParamsFromJson(const std::string& filepath) {
 	return false;
 }
 
+void ParticleManager::SaveParamsToJsonAsync(const std::string& filepath) {
+	// 文字列化と書き込みはワーカーで行う（JsonUtil::SaveToFile と同じインデント）
+	AsyncIO::GetInstance().WriteJson(filepath, SerializeParams(), 1, [filepath](bool isSuccess) {
+		isSuccess;
+#ifdef _DEBUG
+		if (isSuccess) {
+			Novice::ConsolePrintf("ParticleManager: Parameters saved to %s\n", filepath.c_str());
+		}
+		else {
+			Novice::ConsolePrintf("ParticleManager: Failed to save params: %s\n", filepath.c_str());
+		}
+#endif
+	});
+}
+
+void ParticleManager::ReloadParamsAsync(const std::string& filepath, std::function<void(int)> onReloaded) {
+	AsyncIO::GetInstance().ReadJson(filepath, [this, onReloaded = std::move(onReloaded)](bool isSuccess, nlohmann::json& j, const std::string& error) {
+		error;
+		if (!isSuccess) {
+#ifdef _DEBUG
+			Novice::ConsolePrintf("ParticleManager: Failed to reload params (%s)\n", error.c_str());
+#endif
+			return;
+		}
+
+		// 型ごとに比べて、変わったパラメータだけ差し替える
+		// （ファイルの値は一度 ParticleParam を通してから比べ、float の丸め差で誤検出しないようにする）
+		int changedCount = 0;
+		try {
+			for (const auto& typeInfo : ParticleRegistry::GetAllParticleTypes()) {
+				if (!j.contains(typeInfo.name)) continue;
+
+				ParticleParam param = DeserializeParam(j[typeInfo.name], typeInfo.type);
+				if (HasParam(typeInfo.type) && SerializeParam(params_[ToIndex(typeInfo.type)]) == SerializeParam(param)) {
+					continue;
+				}
+
+				param.textureHandle = TextureManager::GetInstance().GetTexture(typeInfo.defaultTexture);
+				SetParam(typeInfo.type, param);
+				++changedCount;
+			}
+		}
+		catch (const std::exception& e) {
+			e;
+#ifdef _DEBUG
+			Novice::ConsolePrintf("ParticleManager: Failed to deserialize params: %s\n", e.what());
+#endif
+		}
+
+#ifdef _DEBUG
+		Novice::ConsolePrintf("ParticleManager: Reloaded params (%d changed)\n", changedCount);
+#endif
+		if (onReloaded) {
+			onReloaded(changedCount);
+		}
+	});
+}
+
+void ParticleManager::LoadParamsFromJsonAsync(const std::string& filepath) {
+	// 読み込み・解析はワーカーで行い、パラメータの差し替えは同期点でまとめて行う
+	AsyncIO::GetInstance().ReadJson(filepath, [this, filepath](bool isSuccess, nlohmann::json& j, const std::string& error) {
+		error;
+		if (!isSuccess) {
+			// 読めなかった場合は今のパラメータをそのまま使う
+#ifdef _DEBUG
+			Novice::ConsolePrintf("ParticleManager: Failed to load params (%s). Keeping current parameters.\n", error.c_str());
+#endif
+			return;
+		}
+
+		if (!DeserializeParams(j)) {
+			LoadDefaultParamsFromRegistry();
+		}
+		LoadCommonResources();
+#ifdef _DEBUG
+		Novice::ConsolePrintf("ParticleManager: Parameters loaded from %s\n", filepath.c_str());
+#endif
+	});
+}
+
 // ==============================================
 // レジストリベースの初期化（Phase 3 で有効化）
 // ==============================================
 void ParticleManager::LoadDefaultParamsFromRegistry() {
-	params_.clear();
+	ClearParams();
 
 	const auto& allTypes = ParticleRegistry::GetAllParticleTypes();
 	for (const auto& typeInfo : allTypes) {
@@ -945,7 +1316,7 @@ void ParticleManager::LoadDefaultParamsFromRegistry() {
 		// テクスチャをレジストリから取得
 		defaultParam.textureHandle = TextureManager::GetInstance().GetTexture(typeInfo.defaultTexture);
 
-		params_[typeInfo.type] = defaultParam;
+		SetParam(typeInfo.type, defaultParam);
 	}
 }
 
@@ -971,6 +1342,9 @@ ParticleParam ParticleManager::GenerateDefaultParam(ParticleType type) {
 		param.colorEnd = 0xFFFFFF00;
 	}
 	else if (typeInfo->category == "Environment") {
+		// 画面を埋める演出なので、足りなくなったら真っ先に削る
+		param.priority = ParticlePriority::Low;
+		param.budget = 512;
 		param.count = 30;
 		param.lifeMin = 120;
 		param.lifeMax = 180;
@@ -1009,6 +1383,8 @@ ParticleParam ParticleManager::GenerateDefaultParam(ParticleType type) {
 	// タイプ固有の調整（既存の LoadParams から移植）
 	switch (type) {
 	case ParticleType::Explosion:
+		param.priority = ParticlePriority::High;
+		param.useLod = false;
 		param.count = 1;
 		param.lifeMin = 40;
 		param.lifeMax = 40;
@@ -1063,7 +1439,14 @@ ParticleParam ParticleManager::GenerateDefaultParam(ParticleType type) {
 		param.colorEnd = 0xFFFF8880;
 		break;
 
+	case ParticleType::Enemy_Dead:
+		param.priority = ParticlePriority::Critical;
+		param.useLod = false;
+		break;
+
 	case ParticleType::Charge:
+		param.priority = ParticlePriority::Critical;
+		param.useLod = false;
 		param.useHoming = true;
 		param.homingStrength = 500.0f;
 		param.emitRange = { 100.0f, 100.0f };
@@ -1115,6 +1498,9 @@ nlohmann::json ParticleManager::SerializeParam(const ParticleParam& param) const
 	j["windStrength"] = param.windStrength;
 	j["floatAmplitude"] = param.floatAmplitude;
 	j["floatFrequency"] = param.floatFrequency;
+	j["priority"] = PriorityToString(param.priority);
+	j["budget"] = param.budget;
+	j["useLod"] = param.useLod;
 
 	return j;
 }
@@ -1189,6 +1575,12 @@ ParticleParam ParticleManager::DeserializeParam(const nlohmann::json& j, Particl
 	param.floatAmplitude = JsonUtil::GetValue<float>(j, "floatAmplitude", 0.0f);
 	param.floatFrequency = JsonUtil::GetValue<float>(j, "floatFrequency", 1.0f);
 
+	// 予算・優先度（古いJSONには無いので、タイプごとの既定値を使う）
+	const ParticleParam defaults = GenerateDefaultParam(type);
+	param.priority = StringToPriority(JsonUtil::GetValue<std::string>(j, "priority", ""), defaults.priority);
+	param.budget = JsonUtil::GetValue<int>(j, "budget", defaults.budget);
+	param.useLod = JsonUtil::GetValue<bool>(j, "useLod", defaults.useLod);
+
 	// テクスチャハンドルが-1の場合、レジストリから取得
 	const auto* typeInfo = ParticleRegistry::GetParticleType(type);
 	if (typeInfo) {
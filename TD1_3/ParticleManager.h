@@ -6,12 +6,14 @@
 #include <vector>
 #include <map>
 #include <string>
+#include <functional>
 #include "json.hpp"
 #include "ParticleEnum.h"
 
 // 前方宣言
 class Camera2D;
 class DebugWindow;
+struct AnimationClip;
 
 // エミッターの追従モード
 enum class EmitterFollowMode {
@@ -20,6 +22,24 @@ enum class EmitterFollowMode {
 	WorldPoint      // ワールド座標の固定点
 };
 
+// パーティクルの優先度（プールが埋まったときは低いものから上書きされる）
+enum class ParticlePriority {
+	Low,       // 環境演出など（雨・雪）
+	Normal,
+	High,      // 攻撃のヒットなど
+	Critical   // 敵の撃破・チャージなど、欠けると困るもの
+};
+
+// タイプごとの統計（デバッグ表示用）
+struct ParticleTypeStats {
+	int live = 0;        // 生存数
+	int peak = 0;        // 生存数の最大
+	int dropped = 0;     // 予算・プール不足で出せなかった数
+	int culled = 0;      // 画面外のため発生させなかった数
+	int lodReduced = 0;  // LODで減らした数
+	int evicted = 0;     // 優先度の高いものに上書きされた数
+};
+
 // 1種類のエフェクトの設定データ（拡張版）
 struct ParticleParam {
 	int count = 1;
@@ -65,6 +85,11 @@ struct ParticleParam {
 	float windStrength = 0.0f;         // 横風の強さ（雪用）
 	float floatAmplitude = 0.0f;       // 浮遊の振幅（オーブ用）
 	float floatFrequency = 1.0f;       // 浮遊の周波数（オーブ用）
+
+	// 予算・優先度
+	ParticlePriority priority = ParticlePriority::Normal;
+	int budget = 256;                  // 同時に生存できる最大数（0以下で無制限）
+	bool useLod = true;                // 遠い・小さく見えるときに発生数を減らすか
 };
 
 class ParticleManager {
@@ -110,10 +135,30 @@ public:
 	bool SaveParamsToJson(const std::string& filepath);
 	bool LoadParamsFromJson(const std::string& filepath);
 
+	// ワーカースレッドで読み書きする版（読み込みの反映は次の同期点）
+	void SaveParamsToJsonAsync(const std::string& filepath);
+	void LoadParamsFromJsonAsync(const std::string& filepath);
+
+	// ファイルの変更を取り込む（変わった型のパラメータだけ差し替える。引数は差し替えた数）
+	void ReloadParamsAsync(const std::string& filepath, std::function<void(int)> onReloaded = nullptr);
+
 	// パラメータの取得/設定
 	ParticleParam* GetParam(ParticleType type);
 	const ParticleParam* GetParam(ParticleType type) const;
 
+	// 予算・統計
+	const ParticleTypeStats& GetStats(ParticleType type) const { return stats_[ToIndex(type)]; }
+	void ResetStats();
+	int GetLiveCount() const { return kMaxParticles - static_cast<int>(freeList_.size()); }
+	static int GetMaxParticles() { return kMaxParticles; }
+
+	// 画面外カリング・LOD（表示範囲は Draw に渡されたカメラから更新される）
+	void SetView(const Camera2D& camera);
+	void SetCullingEnabled(bool enabled) { isCullingEnabled_ = enabled; }
+	bool IsCullingEnabled() const { return isCullingEnabled_; }
+	void SetLodEnabled(bool enabled) { isLodEnabled_ = enabled; }
+	bool IsLodEnabled() const { return isLodEnabled_; }
+
 private:
 	// レジストリベースの初期化
 	void LoadDefaultParamsFromRegistry();
@@ -123,7 +168,15 @@ private:
 	nlohmann::json SerializeParam(const ParticleParam& param) const;
 	ParticleParam DeserializeParam(const nlohmann::json& j, ParticleType type);
 
-	Particle& GetNextParticle();
+	// 空きスロットを確保する（予算超過・空きなしで上書きできるものもない場合は nullptr）
+	Particle* AllocateParticle(ParticleType type);
+	void ReleaseSlot(int index);
+
+	// 発生位置が表示範囲（余白込み）に入っているか
+	bool IsEmitVisible(const Vector2& pos, const ParticleParam& param) const;
+
+	// 距離・ズームによるLODを適用した発生数
+	int ComputeLodCount(const Vector2& pos, const ParticleParam& param) const;
 	float RandomFloat(float min, float max);
 	Vector2 GenerateEmitPosition(const Vector2& basePos, const ParticleParam& param);
 
@@ -135,23 +188,73 @@ private:
 	static const char* BlendModeToString(BlendMode mode);
 	static BlendMode StringToBlendMode(const std::string& str);
 
+	// 優先度変換ヘルパー
+	static const char* PriorityToString(ParticlePriority priority);
+	static ParticlePriority StringToPriority(const std::string& str, ParticlePriority defaultValue);
+
 	// 連続発生の管理構造体
 	struct ContinuousEmitter {
-		ParticleType type;
-		Vector2 position;                    // 基準位置
-		EmitterFollowMode followMode;        // 追従モード
-		const Vector2* followTarget;         // 追従対象（プレイヤー位置など）
+		ParticleType type = ParticleType::Explosion;
+		Vector2 position = { 0.0f, 0.0f };   // 基準位置
+		EmitterFollowMode followMode = EmitterFollowMode::None; // 追従モード
+		const Vector2* followTarget = nullptr; // 追従対象（プレイヤー位置など）
 		const Vector2* target = nullptr;     // Homing用ターゲット
 		float timer = 0.0f;
 		bool isActive = false;
 	};
 
+	// パラメータから事前に計算しておく値（Emit / Draw のたびに計算しない）
+	struct ParticleDerived {
+		const AnimationClip* clip = nullptr; // テクスチャサイズと各フレームのソース矩形
+		float angleBaseRad = 0.0f;           // 発射角の基準（ラジアン）
+		float halfRangeRad = 0.0f;           // 発射角の振れ幅の半分（ラジアン）
+		Vector2 totalAcc = { 0.0f, 0.0f };   // 重力 + 加速度
+	};
+
+	// タイプ → 配列の添字
+	static int ToIndex(ParticleType type) { return static_cast<int>(type); }
+	static bool IsValidType(ParticleType type) { return ToIndex(type) >= 0 && ToIndex(type) < kParticleTypeCount; }
+	bool HasParam(ParticleType type) const { return IsValidType(type) && hasParam_[ToIndex(type)]; }
+
+	// パラメータの登録・全消去（事前計算も更新する）
+	void SetParam(ParticleType type, const ParticleParam& param);
+	void ClearParams();
+
+	// 事前計算値（パラメータが書き換えられていたら計算し直す）
+	const ParticleDerived& GetDerived(ParticleType type);
+	void RefreshDerived(ParticleType type);
+
 	static const int kMaxParticles = 2048;
 	std::array<Particle, kMaxParticles> particles_;
-	int nextIndex_ = 0;
+	int nextIndex_ = 0; // 上書き先を探すときの開始位置
+
+	// スロット管理（空きスロットの添字と、使用中スロットのタイプ・優先度）
+	std::vector<int> freeList_;
+	std::array<ParticleType, kMaxParticles> slotType_{};
+	std::array<ParticlePriority, kMaxParticles> slotPriority_{};
+	std::array<bool, kMaxParticles> slotUsed_{};
+
+	// タイプごとの統計
+	std::array<ParticleTypeStats, kParticleTypeCount> stats_{};
+
+	// 表示範囲（ワールド座標）
+	bool hasView_ = false;
+	Vector2 viewCenter_ = { 0.0f, 0.0f };
+	Vector2 viewHalfSize_ = { 0.0f, 0.0f };
+	float viewZoom_ = 1.0f;
+
+	bool isCullingEnabled_ = true;
+	bool isLodEnabled_ = true;
+
+	// ParticleType で直接引く固定長テーブル
+	std::array<ParticleParam, kParticleTypeCount> params_{};
+	std::array<bool, kParticleTypeCount> hasParam_{};
+	std::array<ParticleDerived, kParticleTypeCount> derived_{};
+	std::array<bool, kParticleTypeCount> derivedDirty_{};
+	std::array<ContinuousEmitter, kParticleTypeCount> continuousEmitters_{};
 
-	std::map<ParticleType, ParticleParam> params_;
-	std::map<ParticleType, ContinuousEmitter> continuousEmitters_;
+	// 描画時にブレンドモードごとに振り分ける添字（容量は使い回す）
+	std::array<std::vector<int>, kCountOfBlendMode> drawBuckets_;
 
 	float groundLevel_ = 0.0f;  // 地面のY座標
 
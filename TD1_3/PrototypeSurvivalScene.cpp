@@ -51,6 +51,16 @@ void PrototypeSurvivalScene::Update(float deltaTime, const char* keys, const cha
         SpawnEnemy();
     }
 
+#ifdef _DEBUG
+    // 負荷確認：H で1000体追加、B でベンチマーク（1万体 x 300フレーム）
+    if (Input().TriggerKey(DIK_H)) {
+        SpawnEnemies(1000);
+    }
+    if (Input().TriggerKey(DIK_B)) {
+        lastBenchmark_ = SurvivalEnemyStore::RunBenchmark(10000, 300);
+    }
+#endif
+
     // カメラ演出制御
     UpdateCamera(deltaTime);
 
@@ -73,14 +83,14 @@ void PrototypeSurvivalScene::SpawnEnemy() {
     // タンク率 20%
     EnemyType type = (rand() % 5 == 0) ? EnemyType::Tank : EnemyType::Normal;
 
-    auto player = gameObjectManager_->GetPlayer();
-    auto enemy = std::make_shared<SurvivalEnemy>(spawnPos, type, player);
-	int enemyTex = (type == EnemyType::Tank) ? Tex().GetTexture(TextureId::White1x1) : Tex().GetTexture(TextureId::White1x1);
-    if (enemy->GetDrawComponent()) {
-        enemy->GetDrawComponent()->SetGraphHandle(enemyTex);
-	}
+    gameObjectManager_->SpawnEnemy(spawnPos, type);
+}
 
-    gameObjectManager_->AddObject(enemy, "Enemy");                                       
+void PrototypeSurvivalScene::SpawnEnemies(int count) {
+    gameObjectManager_->GetEnemies().Reserve(static_cast<size_t>(gameObjectManager_->GetEnemyCount() + count));
+    for (int i = 0; i < count; i++) {
+        SpawnEnemy();
+    }
 }
 
 void PrototypeSurvivalScene::UpdateCamera(float dt) {
@@ -118,6 +128,14 @@ void PrototypeSurvivalScene::Draw() {
     gameObjectManager_->Draw(*camera_);
 
     // UIデバッグ
-    Novice::ScreenPrintf(10, 10, "Objects: %d", gameObjectManager_.get()->GetObjectsSize()); // リストサイズ取得メソッドがあれば表示推奨
+    Novice::ScreenPrintf(10, 10, "Objects: %d  Enemies: %d (%.2f ms)",
+        gameObjectManager_->GetObjectsSize(), gameObjectManager_->GetEnemyCount(), gameObjectManager_->GetLastEnemyUpdateMs());
     Novice::ScreenPrintf(10, 30, "WASD: Move, SPACE: Expand/Contract");
+#ifdef _DEBUG
+    Novice::ScreenPrintf(10, 50, "H: +1000 Enemies, B: Benchmark");
+    if (lastBenchmark_.frames > 0) {
+        Novice::ScreenPrintf(10, 70, "Benchmark: %d enemies avg %.3f ms max %.3f ms",
+            lastBenchmark_.enemyCount, lastBenchmark_.avgFrameMs, lastBenchmark_.maxFrameMs);
+    }
+#endif
 }
\ No newline at end of file
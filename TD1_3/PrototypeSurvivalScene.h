@@ -33,7 +33,11 @@ private:
     // 演出用シェイクタイマー（カメラクラスにも機能あるが、シーン全体制御として持つ）
     float shakeTimer_ = 0.0f;
 
+    // 直近のベンチマーク結果（デバッグ表示用）
+    SurvivalBenchmarkResult lastBenchmark_;
+
     // プライベートメソッド
     void SpawnEnemy();
+    void SpawnEnemies(int count); // 負荷確認用のまとめて生成
     void UpdateCamera(float dt); // カメラのズーム制御など
 };
\ No newline at end of file
@@ -6,13 +6,23 @@
 #include "ResultScene.h"
 #include "Stage1Scene.h"
 #include "GamePlayScene.h"
+#ifdef _DEBUG
+#include "PrototypeSurvivalScene.h"
+#endif
 
 
 #include "SceneUtilityIncludes.h"
 
 #include "MapData.h"
+#include "AsyncIO.h"
+#include "FileWatcher.h"
+#include "Tween.h"
+#include "EffectSystem.h"
 
 #include <Novice.h>
+#ifdef _DEBUG
+#include <imgui.h>
+#endif
 
 SceneManager::SceneManager() {
 	//shared_.LoadCommonTextures();
@@ -27,10 +37,22 @@ void SceneManager::Update(float dt, const char* keys, const char* pre) {
 	/*if (keys[DIK_R] && !pre[DIK_R]) {
 		RequestTransition(currentSceneType_);
 	}*/
+	DrawSceneSwitcher();
 #endif
 
 	InputManager::GetInstance().Update();
 
+	// 非同期I/Oの完了通知（読み込み結果の反映などはここでまとめて行う）
+	AsyncIO::GetInstance().DispatchCompletions();
+#ifdef _DEBUG
+	FileWatcher::GetInstance().Update();
+#endif
+
+	// トゥイーンの一括更新（ポーズなどのオーバーレイ表示中はゲーム側の演出を止める）
+	TweenManager& tweens = TweenManager::GetInstance();
+	tweens.SetGroupTimeScale(TweenGroup::Gameplay, overlayScenes_.empty() ? 1.0f : 0.0f);
+	tweens.Update(dt);
+
 	// オーバーレイがある場合はそちらを優先
 	if (!overlayScenes_.empty()) {
 		overlayScenes_.back()->Update(dt, keys, pre);
@@ -41,6 +63,8 @@ void SceneManager::Update(float dt, const char* keys, const char* pre) {
 			pendingOverlayClear_ = false;
 		}
 
+		EffectSystem::GetInstance().Update();
+
 		// オーバーレイ表示中は実際の切り替えは行わない
 		return;
 	}
@@ -52,6 +76,9 @@ void SceneManager::Update(float dt, const char* keys, const char* pre) {
 	if (currentScene_) {
 		currentScene_->Update(dt, keys, pre);
 	}
+
+	// シーン内で積まれたエフェクトの時間をまとめて消化する
+	EffectSystem::GetInstance().Update();
 }
 
 void SceneManager::Draw() {
@@ -71,6 +98,9 @@ void SceneManager::RequestTransition(SceneType targetScene) {
 void SceneManager::RequestRetry() {
 	// オーバーレイクリアを遅延実行に変更
 	pendingOverlayClear_ = true;
+	pendingRetry_ = true;
+
+	// シーンが Retry に対応していなければ、同じシーンへの遷移として作り直す
 	RequestTransition(currentSceneType_);
 }
 
@@ -129,6 +159,16 @@ void SceneManager::ProcessSceneTransition() {
 		return;
 	}
 
+	// リトライはシーンを作り直さずに、開始時点の状態へ巻き戻せるならそちらを使う
+	const bool isRetry = pendingRetry_;
+	pendingRetry_ = false;
+	if (isRetry &&
+		pendingTransition_->targetScene == currentSceneType_ &&
+		currentScene_ && currentScene_->Retry()) {
+		pendingTransition_.reset();
+		return;
+	}
+
 	ChangeScene(pendingTransition_->targetScene);
 	pendingTransition_.reset();
 }
@@ -136,6 +176,9 @@ void SceneManager::ProcessSceneTransition() {
 void SceneManager::ChangeScene(SceneType type) {
 	currentSceneType_ = type;
 
+	// シーンで使う音声を先読み（シーンのコンストラクタで鳴らす前に）
+	SoundManager::GetInstance().PrepareScene(type);
+
 	switch (type) {
 	case SceneType::Title:
 		currentScene_ = std::make_unique<TitleScene>(*this);
@@ -163,6 +206,13 @@ void SceneManager::ChangeScene(SceneType type) {
 	//	currentScene_ = std::make_unique<GamePlayScene>(*this);//!
 	//	break;
 
+#ifdef _DEBUG
+	case SceneType::PrototypeSurvival:
+		currentScene_ = std::make_unique<PrototypeSurvivalScene>(*this);
+		currentStageIndex_ = -1;
+		break;
+#endif
+
 	default:
 		// 未実装のシーンの場合はタイトルに戻る
 		if (type != SceneType::Title) {
@@ -179,4 +229,32 @@ SceneType SceneManager::StageIndexToSceneType(int stageIndex) const {
 	case 1: return SceneType::GamePlay;
 	default: return SceneType::Title;
 	}
-}
\ No newline at end of file
+}
+
+#ifdef _DEBUG
+void SceneManager::DrawSceneSwitcher() {
+	struct SceneEntry {
+		const char* name;
+		SceneType type;
+	};
+	static constexpr SceneEntry kScenes[] = {
+		{ "Title", SceneType::Title },
+		{ "StageSelect", SceneType::StageSelect },
+		{ "GamePlay", SceneType::GamePlay },
+		{ "Result", SceneType::Result },
+		{ "PrototypeSurvival", SceneType::PrototypeSurvival },
+	};
+
+	ImGui::Begin("Scene Switcher");
+	for (const SceneEntry& scene : kScenes) {
+		if (ImGui::Selectable(scene.name, currentSceneType_ == scene.type)) {
+			// オーバーレイ中に切り替えると戻り先が無くなるので閉じてから遷移する
+			if (!overlayScenes_.empty()) {
+				pendingOverlayClear_ = true;
+			}
+			RequestTransition(scene.type);
+		}
+	}
+	ImGui::End();
+}
+#endif
@@ -62,6 +62,7 @@ private:
 	// 遷移リクエスト
 	std::optional<SceneTransition> pendingTransition_;
 	bool pendingOverlayClear_ = false;
+	bool pendingRetry_ = false; // 遷移前に現在シーンの Retry を試す
 
 	// ゲーム終了フラグ
 	bool shouldQuit_ = false;
@@ -82,4 +83,9 @@ private:
 
 
 	void ChangeScene(SceneType type);
+
+#ifdef _DEBUG
+	// デバッグ用のシーン切替ウィンドウ
+	void DrawSceneSwitcher();
+#endif
 };
\ No newline at end of file
@@ -8,4 +8,5 @@ enum class SceneType {
 	Explanation,
 	Setting,
 	GamePlay,
+	PrototypeSurvival, // 試作シーン（デバッグビルドのシーン切替からのみ）
 };
\ No newline at end of file
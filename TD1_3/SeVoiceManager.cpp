@@ -0,0 +1,343 @@
+﻿#include "SeVoiceManager.h"
+#include "AudioBackend.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+	// これ未満の音量は鳴らしても聞こえないのでカリング扱い
+	const float kAudibleVolume = 0.01f;
+}
+
+SeVoiceManager::SeVoiceManager(IAudioBackend* backend)
+	: backend_(backend) {
+	frameVoiceSlot_.fill(-1);
+}
+
+void SeVoiceManager::BeginFrame(const Vector2& listenerPos) {
+	listenerPos_ = listenerPos;
+	++frame_;
+
+	ReapFinishedVoices();
+
+	frameVoiceSlot_.fill(-1);
+	stats_.frameRequests = 0;
+	stats_.framePlayed = 0;
+	stats_.frameCoalesced = 0;
+	stats_.frameStolen = 0;
+	stats_.frameDropped = 0;
+	stats_.frameCulled = 0;
+}
+
+bool SeVoiceManager::Play(SeId id, int soundHandle, float volume) {
+	stats_.frameRequests++;
+	return PlayInternal(id, soundHandle, volume);
+}
+
+bool SeVoiceManager::PlayAt(SeId id, int soundHandle, float volume, const Vector2& worldPos) {
+	stats_.frameRequests++;
+
+	float attenuation = CalcAttenuation(id, worldPos);
+	float finalVolume = volume * attenuation;
+	if (attenuation <= 0.0f || finalVolume < kAudibleVolume) {
+		stats_.frameCulled++;
+		stats_.totalCulled++;
+		return false;
+	}
+
+	return PlayInternal(id, soundHandle, finalVolume);
+}
+
+bool SeVoiceManager::PlayInternal(SeId id, int soundHandle, float volume) {
+	if (!backend_ || soundHandle == -1) {
+		return false;
+	}
+
+	const int index = static_cast<int>(id);
+	const SeVoiceSettings& settings = settings_[index];
+
+	// 同一フレームの同じSEは1つにまとめる（大きい方の音量を採用）
+	int sameFrameSlot = frameVoiceSlot_[index];
+	if (sameFrameSlot >= 0 && voices_[sameFrameSlot].active && voices_[sameFrameSlot].id == id) {
+		Voice& voice = voices_[sameFrameSlot];
+		if (volume > voice.volume) {
+			voice.volume = volume;
+			backend_->SetAudioVolume(voice.voiceHandle, volume);
+		}
+		stats_.frameCoalesced++;
+		stats_.totalCoalesced++;
+		return true;
+	}
+
+	int slot = -1;
+
+	// SEごとの同時発音数上限：同じSEの一番古いボイスを差し替える
+	if (stats_.activePerSe[index] >= settings.maxConcurrent) {
+		if (settings.maxConcurrent <= 0) {
+			stats_.frameDropped++;
+			stats_.totalDropped++;
+			return false;
+		}
+		slot = FindOldestVoiceOf(id);
+		if (slot >= 0) {
+			ReleaseVoice(slot, true);
+			stats_.frameStolen++;
+			stats_.totalStolen++;
+		}
+	}
+
+	// 空きスロットを探す
+	if (slot < 0) {
+		slot = FindFreeSlot();
+	}
+
+	// 空きがなければ終了済みボイスを回収してから再検索
+	if (slot < 0) {
+		ReapFinishedVoices();
+		slot = FindFreeSlot();
+	}
+
+	// それでも空きがなければ優先度の低いボイスを奪う
+	if (slot < 0) {
+		slot = FindStealCandidate(settings.priority);
+		if (slot < 0) {
+			stats_.frameDropped++;
+			stats_.totalDropped++;
+			return false;
+		}
+		ReleaseVoice(slot, true);
+		stats_.frameStolen++;
+		stats_.totalStolen++;
+	}
+
+	int voiceHandle = backend_->PlayAudio(soundHandle, false, volume);
+	if (voiceHandle == -1) {
+		stats_.frameDropped++;
+		stats_.totalDropped++;
+		return false;
+	}
+
+	Voice& voice = voices_[slot];
+	voice.active = true;
+	voice.voiceHandle = voiceHandle;
+	voice.id = id;
+	voice.priority = settings.priority;
+	voice.startFrame = frame_;
+	voice.volume = volume;
+
+	frameVoiceSlot_[index] = slot;
+	stats_.activePerSe[index]++;
+	stats_.activeVoices++;
+	stats_.peakVoices = (std::max)(stats_.peakVoices, stats_.activeVoices);
+	stats_.framePlayed++;
+	stats_.totalPlayed++;
+	return true;
+}
+
+void SeVoiceManager::StopAll() {
+	for (int i = 0; i < kMaxVoices; ++i) {
+		if (voices_[i].active) {
+			ReleaseVoice(i, true);
+		}
+	}
+	frameVoiceSlot_.fill(-1);
+}
+
+void SeVoiceManager::SetSettings(SeId id, const SeVoiceSettings& settings) {
+	settings_[static_cast<int>(id)] = settings;
+}
+
+float SeVoiceManager::CalcAttenuation(SeId id, const Vector2& worldPos) const {
+	const SeVoiceSettings& settings = settings_[static_cast<int>(id)];
+	if (settings.attenuationStart <= 0.0f) {
+		return 1.0f;
+	}
+
+	float dx = worldPos.x - listenerPos_.x;
+	float dy = worldPos.y - listenerPos_.y;
+	float distance = std::sqrt(dx * dx + dy * dy);
+
+	if (distance <= settings.attenuationStart) {
+		return 1.0f;
+	}
+	if (distance >= settings.cullDistance) {
+		return 0.0f;
+	}
+
+	// 減衰開始距離からカリング距離まで線形に減衰
+	float range = settings.cullDistance - settings.attenuationStart;
+	return 1.0f - (distance - settings.attenuationStart) / range;
+}
+
+void SeVoiceManager::ResetStats() {
+	int active = stats_.activeVoices;
+	auto perSe = stats_.activePerSe;
+	stats_ = SeVoiceStats{};
+	stats_.activeVoices = active;
+	stats_.peakVoices = active;
+	stats_.activePerSe = perSe;
+}
+
+int SeVoiceManager::FindFreeSlot() const {
+	for (int i = 0; i < kMaxVoices; ++i) {
+		if (!voices_[i].active) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+int SeVoiceManager::FindStealCandidate(int priority) const {
+	// 優先度が新しいSE以下のボイスのうち、最も優先度が低く古いもの
+	int candidate = -1;
+	for (int i = 0; i < kMaxVoices; ++i) {
+		const Voice& voice = voices_[i];
+		if (!voice.active || voice.priority > priority) {
+			continue;
+		}
+		if (candidate < 0) {
+			candidate = i;
+			continue;
+		}
+		const Voice& best = voices_[candidate];
+		if (voice.priority < best.priority ||
+			(voice.priority == best.priority && voice.startFrame < best.startFrame)) {
+			candidate = i;
+		}
+	}
+	return candidate;
+}
+
+int SeVoiceManager::FindOldestVoiceOf(SeId id) const {
+	int oldest = -1;
+	for (int i = 0; i < kMaxVoices; ++i) {
+		const Voice& voice = voices_[i];
+		if (!voice.active || voice.id != id) {
+			continue;
+		}
+		if (oldest < 0 || voice.startFrame < voices_[oldest].startFrame) {
+			oldest = i;
+		}
+	}
+	return oldest;
+}
+
+void SeVoiceManager::ReleaseVoice(int slot, bool stop) {
+	Voice& voice = voices_[slot];
+	if (!voice.active) {
+		return;
+	}
+
+	if (stop && backend_) {
+		backend_->StopAudio(voice.voiceHandle);
+	}
+
+	const int index = static_cast<int>(voice.id);
+	stats_.activePerSe[index]--;
+	stats_.activeVoices--;
+	if (frameVoiceSlot_[index] == slot) {
+		frameVoiceSlot_[index] = -1;
+	}
+
+	voice = Voice{};
+}
+
+void SeVoiceManager::ReapFinishedVoices() {
+	if (!backend_) {
+		return;
+	}
+
+	for (int i = 0; i < kMaxVoices; ++i) {
+		if (voices_[i].active && !backend_->IsPlayingAudio(voices_[i].voiceHandle)) {
+			ReleaseVoice(i, false);
+		}
+	}
+}
+
+#ifdef _DEBUG
+bool SeVoiceManager::RunSelfCheck(const char** outFailure) {
+	auto fail = [outFailure](const char* reason) {
+		if (outFailure) {
+			*outFailure = reason;
+		}
+		return false;
+	};
+
+	const Vector2 listener = { 0.0f, 0.0f };
+	const int kSound = 0;
+
+	// SEごとの上限：超えたら同じSEの一番古いボイスを止めて差し替える
+	{
+		MockAudioBackend backend;
+		SeVoiceManager voices(&backend);
+		voices.SetSettings(SeId::EnemyAttack1, { 40, 2, 0.0f, 0.0f });
+
+		for (int i = 0; i < 3; ++i) {
+			voices.BeginFrame(listener);
+			voices.Play(SeId::EnemyAttack1, kSound, 1.0f);
+		}
+		if (voices.GetStats().activePerSe[static_cast<int>(SeId::EnemyAttack1)] != 2) {
+			return fail("SEごとの同時発音数が上限を超えた");
+		}
+		if (backend.GetStoppedVoices() != std::vector<int>{ 0 }) {
+			return fail("上限を超えたときに同じSEの一番古いボイスが止まっていない");
+		}
+	}
+
+	// 同一フレームの同じSEは1ボイスにまとめる
+	{
+		MockAudioBackend backend;
+		SeVoiceManager voices(&backend);
+		voices.BeginFrame(listener);
+		voices.Play(SeId::PlayerJump, kSound, 0.5f);
+		voices.Play(SeId::PlayerJump, kSound, 1.0f);
+		if (voices.GetStats().totalPlayed != 1 || voices.GetStats().totalCoalesced != 1) {
+			return fail("同一フレームの同じSEがまとめられていない");
+		}
+	}
+
+	// 全体の上限：優先度の低いもの→古いものの順に奪う
+	{
+		MockAudioBackend backend;
+		SeVoiceManager voices(&backend);
+		voices.SetSettings(SeId::EnemyAttack1, { 40, kMaxVoices, 0.0f, 0.0f });
+		voices.SetSettings(SeId::EnemyFindPlayer1, { 20, kMaxVoices, 0.0f, 0.0f });
+		voices.SetSettings(SeId::Select, { 100, kMaxVoices, 0.0f, 0.0f });
+
+		// ボイス0 が中優先度、1～15 が低優先度（番号が小さいほど古い）
+		voices.BeginFrame(listener);
+		voices.Play(SeId::EnemyAttack1, kSound, 1.0f);
+		for (int i = 1; i < kMaxVoices; ++i) {
+			voices.BeginFrame(listener);
+			voices.Play(SeId::EnemyFindPlayer1, kSound, 1.0f);
+		}
+
+		for (int i = 0; i < 2; ++i) {
+			voices.BeginFrame(listener);
+			voices.Play(SeId::Select, kSound, 1.0f);
+		}
+		if (backend.GetStoppedVoices() != std::vector<int>{ 1, 2 }) {
+			return fail("優先度の低い古いボイスから奪われていない");
+		}
+	}
+
+	// 自分より優先度の高いボイスしか無ければ鳴らさない
+	{
+		MockAudioBackend backend;
+		SeVoiceManager voices(&backend);
+		voices.SetSettings(SeId::Select, { 100, kMaxVoices, 0.0f, 0.0f });
+		voices.SetSettings(SeId::EnemyFindPlayer1, { 20, 1, 0.0f, 0.0f });
+
+		for (int i = 0; i < kMaxVoices; ++i) {
+			voices.BeginFrame(listener);
+			voices.Play(SeId::Select, kSound, 1.0f);
+		}
+		voices.BeginFrame(listener);
+		if (voices.Play(SeId::EnemyFindPlayer1, kSound, 1.0f) || !backend.GetStoppedVoices().empty()) {
+			return fail("優先度の高いボイスが低優先度のSEに奪われた");
+		}
+	}
+
+	return true;
+}
+#endif
@@ -0,0 +1,118 @@
+﻿#pragma once
+#include <array>
+#include <cstdint>
+#include "AudioTypes.h"
+#include "Vector2.h"
+
+class IAudioBackend;
+
+// SEごとの発音設定
+struct SeVoiceSettings {
+	int priority = 50;               // 優先度（大きいほど優先・奪われにくい）
+	int maxConcurrent = 4;           // 同じSEの同時発音数上限
+	float attenuationStart = 700.0f; // 距離減衰が始まる距離（0以下で減衰なし）
+	float cullDistance = 1500.0f;    // この距離以上は再生しない
+};
+
+// ボイス使用状況の統計（デバッグ表示用）
+struct SeVoiceStats {
+	int activeVoices = 0;
+	int peakVoices = 0;
+
+	// 直近フレーム
+	int frameRequests = 0;
+	int framePlayed = 0;
+	int frameCoalesced = 0;
+	int frameStolen = 0;
+	int frameDropped = 0;
+	int frameCulled = 0;
+
+	// 累計
+	uint32_t totalPlayed = 0;
+	uint32_t totalCoalesced = 0;
+	uint32_t totalStolen = 0;
+	uint32_t totalDropped = 0;
+	uint32_t totalCulled = 0;
+
+	std::array<int, static_cast<int>(SeId::Count)> activePerSe{};
+};
+
+/// <summary>
+/// SEのボイス管理
+/// ・全体のボイス数を kMaxVoices に制限し、溢れたら優先度の低い古いボイスを奪う
+/// ・SEごとの同時発音数上限
+/// ・同一フレーム内の同じSEは1ボイスにまとめる（音量は大きい方）
+/// ・リスナー（カメラ）からの距離で減衰・カリング
+/// </summary>
+class SeVoiceManager {
+public:
+	static const int kMaxVoices = 16;
+
+	explicit SeVoiceManager(IAudioBackend* backend);
+
+	void SetBackend(IAudioBackend* backend) { backend_ = backend; }
+
+	// フレーム開始時に1回呼ぶ（終了したボイスの回収・フレーム統計のリセット）
+	void BeginFrame(const Vector2& listenerPos);
+
+	// 位置なし再生（UIなど）
+	bool Play(SeId id, int soundHandle, float volume);
+
+	// 位置付き再生（リスナーからの距離で減衰・カリング）
+	bool PlayAt(SeId id, int soundHandle, float volume, const Vector2& worldPos);
+
+	void StopAll();
+
+	// 設定
+	void SetSettings(SeId id, const SeVoiceSettings& settings);
+	const SeVoiceSettings& GetSettings(SeId id) const { return settings_[static_cast<int>(id)]; }
+	SeVoiceSettings& GetSettings(SeId id) { return settings_[static_cast<int>(id)]; }
+
+	// 距離減衰係数（0.0f～1.0f）
+	float CalcAttenuation(SeId id, const Vector2& worldPos) const;
+
+	const SeVoiceStats& GetStats() const { return stats_; }
+	void ResetStats();
+
+	// デバッグ表示用
+	struct Voice {
+		bool active = false;
+		int voiceHandle = -1;
+		SeId id = SeId::Count;
+		int priority = 0;
+		uint32_t startFrame = 0;
+		float volume = 0.0f;
+	};
+	const std::array<Voice, kMaxVoices>& GetVoices() const { return voices_; }
+	uint32_t GetFrame() const { return frame_; }
+
+#ifdef _DEBUG
+	/// <summary>
+	/// モックバックエンドで奪い合いの順序とSEごとの上限を確認する（Novice なしで動く）
+	/// 失敗したら false を返し、outFailure に理由を入れる
+	/// </summary>
+	static bool RunSelfCheck(const char** outFailure);
+#endif
+
+private:
+	bool PlayInternal(SeId id, int soundHandle, float volume);
+
+	int FindFreeSlot() const;
+	int FindStealCandidate(int priority) const;
+	int FindOldestVoiceOf(SeId id) const;
+	void ReleaseVoice(int slot, bool stop);
+	void ReapFinishedVoices();
+
+	IAudioBackend* backend_ = nullptr;
+
+	std::array<Voice, kMaxVoices> voices_{};
+	std::array<SeVoiceSettings, static_cast<int>(SeId::Count)> settings_{};
+
+	// 今フレームに鳴らしたSEのスロット番号（-1: なし）
+	std::array<int, static_cast<int>(SeId::Count)> frameVoiceSlot_{};
+
+	Vector2 listenerPos_ = { 0.0f, 0.0f };
+	uint32_t frame_ = 0;
+
+	SeVoiceStats stats_;
+};
@@ -1,8 +1,82 @@
 ﻿#include "SoundManager.h"
+#include <chrono>
+#include <cstring>
+#include <vector>
 #ifdef _DEBUG
 #include <imgui.h>
 #endif
-SoundManager::SoundManager() {
+
+namespace {
+	// シーンごとの音声マニフェスト
+	struct SceneAudioManifest {
+		SceneType scene;
+		BgmId bgm;                 // シーンで流すBGM（先読みする）
+		std::vector<SeId> warmup;  // シーン開始時に先読みする頻出SE
+	};
+
+	// 常に使うSE（起動時にロード）
+	const SeId kGlobalWarmupSe[] = {
+		SeId::Select,
+		SeId::Decide,
+		SeId::Back,
+		SeId::Pause,
+	};
+
+	// 載っていないSEは初回再生時に遅延ロードされる
+	const std::vector<SceneAudioManifest>& GetSceneManifests() {
+		static const std::vector<SceneAudioManifest> manifests = {
+			{ SceneType::Title,       BgmId::Title,       {} },
+			{ SceneType::StageSelect, BgmId::None,        {} }, // ステージ選択はBGMなし
+			{ SceneType::Result,      BgmId::Title,       { SeId::PlayerStarCollect } },
+			{ SceneType::Setting,     BgmId::None,        {} },
+			{ SceneType::GamePlay,    BgmId::Tutorial,    {
+				SeId::PlayerJump,
+				SeId::PlayerDash,
+				SeId::PlayerDamage,
+				SeId::PlayerLand,
+				SeId::PlayerBoomerangThrow,
+				SeId::PlayerBoomerangFly,
+				SeId::PlayerBoomerangReturn,
+				SeId::PlayerStarCollect,
+				SeId::EnemyDamage1,
+				SeId::EnemyDamage2,
+				SeId::EnemyDamage3,
+				SeId::EnemyAttack1,
+				SeId::EnemyAttack2,
+				SeId::EnemyAttack3,
+				SeId::EnemyFindPlayer1,
+				SeId::EnemyFindPlayer2,
+				SeId::EnemyFindPlayer3,
+				SeId::StarSpawn,
+			} },
+		};
+		return manifests;
+	}
+
+	float ElapsedMs(std::chrono::steady_clock::time_point start) {
+		return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+}
+
+SoundManager::SoundManager()
+	: seVoices_(nullptr) {
+	// バックエンドとリソースは Initialize（または最初の使用時）に決める
+	SetupSeVoiceSettings();
+}
+
+void SoundManager::Initialize(std::unique_ptr<IAudioBackend> backend) {
+#ifdef _DEBUG
+	// ボイス管理の確認（モックで鳴らすので実際には音は出ない）
+	const char* failure = nullptr;
+	if (!SeVoiceManager::RunSelfCheck(&failure)) {
+		Novice::ConsolePrintf("[Sound] SeVoiceManager self check failed: %s\n", failure);
+	}
+#endif
+
+	if (backend) {
+		SetBackend(std::move(backend));
+		return;
+	}
 	LoadResources();
 }
 
@@ -11,223 +85,349 @@ void SoundManager::LoadResources() {
 		return;
 	}
 
+	// 差し替えられていなければ Novice で鳴らす
+	if (!backend_) {
+		backend_ = std::make_unique<NoviceAudioBackend>();
+		seVoices_.SetBackend(backend_.get());
+	}
+
 	// ========================================
-	// BGMのロード（ハンドル、個別音量、表示名）
+	// BGMの登録（パス、個別音量、表示名）
+	// BGMは再生時にロードし、曲を切り替えたら解放する
+	// （Novice には解放APIが無いので、Novice バックエンドでは一度読んだ曲は常駐したままになる）
 	// ========================================
-	bgmResources_[static_cast<int>(BgmId::Title)] = {
-		Novice::LoadAudio("./Resources/sounds/BGM/title.mp3"),
-		0.14f,
-		"Title BGM"
-	};
+	RegisterBgm(BgmId::Title, "./Resources/sounds/BGM/title.mp3", 0.14f, "Title BGM");
+	RegisterBgm(BgmId::StageSelect, "./Resources/sounds/BGM/title.mp3", 0.7f, "Stage Select BGM"); // 同じ曲を使う
+	RegisterBgm(BgmId::Tutorial, "./Resources/sounds/BGM/tutorial.mp3", 0.05f, "Tutorial BGM");
+	RegisterBgm(BgmId::Stage, "./Resources/sounds/BGM/stage.mp3", 0.8f, "Stage BGM");
+	RegisterBgm(BgmId::Result, "./Resources/sounds/BGM/result.mp3", 0.75f, "Result BGM");
 
-	bgmResources_[static_cast<int>(BgmId::StageSelect)] = {
-		bgmResources_[static_cast<int>(BgmId::Title)].handle, // 同じ曲を使う
-		0.7f,
-		"Stage Select BGM"
-	};
+	// ========================================
+	// SEの登録（パス、個別音量、表示名）
+	// ========================================
 
-	bgmResources_[static_cast<int>(BgmId::Tutorial)] = {
-		Novice::LoadAudio("./Resources/sounds/BGM/tutorial.mp3"),
-		0.05f,
-		"Tutorial BGM"
-	};
+	// ===== Menu SE =====
+	RegisterSe(SeId::Select, "./Resources/sounds/SE/menu/moveSelect.mp3", 1.3f, "Menu Select");
+	RegisterSe(SeId::Decide, "./Resources/sounds/SE/menu/decide.mp3", 0.5f, "Menu Decide");
+	RegisterSe(SeId::Back, "./Resources/sounds/SE/menu/cancel.mp3", 0.4f, "Menu Back");
+	RegisterSe(SeId::Pause, "./Resources/sounds/SE/menu/cancel.mp3", 0.4f, "Pause");
 
-	bgmResources_[static_cast<int>(BgmId::Stage)] = {
-		Novice::LoadAudio("./Resources/sounds/BGM/stage.mp3"),
-		0.8f,
-		"Stage BGM"
-	};
+	// ===== Game SE =====
 
-	bgmResources_[static_cast<int>(BgmId::Result)] = {
-		Novice::LoadAudio("./Resources/sounds/BGM/result.mp3"),
-		0.75f,
-		"Result BGM"
-	};
+	//----- Player SE -----
+	RegisterSe(SeId::PlayerShot, "./Resources/sounds/SE/player/shot.mp3", 0.6f, "Player Shot");
+	RegisterSe(SeId::PlayerJump, "./Resources/sounds/SE/player/jump.mp3", 0.5f, "Player Jump");
+	RegisterSe(SeId::PlayerDash, "./Resources/sounds/SE/player/dash.mp3", 10.0f, "Player Dash");
+	RegisterSe(SeId::PlayerDamage, "./Resources/sounds/SE/player/damage.mp3", 0.7f, "Player Damage");
+	RegisterSe(SeId::PlayerLand, "./Resources/sounds/SE/player/land.mp3", 0.2f, "Player Land");
+
+	// ブーメラン関連
+	RegisterSe(SeId::PlayerBoomerangThrow, "./Resources/sounds/SE/player/boomerang/throw1.mp3", 0.6f, "Player Boomerang Throw");
+	RegisterSe(SeId::PlayerBoomerangFly, "./Resources/sounds/SE/player/boomerang/fly_loop.mp3", 0.5f, "Player Boomerang Fly");
+	RegisterSe(SeId::PlayerBoomerangReturn, "./Resources/sounds/SE/player/boomerang/return.mp3", 2.6f, "Player Boomerang Return");
+
+	RegisterSe(SeId::PlayerStarCollect, "./Resources/sounds/SE/star/collect.mp3", 0.5f, "Player Star Collect");
+
+	//----- Enemy SE -----
+	RegisterSe(SeId::EnemyDamage1, "./Resources/sounds/SE/enemy/mob_damage1.mp3", 0.6f, "Enemy Damage 1");
+	RegisterSe(SeId::EnemyDamage2, "./Resources/sounds/SE/enemy/mob_damage2.mp3", 0.6f, "Enemy Damage 2");
+	RegisterSe(SeId::EnemyDamage3, "./Resources/sounds/SE/enemy/mob_damage3.mp3", 0.6f, "Enemy Damage 3");
+	RegisterSe(SeId::EnemyAttack1, "./Resources/sounds/SE/enemy/mob_attack1.mp3", 0.6f, "Enemy Attack 1");
+	RegisterSe(SeId::EnemyAttack2, "./Resources/sounds/SE/enemy/mob_attack2.mp3", 0.6f, "Enemy Attack 2");
+	RegisterSe(SeId::EnemyAttack3, "./Resources/sounds/SE/enemy/mob_attack2.mp3", 0.6f, "Enemy Attack 3"); // 仮置き
+	RegisterSe(SeId::EnemyFindPlayer1, "./Resources/sounds/SE/enemy/mob_find1.mp3", 0.6f, "Enemy Find Player 1");
+	RegisterSe(SeId::EnemyFindPlayer2, "./Resources/sounds/SE/enemy/mob_find2.mp3", 0.6f, "Enemy Find Player 2");
+	RegisterSe(SeId::EnemyFindPlayer3, "./Resources/sounds/SE/enemy/mob_find3.mp3", 0.6f, "Enemy Find Player 3");
+
+	//----- Item SE -----
+	RegisterSe(SeId::StarSpawn, "./Resources/sounds/SE/star/spawn.mp3", 0.5f, "Star Spawn");
+
+	// 登録済み（以降の EnsureSeLoaded から再び呼ばれないよう、先読みの前に立てる）
+	isLoaded_ = true;
 
 	// ========================================
-	// SEのロード（ハンドル、個別音量、表示名）
+	// 常に使うSEだけ先に読んでおく
 	// ========================================
+	for (SeId id : kGlobalWarmupSe) {
+		EnsureSeLoaded(id, false);
+	}
+}
 
-	// ===== Menu SE =====
-	seResources_[static_cast<int>(SeId::Select)] = {
-		Novice::LoadAudio("./Resources/sounds/SE/menu/moveSelect.mp3"),
-		1.3f,
-		"Menu Select"
-	};
+void SoundManager::PrepareScene(SceneType scene) {
+	const auto start = std::chrono::steady_clock::now();
 
-	seResources_[static_cast<int>(SeId::Decide)] = {
-		Novice::LoadAudio("./Resources/sounds/SE/menu/decide.mp3"),
-		0.5f,
-		"Menu Decide"
-	};
+	for (const SceneAudioManifest& manifest : GetSceneManifests()) {
+		if (manifest.scene != scene) {
+			continue;
+		}
 
-	seResources_[static_cast<int>(SeId::Back)] = {
-		Novice::LoadAudio("./Resources/sounds/SE/menu/cancel.mp3"),
-		0.4f,
-		"Menu Back"
-	};
+		if (manifest.bgm != BgmId::None) {
+			EnsureBgmLoaded(manifest.bgm);
+		}
+		for (SeId id : manifest.warmup) {
+			EnsureSeLoaded(id, false);
+		}
+		break;
+	}
 
-	seResources_[static_cast<int>(SeId::Pause)] = {
-		Novice::LoadAudio("./Resources/sounds/SE/menu/cancel.mp3"),
-		0.4f,
-		"Pause"
-	};
+	loadStats_.lastSceneLoadMs = ElapsedMs(start);
+	Novice::ConsolePrintf("[Sound] PrepareScene(%d): %.2f ms (resident %d)\n",
+		static_cast<int>(scene), loadStats_.lastSceneLoadMs, loadStats_.residentCount);
+}
 
-	// ===== Game SE =====
+void SoundManager::RegisterBgm(BgmId id, const char* path, float volume, const char* name) {
+	AudioResource& resource = bgmResources_[static_cast<int>(id)];
+	resource = {};
+	resource.path = path;
+	resource.volume = volume;
+	resource.name = name;
+}
 
-	//----- Player SE -----
+void SoundManager::RegisterSe(SeId id, const char* path, float volume, const char* name) {
+	AudioResource& resource = seResources_[static_cast<int>(id)];
+	resource = {};
+	resource.path = path;
+	resource.volume = volume;
+	resource.name = name;
+}
 
-	seResources_[static_cast<int>(SeId::PlayerShot)] = {
-		Novice::LoadAudio("./Resources/sounds/SE/player/shot.mp3"),
-		0.6f,
-		"Player Shot"
-	};
+int SoundManager::LoadAudioCached(const char* path, float& outLoadMs) {
+	outLoadMs = 0.0f;
 
-	seResources_[static_cast<int>(SeId::PlayerJump)] = {
-		Novice::LoadAudio("./Resources/sounds/SE/player/jump.mp3"),
-		0.5f,
-		"Player Jump"
-	};
-	seResources_[static_cast<int>(SeId::PlayerDash)] = {
-		Novice::LoadAudio("./Resources/sounds/SE/player/dash.mp3"),
-		10.0f,
-		"Player Dash"
-	};
-	seResources_[static_cast<int>(SeId::PlayerDamage)] = {
-		Novice::LoadAudio("./Resources/sounds/SE/player/damage.mp3"),
-		0.7f,
-		"Player Damage"
-	};
-	seResources_[static_cast<int>(SeId::PlayerLand)] = {
-		Novice::LoadAudio("./Resources/sounds/SE/player/land.mp3"),
-		0.2f,
-		"Player Land"
-	};
+	auto it = loadedHandles_.find(path);
+	if (it != loadedHandles_.end()) {
+		return it->second;
+	}
 
-	// ブーメラン関連
-	seResources_[static_cast<int>(SeId::PlayerBoomerangThrow)] = {
-		Novice::LoadAudio("./Resources/sounds/SE/player/boomerang/throw1.mp3"),
-		0.6f,
-		"Player Boomerang Throw"
-	};
-	seResources_[static_cast<int>(SeId::PlayerBoomerangFly)] = {
-		Novice::LoadAudio("./Resources/sounds/SE/player/boomerang/fly_loop.mp3"),
-		0.5f,
-		"Player Boomerang Fly"
-	};
-	seResources_[static_cast<int>(SeId::PlayerBoomerangReturn)] = {
-		Novice::LoadAudio("./Resources/sounds/SE/player/boomerang/return.mp3"),
-		2.6f,
-		"Player Boomerang Return"
-	};
+	// 一度失敗したファイルは読み直さない（再生のたびに同期ロードで止まるのを防ぐ）
+	if (failedPaths_.count(path) > 0) {
+		return -1;
+	}
 
-	seResources_[static_cast<int>(SeId::PlayerStarCollect)] = {
-		Novice::LoadAudio("./Resources/sounds/SE/star/collect.mp3"),
-		0.5f,
-		"Player Star Collect"
-	};
+	const auto start = std::chrono::steady_clock::now();
+	const int handle = backend_->LoadAudio(path);
+	outLoadMs = ElapsedMs(start);
 
-	//----- Enemy SE -----
-	seResources_[static_cast<int>(SeId::EnemyDamage1)] = {
-		Novice::LoadAudio("./Resources/sounds/SE/enemy/mob_damage1.mp3"),
-		0.6f,
-		"Enemy Damage 1"
-	};
-	seResources_[static_cast<int>(SeId::EnemyDamage2)] = {
-		Novice::LoadAudio("./Resources/sounds/SE/enemy/mob_damage2.mp3"),
-		0.6f,
-		"Enemy Damage 2"
-	};
-	seResources_[static_cast<int>(SeId::EnemyDamage3)] = {
-		Novice::LoadAudio("./Resources/sounds/SE/enemy/mob_damage3.mp3"),
-		0.6f,
-		"Enemy Damage 3"
-	};
-	seResources_[static_cast<int>(SeId::EnemyAttack1)] = {
-		Novice::LoadAudio("./Resources/sounds/SE/enemy/mob_attack1.mp3"),
-		0.6f,
-		"Enemy Attack 1"
-	};
-	seResources_[static_cast<int>(SeId::EnemyAttack2)] = {
-		Novice::LoadAudio("./Resources/sounds/SE/enemy/mob_attack2.mp3"),
-		0.6f,
-		"Enemy Attack 2"
-	};
-	seResources_[static_cast<int>(SeId::EnemyAttack3)] = {
-		Novice::LoadAudio("./Resources/sounds/SE/enemy/mob_attack2.mp3"), // 仮置き
-		0.6f,
-		"Enemy Attack 3"
-	};
-	seResources_[static_cast<int>(SeId::EnemyFindPlayer1)] = {
-		Novice::LoadAudio("./Resources/sounds/SE/enemy/mob_find1.mp3"),
-		0.6f,
-		"Enemy Find Player 1"
-	};
-	seResources_[static_cast<int>(SeId::EnemyFindPlayer2)] = {
-		Novice::LoadAudio("./Resources/sounds/SE/enemy/mob_find2.mp3"),
-		0.6f,
-		"Enemy Find Player 2"
-	};
-	seResources_[static_cast<int>(SeId::EnemyFindPlayer3)] = {
-		Novice::LoadAudio("./Resources/sounds/SE/enemy/mob_find3.mp3"),
-		0.6f,
-		"Enemy Find Player 3"
-	};
+	if (handle == -1) {
+		Novice::ConsolePrintf("[Sound] Failed to load: %s\n", path);
+		failedPaths_.insert(path);
+		return -1;
+	}
 
-	//----- Item SE -----
-	seResources_[static_cast<int>(SeId::StarSpawn)] = {
-		Novice::LoadAudio("./Resources/sounds/SE/star/spawn.mp3"),
-		0.5f,
-		"Star Spawn"
-	};
+	loadedHandles_[path] = handle;
+	loadStats_.residentCount = static_cast<int>(loadedHandles_.size());
+	loadStats_.totalLoadMs += outLoadMs;
+	loadStats_.lastLoadMs = outLoadMs;
+	return handle;
+}
 
-	isLoaded_ = true;
+bool SoundManager::EnsureBgmLoaded(BgmId id) {
+	LoadResources();
+
+	AudioResource& resource = bgmResources_[static_cast<int>(id)];
+	if (resource.handle != -1) {
+		return true;
+	}
+
+	float loadMs = 0.0f;
+	resource.handle = LoadAudioCached(resource.path, loadMs);
+	if (resource.handle == -1) {
+		return false;
+	}
+
+	resource.loadTimeMs = loadMs;
+	resource.loadCount++;
+	loadStats_.lastLoadName = resource.name;
+	Novice::ConsolePrintf("[Sound] Load BGM %s: %.2f ms\n", resource.name, loadMs);
+	return true;
+}
+
+bool SoundManager::EnsureSeLoaded(SeId id, bool isLazy) {
+	LoadResources();
+
+	AudioResource& resource = seResources_[static_cast<int>(id)];
+	if (resource.handle != -1) {
+		return true;
+	}
+
+	float loadMs = 0.0f;
+	resource.handle = LoadAudioCached(resource.path, loadMs);
+	if (resource.handle == -1) {
+		return false;
+	}
+
+	resource.loadTimeMs = loadMs;
+	resource.loadCount++;
+	loadStats_.lastLoadName = resource.name;
+	if (isLazy) {
+		// 再生の瞬間にロードが走ったもの。頻繁に出るならマニフェストのウォームアップに入れる
+		loadStats_.lazyLoads++;
+		Novice::ConsolePrintf("[Sound] Lazy load SE %s: %.2f ms\n", resource.name, loadMs);
+	}
+	else {
+		loadStats_.warmupLoads++;
+	}
+	return true;
+}
+
+void SoundManager::ReleaseBgm(BgmId id) {
+	AudioResource& resource = bgmResources_[static_cast<int>(id)];
+	if (resource.handle == -1) {
+		return;
+	}
+
+	// 解放できないバックエンド（Novice）では常駐させたままにする
+	const int handle = resource.handle;
+	if (!backend_->UnloadAudio(handle)) {
+		return;
+	}
+
+	loadedHandles_.erase(resource.path);
+	loadStats_.residentCount = static_cast<int>(loadedHandles_.size());
+	loadStats_.releasedCount++;
+
+	// 同じファイルを共有しているBGMも未ロードに戻す
+	for (AudioResource& bgm : bgmResources_) {
+		if (bgm.handle == handle) {
+			bgm.handle = -1;
+		}
+	}
+	Novice::ConsolePrintf("[Sound] Release BGM %s\n", resource.name);
 }
 
 void SoundManager::PlayBgm(BgmId id, bool loop) {
+	// None は「BGMなし」として扱う
+	if (id == BgmId::None) {
+		StopBgm();
+		return;
+	}
+
 	// 既に同じ曲が流れているなら何もしない
-	if (currentBgmId_ == id && Novice::IsPlayingAudio(currentBgmPlayHandle_)) {
+	if (currentBgmId_ == id && backend_->IsPlayingAudio(currentBgmPlayHandle_)) {
 		// 音量だけ更新
 		float finalVolume = bgmVolume_ * bgmResources_[static_cast<int>(id)].volume;
-		Novice::SetAudioVolume(currentBgmPlayHandle_, finalVolume);
+		backend_->SetAudioVolume(currentBgmPlayHandle_, finalVolume);
 		return;
 	}
 
 	// 別の曲が流れている、または停止中なら
 	StopBgm();
 
+	// 別ファイルのBGMは先に解放してから読む（同時に常駐させない）
+	const char* nextPath = bgmResources_[static_cast<int>(id)].path;
+	for (int i = 0; i < static_cast<int>(BgmId::Count); ++i) {
+		if (bgmResources_[i].handle != -1 && std::strcmp(bgmResources_[i].path, nextPath) != 0) {
+			ReleaseBgm(static_cast<BgmId>(i));
+		}
+	}
+
+	if (!EnsureBgmLoaded(id)) {
+		return;
+	}
+
 	// 新しい曲を再生
 	const AudioResource& resource = bgmResources_[static_cast<int>(id)];
-	if (resource.handle != -1) {
-		float finalVolume = bgmVolume_ * resource.volume;
-		currentBgmPlayHandle_ = Novice::PlayAudio(resource.handle, loop, finalVolume);
-		currentBgmId_ = id;
-	}
+	float finalVolume = bgmVolume_ * resource.volume;
+	currentBgmPlayHandle_ = backend_->PlayAudio(resource.handle, loop, finalVolume);
+	currentBgmId_ = id;
 }
 
 void SoundManager::StopBgm() {
-	if (currentBgmPlayHandle_ != -1 && Novice::IsPlayingAudio(currentBgmPlayHandle_)) {
-		Novice::StopAudio(currentBgmPlayHandle_);
+	if (currentBgmPlayHandle_ != -1 && backend_->IsPlayingAudio(currentBgmPlayHandle_)) {
+		backend_->StopAudio(currentBgmPlayHandle_);
 	}
 	currentBgmPlayHandle_ = -1;
 	currentBgmId_ = BgmId::None;
 }
 
+void SoundManager::Update(const Vector2& listenerPos) {
+	seVoices_.BeginFrame(listenerPos);
+}
+
 void SoundManager::PlaySe(SeId id) {
+	if (!EnsureSeLoaded(id, true)) {
+		return;
+	}
+
 	const AudioResource& resource = seResources_[static_cast<int>(id)];
-	if (resource.handle != -1) {
-		float finalVolume = seVolume_ * resource.volume;
-		Novice::PlayAudio(resource.handle, false, finalVolume);
+	float finalVolume = seVolume_ * resource.volume;
+	seVoices_.Play(id, resource.handle, finalVolume);
+}
+
+void SoundManager::PlaySe(SeId id, const Vector2& worldPos) {
+	if (!EnsureSeLoaded(id, true)) {
+		return;
 	}
+
+	const AudioResource& resource = seResources_[static_cast<int>(id)];
+	float finalVolume = seVolume_ * resource.volume;
+	seVoices_.PlayAt(id, resource.handle, finalVolume, worldPos);
+}
+
+void SoundManager::SetBackend(std::unique_ptr<IAudioBackend> backend) {
+	if (!backend) {
+		return;
+	}
+
+	StopBgm();
+	seVoices_.StopAll();
+
+	backend_ = std::move(backend);
+	seVoices_.SetBackend(backend_.get());
+
+	// ハンドルはバックエンドごとに異なるので読み込み直す
+	loadedHandles_.clear();
+	failedPaths_.clear();
+	loadStats_ = {};
+	isLoaded_ = false;
+	LoadResources();
+}
+
+void SoundManager::SetupSeVoiceSettings() {
+	// UI系：最優先、距離減衰なし
+	const SeVoiceSettings menu = { 100, 2, 0.0f, 0.0f };
+	// プレイヤー系：高優先
+	const SeVoiceSettings player = { 80, 3, 0.0f, 0.0f };
+	// アイテム系
+	const SeVoiceSettings item = { 60, 4, 700.0f, 1500.0f };
+	// 敵系：同時に大量に鳴りやすいので低優先・同時数も絞る
+	const SeVoiceSettings enemy = { 30, 2, 600.0f, 1400.0f };
+
+	seVoices_.SetSettings(SeId::Select, menu);
+	seVoices_.SetSettings(SeId::Decide, menu);
+	seVoices_.SetSettings(SeId::Back, menu);
+	seVoices_.SetSettings(SeId::Pause, menu);
+
+	seVoices_.SetSettings(SeId::PlayerShot, { 70, 4, 700.0f, 1500.0f });
+	seVoices_.SetSettings(SeId::PlayerJump, player);
+	seVoices_.SetSettings(SeId::PlayerDash, player);
+	seVoices_.SetSettings(SeId::PlayerDamage, { 90, 2, 0.0f, 0.0f });
+	seVoices_.SetSettings(SeId::PlayerLand, player);
+	seVoices_.SetSettings(SeId::PlayerBoomerangThrow, player);
+	seVoices_.SetSettings(SeId::PlayerBoomerangFly, { 70, 2, 0.0f, 0.0f });
+	seVoices_.SetSettings(SeId::PlayerBoomerangReturn, player);
+	seVoices_.SetSettings(SeId::PlayerStarCollect, { 75, 4, 0.0f, 0.0f });
+
+	seVoices_.SetSettings(SeId::EnemyDamage1, enemy);
+	seVoices_.SetSettings(SeId::EnemyDamage2, enemy);
+	seVoices_.SetSettings(SeId::EnemyDamage3, enemy);
+	seVoices_.SetSettings(SeId::EnemyAttack1, { 40, 2, 600.0f, 1400.0f });
+	seVoices_.SetSettings(SeId::EnemyAttack2, { 40, 2, 600.0f, 1400.0f });
+	seVoices_.SetSettings(SeId::EnemyAttack3, { 40, 2, 600.0f, 1400.0f });
+	seVoices_.SetSettings(SeId::EnemyFindPlayer1, { 20, 1, 600.0f, 1400.0f });
+	seVoices_.SetSettings(SeId::EnemyFindPlayer2, { 20, 1, 600.0f, 1400.0f });
+	seVoices_.SetSettings(SeId::EnemyFindPlayer3, { 20, 1, 600.0f, 1400.0f });
+
+	seVoices_.SetSettings(SeId::StarSpawn, item);
 }
 
 void SoundManager::SetBgmVolume(float volume) {
 	bgmVolume_ = volume;
 
 	// 現在再生中のBGMがあれば、即座に音量を反映
-	if (currentBgmPlayHandle_ != -1 && Novice::IsPlayingAudio(currentBgmPlayHandle_)) {
+	if (currentBgmPlayHandle_ != -1 && backend_->IsPlayingAudio(currentBgmPlayHandle_)) {
 		float finalVolume = bgmVolume_ * bgmResources_[static_cast<int>(currentBgmId_)].volume;
-		Novice::SetAudioVolume(currentBgmPlayHandle_, finalVolume);
+		backend_->SetAudioVolume(currentBgmPlayHandle_, finalVolume);
 	}
 }
 
@@ -239,9 +439,9 @@ void SoundManager::SetBgmIndividualVolume(BgmId id, float volume) {
 	bgmResources_[static_cast<int>(id)].volume = volume;
 
 	// 現在再生中のBGMならば音量を更新
-	if (currentBgmId_ == id && currentBgmPlayHandle_ != -1 && Novice::IsPlayingAudio(currentBgmPlayHandle_)) {
+	if (currentBgmId_ == id && currentBgmPlayHandle_ != -1 && backend_->IsPlayingAudio(currentBgmPlayHandle_)) {
 		float finalVolume = bgmVolume_ * volume;
-		Novice::SetAudioVolume(currentBgmPlayHandle_, finalVolume);
+		backend_->SetAudioVolume(currentBgmPlayHandle_, finalVolume);
 	}
 }
 
@@ -258,9 +458,9 @@ float SoundManager::GetSeIndividualVolume(SeId id) const {
 }
 
 void SoundManager::ApplyAudioSettings() {
-	if (currentBgmPlayHandle_ != -1 && Novice::IsPlayingAudio(currentBgmPlayHandle_)) {
+	if (currentBgmPlayHandle_ != -1 && backend_->IsPlayingAudio(currentBgmPlayHandle_)) {
 		float finalVolume = bgmVolume_ * bgmResources_[static_cast<int>(currentBgmId_)].volume;
-		Novice::SetAudioVolume(currentBgmPlayHandle_, finalVolume);
+		backend_->SetAudioVolume(currentBgmPlayHandle_, finalVolume);
 	}
 }
 
@@ -288,12 +488,16 @@ void SoundManager::ShowDebugWindow() {
 
 		for (int i = 0; i < static_cast<int>(BgmId::Count); ++i) {
 			AudioResource& resource = bgmResources_[i];
-			if (resource.handle == -1) continue;
 
 			ImGui::PushID(i);
 
-			// BGM名表示
-			ImGui::Text("%s", resource.name);
+			// BGM名とロード状態の表示
+			if (resource.handle != -1) {
+				ImGui::Text("%s  [Resident %.2f ms]", resource.name, resource.loadTimeMs);
+			}
+			else {
+				ImGui::TextDisabled("%s  [Not Loaded]", resource.name);
+			}
 
 			// 個別音量スライダー
 			if (ImGui::SliderFloat("Volume", &resource.volume, 0.0f, 0.5f, "%.2f")) {
@@ -315,6 +519,14 @@ void SoundManager::ShowDebugWindow() {
 				StopBgm();
 			}
 
+			ImGui::SameLine();
+			if (ImGui::Button("Release")) {
+				if (currentBgmId_ == static_cast<BgmId>(i)) {
+					StopBgm();
+				}
+				ReleaseBgm(static_cast<BgmId>(i));
+			}
+
 			ImGui::Separator();
 			ImGui::PopID();
 		}
@@ -326,12 +538,16 @@ void SoundManager::ShowDebugWindow() {
 
 		for (int i = 0; i < static_cast<int>(SeId::Count); ++i) {
 			AudioResource& resource = seResources_[i];
-			if (resource.handle == -1) continue;
 
 			ImGui::PushID(1000 + i); // IDの衝突を避ける
 
-			// SE名表示
-			ImGui::Text("%s", resource.name);
+			// SE名とロード状態の表示
+			if (resource.handle != -1) {
+				ImGui::Text("%s  [Resident %.2f ms]", resource.name, resource.loadTimeMs);
+			}
+			else {
+				ImGui::TextDisabled("%s  [Not Loaded]", resource.name);
+			}
 
 			// 個別音量スライダー
 			if (ImGui::SliderFloat("Volume", &resource.volume, 0.0f, 5.0f, "%.2f")) {
@@ -343,15 +559,66 @@ void SoundManager::ShowDebugWindow() {
 			ImGui::SameLine();
 			ImGui::Text("(Final: %.2f)", finalVolume);
 
+			// ボイス設定
+			SeVoiceSettings& voiceSettings = seVoices_.GetSettings(static_cast<SeId>(i));
+			ImGui::SliderInt("Priority", &voiceSettings.priority, 0, 100);
+			ImGui::SliderInt("Max Voices", &voiceSettings.maxConcurrent, 1, SeVoiceManager::kMaxVoices);
+
 			// プレビュー再生ボタン
 			if (ImGui::Button("Play")) {
 				PlaySe(static_cast<SeId>(i));
 			}
 
+			if (resource.handle == -1) {
+				ImGui::SameLine();
+				if (ImGui::Button("Load")) {
+					EnsureSeLoaded(static_cast<SeId>(i), false);
+				}
+			}
+
 			ImGui::Separator();
 			ImGui::PopID();
 		}
 
+		// ========== SEボイス情報 ==========
+		ImGui::Spacing();
+		ImGui::SeparatorText("SE Voices");
+
+		const SeVoiceStats& stats = seVoices_.GetStats();
+		ImGui::Text("Active: %d / %d (Peak: %d)", stats.activeVoices, SeVoiceManager::kMaxVoices, stats.peakVoices);
+		ImGui::ProgressBar(static_cast<float>(stats.activeVoices) / SeVoiceManager::kMaxVoices, ImVec2(-1, 0), "");
+		ImGui::Text("Frame  : req %d / play %d / merge %d / steal %d / drop %d / cull %d",
+			stats.frameRequests, stats.framePlayed, stats.frameCoalesced,
+			stats.frameStolen, stats.frameDropped, stats.frameCulled);
+		ImGui::Text("Total  : play %u / merge %u / steal %u / drop %u / cull %u",
+			stats.totalPlayed, stats.totalCoalesced, stats.totalStolen, stats.totalDropped, stats.totalCulled);
+		if (ImGui::Button("Reset Stats")) {
+			seVoices_.ResetStats();
+		}
+		ImGui::SameLine();
+		if (ImGui::Button("Run Self Check")) {
+			const char* failure = nullptr;
+			const bool isPassed = SeVoiceManager::RunSelfCheck(&failure);
+			Novice::ConsolePrintf("[Sound] SeVoiceManager self check: %s\n", isPassed ? "OK" : failure);
+		}
+
+		for (int i = 0; i < static_cast<int>(SeId::Count); ++i) {
+			if (stats.activePerSe[i] > 0) {
+				ImGui::BulletText("%s: %d", seResources_[i].name, stats.activePerSe[i]);
+			}
+		}
+
+		// ========== ロード情報 ==========
+		ImGui::Spacing();
+		ImGui::SeparatorText("Audio Loading");
+
+		ImGui::Text("Resident Files: %d", loadStats_.residentCount);
+		ImGui::Text("Loads  : warmup %d / lazy %d / released %d",
+			loadStats_.warmupLoads, loadStats_.lazyLoads, loadStats_.releasedCount);
+		ImGui::Text("Total Load: %.2f ms", loadStats_.totalLoadMs);
+		ImGui::Text("Last Load : %s (%.2f ms)", loadStats_.lastLoadName, loadStats_.lastLoadMs);
+		ImGui::Text("Last Scene: %.2f ms", loadStats_.lastSceneLoadMs);
+
 		// ========== 現在のBGM情報 ==========
 		ImGui::Spacing();
 		ImGui::SeparatorText("Current BGM");
@@ -360,7 +627,7 @@ void SoundManager::ShowDebugWindow() {
 			const AudioResource& current = bgmResources_[static_cast<int>(currentBgmId_)];
 			ImGui::Text("Playing: %s", current.name);
 			ImGui::Text("Handle: %d", currentBgmPlayHandle_);
-			ImGui::Text("Is Playing: %s", Novice::IsPlayingAudio(currentBgmPlayHandle_) ? "Yes" : "No");
+			ImGui::Text("Is Playing: %s", backend_ && backend_->IsPlayingAudio(currentBgmPlayHandle_) ? "Yes" : "No");
 		}
 		else {
 			ImGui::Text("No BGM playing");
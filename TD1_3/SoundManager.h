@@ -1,64 +1,14 @@
 ﻿#pragma once
 #include <array>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include "Novice.h"
-
-// BGMの識別ID
-enum class BgmId {
-	None = -1,
-	Title,
-	StageSelect,
-	Tutorial,
-	Stage,
-	Result,
-	Count // 総数
-};
-
-// SEの識別ID
-enum class SeId {
-	// Menu
-	Select,
-	Decide,
-	Back,
-	Pause,
-
-	// Game
-	PlayerShot,
-
-	// Player
-	PlayerJump,
-	PlayerDash,
-	PlayerDamage,
-	PlayerLand,
-	PlayerBoomerangThrow,
-	PlayerBoomerangFly,
-	PlayerBoomerangReturn,
-	PlayerStarCollect,
-
-	// Enemy
-	EnemyDamage1,
-	EnemyDamage2,
-	EnemyDamage3,
-
-	EnemyAttack1,
-	EnemyAttack2,
-	EnemyAttack3,
-
-	EnemyFindPlayer1,
-	EnemyFindPlayer2,
-	EnemyFindPlayer3,
-
-	// Item
-	StarSpawn,
-
-	Count // 総数
-};
-
-// 音声リソース構造体
-struct AudioResource {
-	int handle = -1;        // Noviceのハンドル
-	float volume = 1.0f;    // 個別音量（0.0f～1.0f）
-	const char* name = "";  // 表示名（デバッグ用）
-};
+#include "AudioTypes.h"
+#include "AudioBackend.h"
+#include "SeVoiceManager.h"
+#include "SceneType.h"
 
 class SoundManager {
 public:
@@ -72,15 +22,32 @@ public:
 	SoundManager(const SoundManager&) = delete;
 	SoundManager& operator=(const SoundManager&) = delete;
 
+	// 再生バックエンドを決めてリソースを登録する（nullptr なら Novice）
+	// 呼ばなくても最初の先読み・再生で Novice バックエンドとして初期化される
+	void Initialize(std::unique_ptr<IAudioBackend> backend = nullptr);
+
+	// リソース情報の登録と常時使うSEのウォームアップ（実ファイルは必要になるまで読まない）
 	void LoadResources();
 
+	// シーン開始前に呼ぶ（シーンのBGMと頻出SEを先読みする）
+	void PrepareScene(SceneType scene);
+
 	// BGM再生・停止
 	void PlayBgm(BgmId id, bool loop = true);
 	void StopBgm();
 
+	// フレーム開始時に1回呼ぶ（SEボイスの回収、リスナー位置の更新）
+	void Update(const Vector2& listenerPos);
+
 	// SE再生
 	void PlaySe(SeId id);
 
+	// 位置付きSE再生（リスナーからの距離で減衰・カリング）
+	void PlaySe(SeId id, const Vector2& worldPos);
+
+	// 再生バックエンドの差し替え（テスト用のモックなど）
+	void SetBackend(std::unique_ptr<IAudioBackend> backend);
+
 	// 音量設定（グローバル）
 	void SetBgmVolume(float volume);
 	void SetSeVolume(float volume);
@@ -107,14 +74,53 @@ public:
 	const std::array<AudioResource, static_cast<int>(BgmId::Count)>& GetBgmResources() const { return bgmResources_; }
 	const std::array<AudioResource, static_cast<int>(SeId::Count)>& GetSeResources() const { return seResources_; }
 
+	// SEボイス管理
+	SeVoiceManager& GetSeVoiceManager() { return seVoices_; }
+
+	// ロード計測情報
+	const AudioLoadStats& GetLoadStats() const { return loadStats_; }
+
 private:
 	SoundManager();
 	~SoundManager() = default;
 
+	// SEごとの優先度・同時発音数の設定
+	void SetupSeVoiceSettings();
+
+	// リソース情報の登録（ロードはしない）
+	void RegisterBgm(BgmId id, const char* path, float volume, const char* name);
+	void RegisterSe(SeId id, const char* path, float volume, const char* name);
+
+	// 同じファイルは1回だけ読む（失敗時 -1）
+	int LoadAudioCached(const char* path, float& outLoadMs);
+
+	// 未ロードならロードする（ロード済み・成功時 true）
+	bool EnsureBgmLoaded(BgmId id);
+	bool EnsureSeLoaded(SeId id, bool isLazy);
+
+	// BGMを解放する（同じファイルを使うBGMもまとめて未ロードに戻る）
+	// バックエンドが解放に対応していなければ何もしない（Novice では常駐したまま）
+	void ReleaseBgm(BgmId id);
+
+	// 再生バックエンド（Initialize か最初の LoadResources で決まる）
+	std::unique_ptr<IAudioBackend> backend_;
+
+	// SEのボイス管理
+	SeVoiceManager seVoices_;
+
 	// リソース配列
 	std::array<AudioResource, static_cast<int>(BgmId::Count)> bgmResources_;
 	std::array<AudioResource, static_cast<int>(SeId::Count)> seResources_;
 
+	// ロード済みファイル（パス → ハンドル）
+	std::unordered_map<std::string, int> loadedHandles_;
+
+	// ロードに失敗したファイル（同じファイルの再ロードを試みない）
+	std::unordered_set<std::string> failedPaths_;
+
+	// ロード計測
+	AudioLoadStats loadStats_;
+
 	// グローバル音量
 	float bgmVolume_ = 0.3f;
 	float seVolume_ = 0.3f;
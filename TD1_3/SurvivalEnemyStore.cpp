@@ -0,0 +1,383 @@
+﻿#include "SurvivalEnemyStore.h"
+#include "SurvivalSpatialGrid.h"
+#include "Camera2D.h"
+#include "Matrix3x3.h"
+#include "Novice.h"
+#include "WindowSize.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+
+namespace {
+    // タイプ別パラメータ
+    struct EnemyTypeParam {
+        int hp;
+        float radius;
+        float speed;
+        unsigned int color;
+    };
+
+    const EnemyTypeParam kTypeParams[] = {
+        { 2, 12.0f, 100.0f, 0xFF4444FF },  // Normal : 明るい赤
+        { 15, 24.0f, 40.0f, 0x882222FF },  // Tank   : 濃い赤
+    };
+
+    const EnemyTypeParam& GetTypeParam(EnemyType type) {
+        return kTypeParams[static_cast<int>(type)];
+    }
+
+    const unsigned int kKnockbackColor = 0xFFFFFFFF; // 白飛び演出
+    const float kSquashDuration = 0.1f;
+
+    // 押し合いで1フレームに動かす最大距離（大群が一気に弾けないように）
+    const float kMaxSeparationStep = 4.0f;
+}
+
+// ==========================================
+// 生成・削除
+// ==========================================
+SurvivalEnemyHandle SurvivalEnemyStore::Spawn(const Vector2& pos, EnemyType type) {
+    const EnemyTypeParam& param = GetTypeParam(type);
+
+    // スロット確保（空きがあれば再利用）
+    uint32_t slotIndex;
+    if (!freeSlots_.empty()) {
+        slotIndex = freeSlots_.back();
+        freeSlots_.pop_back();
+    }
+    else {
+        slotIndex = static_cast<uint32_t>(slots_.size());
+        slots_.push_back(Slot{});
+    }
+
+    const uint32_t dense = static_cast<uint32_t>(positions_.size());
+    Slot& slot = slots_[slotIndex];
+    slot.dense = dense;
+    slot.isUsed = true;
+
+    positions_.push_back(pos);
+    knockbackVel_.push_back({ 0.0f, 0.0f });
+    knockbackTime_.push_back(0.0f);
+    squashTime_.push_back(0.0f);
+    hitInvincibility_.push_back(0.0f);
+    radii_.push_back(param.radius);
+    speeds_.push_back(param.speed);
+    hp_.push_back(param.hp);
+    types_.push_back(type);
+    denseToSlot_.push_back(slotIndex);
+
+    return { slotIndex, slot.generation };
+}
+
+void SurvivalEnemyStore::RemoveAt(int index) {
+    const int last = Size() - 1;
+
+    // スロットを無効化（世代を進めて古いハンドルを弾く）
+    Slot& removed = slots_[denseToSlot_[index]];
+    removed.isUsed = false;
+    removed.generation++;
+    freeSlots_.push_back(denseToSlot_[index]);
+
+    // 末尾を削除位置へ移す
+    if (index != last) {
+        positions_[index] = positions_[last];
+        knockbackVel_[index] = knockbackVel_[last];
+        knockbackTime_[index] = knockbackTime_[last];
+        squashTime_[index] = squashTime_[last];
+        hitInvincibility_[index] = hitInvincibility_[last];
+        radii_[index] = radii_[last];
+        speeds_[index] = speeds_[last];
+        hp_[index] = hp_[last];
+        types_[index] = types_[last];
+        denseToSlot_[index] = denseToSlot_[last];
+        slots_[denseToSlot_[index]].dense = static_cast<uint32_t>(index);
+    }
+
+    positions_.pop_back();
+    knockbackVel_.pop_back();
+    knockbackTime_.pop_back();
+    squashTime_.pop_back();
+    hitInvincibility_.pop_back();
+    radii_.pop_back();
+    speeds_.pop_back();
+    hp_.pop_back();
+    types_.pop_back();
+    denseToSlot_.pop_back();
+}
+
+int SurvivalEnemyStore::RemoveDead() {
+    int removedCount = 0;
+
+    // 後ろから見ると、入れ替えで持ってくる要素は確認済みになる
+    for (int i = Size() - 1; i >= 0; --i) {
+        if (hp_[i] <= 0) {
+            RemoveAt(i);
+            removedCount++;
+        }
+    }
+    return removedCount;
+}
+
+void SurvivalEnemyStore::Clear() {
+    positions_.clear();
+    knockbackVel_.clear();
+    knockbackTime_.clear();
+    squashTime_.clear();
+    hitInvincibility_.clear();
+    radii_.clear();
+    speeds_.clear();
+    hp_.clear();
+    types_.clear();
+    denseToSlot_.clear();
+
+    // 既存ハンドルを無効化するため、世代は残したまま全スロットを空きにする
+    freeSlots_.clear();
+    for (uint32_t i = 0; i < static_cast<uint32_t>(slots_.size()); ++i) {
+        if (slots_[i].isUsed) {
+            slots_[i].isUsed = false;
+            slots_[i].generation++;
+        }
+        freeSlots_.push_back(i);
+    }
+}
+
+void SurvivalEnemyStore::Reserve(size_t capacity) {
+    positions_.reserve(capacity);
+    knockbackVel_.reserve(capacity);
+    knockbackTime_.reserve(capacity);
+    squashTime_.reserve(capacity);
+    hitInvincibility_.reserve(capacity);
+    radii_.reserve(capacity);
+    speeds_.reserve(capacity);
+    hp_.reserve(capacity);
+    types_.reserve(capacity);
+    denseToSlot_.reserve(capacity);
+    slots_.reserve(capacity);
+}
+
+// ==========================================
+// ハンドル
+// ==========================================
+int SurvivalEnemyStore::GetIndex(SurvivalEnemyHandle handle) const {
+    if (handle.IsNull() || handle.slot >= slots_.size()) return -1;
+
+    const Slot& slot = slots_[handle.slot];
+    if (!slot.isUsed || slot.generation != handle.generation) return -1;
+    return static_cast<int>(slot.dense);
+}
+
+SurvivalEnemyHandle SurvivalEnemyStore::GetHandle(int index) const {
+    const uint32_t slotIndex = denseToSlot_[index];
+    return { slotIndex, slots_[slotIndex].generation };
+}
+
+// ==========================================
+// 一括更新
+// ==========================================
+void SurvivalEnemyStore::Update(float dt, const Vector2& targetPos) {
+    const int count = Size();
+
+    for (int i = 0; i < count; ++i) {
+        if (hitInvincibility_[i] > 0.0f) hitInvincibility_[i] -= dt;
+        if (squashTime_[i] > 0.0f) squashTime_[i] -= dt;
+
+        if (knockbackTime_[i] > 0.0f) {
+            // --- ノックバック中 ---
+            knockbackTime_[i] -= dt;
+            positions_[i] += knockbackVel_[i] * dt;
+            knockbackVel_[i] *= 0.9f; // 摩擦で減速
+            continue;
+        }
+
+        // --- 通常AI（追尾） ---
+        const float dx = targetPos.x - positions_[i].x;
+        const float dy = targetPos.y - positions_[i].y;
+        const float distSq = dx * dx + dy * dy;
+        if (distSq > 1.0f) {
+            const float step = speeds_[i] * dt / std::sqrt(distSq);
+            positions_[i].x += dx * step;
+            positions_[i].y += dy * step;
+        }
+    }
+}
+
+void SurvivalEnemyStore::Hit(int index, int damage, const Vector2& knockbackDir, float knockbackPower) {
+    // 無敵時間中・倒された後はスキップ
+    if (hitInvincibility_[index] > 0.0f || hp_[index] <= 0) return;
+
+    hp_[index] -= damage;
+
+    // ノックバック適用（強い攻撃ほど長く飛ぶ）
+    knockbackVel_[index] = knockbackDir * knockbackPower;
+    knockbackTime_[index] = 0.2f + (knockbackPower / 2000.0f);
+
+    // ヒット演出：つぶれる
+    squashTime_[index] = kSquashDuration;
+}
+
+float SurvivalEnemyStore::GetMaxRadius() {
+    float maxRadius = 0.0f;
+    for (const auto& param : kTypeParams) {
+        maxRadius = (std::max)(maxRadius, param.radius);
+    }
+    return maxRadius;
+}
+
+void SurvivalEnemyStore::ResolveSeparation(const SurvivalSpatialGrid& grid, float strength) {
+    const int count = Size();
+    separation_.assign(count, { 0.0f, 0.0f });
+
+    const float maxRadius = GetMaxRadius();
+
+    // 各ペアは i < j の側だけで処理し、両方に半分ずつ押し戻しを積む
+    for (int i = 0; i < count; ++i) {
+        const Vector2 pos = positions_[i];
+        const float radius = radii_[i];
+
+        grid.QueryCircle(pos, radius + maxRadius, [&](int j) {
+            if (j <= i) return;
+
+            const float dx = positions_[j].x - pos.x;
+            const float dy = positions_[j].y - pos.y;
+            const float minDist = radius + radii_[j];
+            const float distSq = dx * dx + dy * dy;
+            if (distSq >= minDist * minDist) return;
+
+            // 完全に重なっている場合は添字から適当な方向を作る
+            float nx = 1.0f, ny = 0.0f;
+            float dist = 0.0f;
+            if (distSq > 1e-6f) {
+                dist = std::sqrt(distSq);
+                nx = dx / dist;
+                ny = dy / dist;
+            }
+            else {
+                const float angle = static_cast<float>((i * 7 + j * 13) % 360) * 3.14159265f / 180.0f;
+                nx = std::cos(angle);
+                ny = std::sin(angle);
+            }
+
+            const float push = (minDist - dist) * 0.5f * strength;
+            separation_[i].x -= nx * push;
+            separation_[i].y -= ny * push;
+            separation_[j].x += nx * push;
+            separation_[j].y += ny * push;
+        });
+    }
+
+    // まとめて反映（ノックバック中の敵も押される）
+    for (int i = 0; i < count; ++i) {
+        Vector2 offset = separation_[i];
+        const float lenSq = offset.x * offset.x + offset.y * offset.y;
+        if (lenSq > kMaxSeparationStep * kMaxSeparationStep) {
+            offset *= kMaxSeparationStep / std::sqrt(lenSq);
+        }
+        positions_[i] += offset;
+    }
+}
+
+// ==========================================
+// 描画
+// ==========================================
+void SurvivalEnemyStore::Draw(const Camera2D& camera, int textureHandle) const {
+    const Matrix3x3& vpMatrix = camera.GetVpVpMatrix();
+    const float zoom = camera.GetZoom();
+    const int count = Size();
+
+    for (int i = 0; i < count; ++i) {
+        const Vector2 screenPos = Matrix3x3::Transform(positions_[i], vpMatrix);
+
+        float halfW = radii_[i] * zoom;
+        float halfH = halfW;
+        if (squashTime_[i] > 0.0f) {
+            halfW *= 1.3f;
+            halfH *= 0.7f;
+        }
+
+        // 画面外は描かない
+        if (screenPos.x + halfW < 0.0f || screenPos.x - halfW > kWindowWidth ||
+            screenPos.y + halfH < 0.0f || screenPos.y - halfH > kWindowHeight) {
+            continue;
+        }
+
+        const unsigned int color = (knockbackTime_[i] > 0.0f) ? kKnockbackColor : GetTypeParam(types_[i]).color;
+
+        Novice::DrawQuad(
+            static_cast<int>(screenPos.x - halfW), static_cast<int>(screenPos.y - halfH),
+            static_cast<int>(screenPos.x + halfW), static_cast<int>(screenPos.y - halfH),
+            static_cast<int>(screenPos.x - halfW), static_cast<int>(screenPos.y + halfH),
+            static_cast<int>(screenPos.x + halfW), static_cast<int>(screenPos.y + halfH),
+            0, 0, 1, 1,
+            textureHandle,
+            color
+        );
+    }
+}
+
+// ==========================================
+// ベンチマーク
+// ==========================================
+SurvivalBenchmarkResult SurvivalEnemyStore::RunBenchmark(int enemyCount, int frames) {
+    SurvivalBenchmarkResult result;
+    result.enemyCount = enemyCount;
+    result.frames = frames;
+    if (enemyCount <= 0 || frames <= 0) return result;
+
+    SurvivalEnemyStore store;
+    store.Reserve(static_cast<size_t>(enemyCount));
+
+    // プレイヤーを中心にばらまく（計測中に接触・撃破・削除も起きる距離）
+    const Vector2 center = { kWindowWidth / 2.0f, kWindowHeight / 2.0f };
+    for (int i = 0; i < enemyCount; ++i) {
+        const float angle = static_cast<float>(rand() % 3600) * 3.14159265f / 1800.0f;
+        const float dist = 50.0f + static_cast<float>(rand() % 750);
+        const EnemyType type = (rand() % 5 == 0) ? EnemyType::Tank : EnemyType::Normal;
+        store.Spawn({ center.x + std::cos(angle) * dist, center.y + std::sin(angle) * dist }, type);
+    }
+
+    const float dt = 1.0f / 60.0f;
+    double totalMs = 0.0;
+    SurvivalSpatialGrid grid;
+
+    // デブリの代わりにプレイヤー周りを回る64個の判定円（ゲーム側の判定と同じ処理量）
+    const int kProbeCount = 64;
+    const float kProbeRadius = 6.0f;
+
+    for (int frame = 0; frame < frames; ++frame) {
+        auto start = std::chrono::steady_clock::now();
+
+        store.Update(dt, center);
+        grid.Build(store.positions_);
+        store.ResolveSeparation(grid, 0.5f);
+
+        const float queryMargin = GetMaxRadius() + kMaxSeparationStep;
+        for (int p = 0; p < kProbeCount; ++p) {
+            const float angle = (static_cast<float>(p) / kProbeCount + frame * 0.01f) * 6.2831853f;
+            const Vector2 probePos = { center.x + std::cos(angle) * 200.0f, center.y + std::sin(angle) * 200.0f };
+
+            grid.QueryCircle(probePos, kProbeRadius + queryMargin, [&](int i) {
+                const Vector2 diff = store.positions_[i] - probePos;
+                const float hitRadius = store.radii_[i] + kProbeRadius;
+                if (diff.x * diff.x + diff.y * diff.y < hitRadius * hitRadius) {
+                    store.Hit(i, 1, Vector2::Normalize(store.positions_[i] - center), 400.0f);
+                }
+            });
+        }
+
+        result.removedCount += store.RemoveDead();
+
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        const float ms = std::chrono::duration<float, std::milli>(elapsed).count();
+        totalMs += ms;
+        if (ms > result.maxFrameMs) result.maxFrameMs = ms;
+    }
+
+    result.avgFrameMs = static_cast<float>(totalMs / frames);
+
+#ifdef _DEBUG
+    Novice::ConsolePrintf("[SurvivalEnemyStore] Benchmark: %d enemies, %d frames, avg %.3f ms, max %.3f ms, removed %d\n",
+        result.enemyCount, result.frames, result.avgFrameMs, result.maxFrameMs, result.removedCount);
+#endif
+    return result;
+}
@@ -0,0 +1,127 @@
+﻿#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Vector2.h"
+
+class Camera2D;
+class SurvivalSpatialGrid;
+
+enum class EnemyType { Normal, Tank };
+
+// ==========================================
+// 敵ハンドル（スロット番号 + 世代）
+// 倒された敵のスロットは再利用されるので、世代が一致するときだけ有効
+// ==========================================
+struct SurvivalEnemyHandle {
+    static constexpr uint32_t kInvalidSlot = 0xFFFFFFFF;
+
+    uint32_t slot = kInvalidSlot;
+    uint32_t generation = 0;
+
+    bool IsNull() const { return slot == kInvalidSlot; }
+};
+
+// ==========================================
+// ベンチマーク結果
+// ==========================================
+struct SurvivalBenchmarkResult {
+    int enemyCount = 0;
+    int frames = 0;
+    float avgFrameMs = 0.0f; // 1フレームあたりの平均（更新 + 判定 + 削除）
+    float maxFrameMs = 0.0f;
+    int removedCount = 0;    // 計測中に倒された数
+};
+
+/// <summary>
+/// サバイバル用の敵をまとめて持つストア
+/// 位置・ノックバック・HPなどを種類ごとの連続配列で持ち（SoA）、
+/// 追尾とノックバックは Update で一括処理する。
+/// 倒された敵は末尾と入れ替えて詰める（swap-remove）ので、添字は削除のたびに変わる。
+/// フレームをまたいで敵を指すときは SurvivalEnemyHandle を使うこと
+/// </summary>
+class SurvivalEnemyStore {
+public:
+    // ========== 生成・削除 ==========
+    SurvivalEnemyHandle Spawn(const Vector2& pos, EnemyType type);
+
+    // HPが0以下になった敵をまとめて削除する（削除数を返す）
+    int RemoveDead();
+
+    void Clear();
+    void Reserve(size_t capacity);
+
+    // ========== ハンドル ==========
+    bool IsAlive(SurvivalEnemyHandle handle) const { return GetIndex(handle) >= 0; }
+
+    // 現在の添字（無効なハンドルなら -1）
+    int GetIndex(SurvivalEnemyHandle handle) const;
+    SurvivalEnemyHandle GetHandle(int index) const;
+
+    // ========== 一括更新 ==========
+    // 追尾（ノックバック中はノックバック移動）と各タイマーの更新
+    void Update(float dt, const Vector2& targetPos);
+
+    // ========== 添字指定の操作（判定ループ用） ==========
+    void Hit(int index, int damage, const Vector2& knockbackDir, float knockbackPower);
+    void PushBack(int index, const Vector2& offset) { positions_[index] += offset; }
+
+    /// <summary>
+    /// 敵同士の押し合い（重なりを解消して群れが1点に潰れないようにする）
+    /// grid は現在の位置で Build 済みであること
+    /// </summary>
+    /// <param name="strength">1フレームで解消する重なりの割合（0～1）</param>
+    void ResolveSeparation(const SurvivalSpatialGrid& grid, float strength);
+
+    // 全タイプ中の最大半径（グリッド検索の余白に使う）
+    static float GetMaxRadius();
+
+    // ========== 描画 ==========
+    void Draw(const Camera2D& camera, int textureHandle) const;
+
+    // ========== アクセサ ==========
+    int Size() const { return static_cast<int>(positions_.size()); }
+    bool IsEmpty() const { return positions_.empty(); }
+
+    const Vector2& GetPosition(int index) const { return positions_[index]; }
+    float GetRadius(int index) const { return radii_[index]; }
+    EnemyType GetType(int index) const { return types_[index]; }
+    int GetHP(int index) const { return hp_[index]; }
+    bool IsDead(int index) const { return hp_[index] <= 0; }
+    bool IsInvincible(int index) const { return hitInvincibility_[index] > 0.0f; }
+
+    // 連続配列への直接アクセス（判定などの一括処理用）
+    const std::vector<Vector2>& GetPositions() const { return positions_; }
+    const std::vector<float>& GetRadii() const { return radii_; }
+
+    // ========== ベンチマーク ==========
+    // enemyCount 体を生成して frames フレーム分の更新・判定・削除を計測する
+    static SurvivalBenchmarkResult RunBenchmark(int enemyCount, int frames);
+
+private:
+    void RemoveAt(int index);
+
+    // ---- 連続配列（添字 = dense index） ----
+    std::vector<Vector2> positions_;
+    std::vector<Vector2> knockbackVel_;
+    std::vector<float> knockbackTime_;
+    std::vector<float> squashTime_;
+    std::vector<float> hitInvincibility_;
+    std::vector<float> radii_;
+    std::vector<float> speeds_;
+    std::vector<int> hp_;
+    std::vector<EnemyType> types_;
+    std::vector<uint32_t> denseToSlot_;
+
+    // 押し合いの作業領域（毎フレーム使い回す）
+    std::vector<Vector2> separation_;
+
+    // ---- スロット（ハンドル → dense index） ----
+    struct Slot {
+        uint32_t dense = 0;
+        uint32_t generation = 0;
+        bool isUsed = false;
+    };
+    std::vector<Slot> slots_;
+    std::vector<uint32_t> freeSlots_;
+};
@@ -2,6 +2,8 @@
 #include "SurvivalObjects.h" // 各クラスの定義が必要
 #include "Vector2.h"
 #include <cassert>
+#include <chrono>
+#include "TextureManager.h"
 
 SurvivalGameObjectManager::SurvivalGameObjectManager() {}
 SurvivalGameObjectManager::~SurvivalGameObjectManager() { Clear(); }
@@ -16,15 +18,11 @@ void SurvivalGameObjectManager::AddObject(const std::shared_ptr<GameObject2D>& o
     obj->SetTexture(TextureId::White1x1);
 
     objects_.push_back(obj);
-
-    if (auto enemy = std::dynamic_pointer_cast<SurvivalEnemy>(obj)) {
-        enemies_.push_back(enemy);
-    }
 }
 
 void SurvivalGameObjectManager::Clear() {
     objects_.clear();
-    enemies_.clear();
+    enemies_.Clear();
     player_.reset();
     debrisController_.reset();
 }
@@ -43,23 +41,36 @@ void SurvivalGameObjectManager::Update(float deltaTime) {
         ++it;
     }
 
-    // 死んだ敵をenemies_リストからも削除
-    enemies_.remove_if([](const std::shared_ptr<SurvivalEnemy>& e) {
-        if (e->GetInfo().isActive == false) {
-            e->Destroy();
-            return true;
-        }
-        return false;
-        });
+    auto start = std::chrono::steady_clock::now();
+
+    // 2. 敵の一括更新（追尾 + ノックバック）
+    if (player_) {
+        enemies_.Update(deltaTime, player_->GetPosition());
+    }
+
+    // 3. グリッドを作り直して敵同士の押し合い
+    enemyGrid_.Build(enemies_.GetPositions());
+    enemies_.ResolveSeparation(enemyGrid_, separationStrength_);
 
-    // 2. 衝突判定
+    // 4. 衝突判定（グリッドで候補を絞る）
     CheckCollisions();
+
+    // 5. 倒された敵をまとめて詰める
+    enemies_.RemoveDead();
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    lastEnemyUpdateMs_ = std::chrono::duration<float, std::milli>(elapsed).count();
 }
 
 void SurvivalGameObjectManager::Draw(const Camera2D& camera) {
     for (auto& obj : objects_) {
         obj->Draw(camera);
     }
+
+    if (enemyTexture_ < 0) {
+        enemyTexture_ = TextureManager::GetInstance().GetTexture(TextureId::White1x1);
+    }
+    enemies_.Draw(camera, enemyTexture_);
 }
 
 void SurvivalGameObjectManager::CheckCollisions() {
@@ -73,66 +84,49 @@ void SurvivalGameObjectManager::CheckCollisions() {
     //bool isDefense = debrisController_->IsExpanding();
     bool isCritical = debrisController_->IsCritical();
 
-    // A. 敵 vs プレイヤー & デブリ
-    for (auto& enemy : enemies_) {
-        // 死んでる敵は無視（※実装次第）
-        // if (!enemy->IsAlive()) continue;
+    const auto& pieces = debrisController_->GetPieces();
+    const float debrisRadius = 6.0f; // 半径
+
+    // グリッドは押し合い前の位置で作っているので、押し合い・押し出しで動く分も余白に含める
+    const float queryMargin = SurvivalEnemyStore::GetMaxRadius() + 8.0f;
 
-        Vector2 enemyPos = enemy->GetPosition();
-        float enemyRadius = enemy->GetRadius();
+    // A. プレイヤー vs 敵（ゲームオーバー判定）
+    enemyGrid_.QueryCircle(playerPos, playerRadius + queryMargin, [&](int i) {
+        if (enemies_.IsDead(i)) return;
 
-        // 1. 敵 vs プレイヤー（ゲームオーバー判定）
+        const Vector2 enemyPos = enemies_.GetPosition(i);
         float distToPlayer = Vector2::Length(enemyPos - playerPos);
-        if (distToPlayer < playerRadius + enemyRadius) {
+        if (distToPlayer < playerRadius + enemies_.GetRadius(i)) {
             player_->OnDamage();
             // プレイヤーを守るために少し弾く
-            enemy->OnHit(0, Vector2::Normalize(enemyPos - playerPos), 500.0f);
+            enemies_.Hit(i, 0, Vector2::Normalize(enemyPos - playerPos), 500.0f);
         }
-
-        // 2. 敵 vs デブリ（総当たりは重いので、距離で簡易フィルタリングすべきだが、今回はプロトなので総当たり）
-        // DebrisControllerが持つ pieces_ にアクセスする手段が必要。
-        // ※SurvivalObjects.h の DebrisController に GetPieces() を追加するか、
-        // Managerが pieces を知っている必要がある。
-        // ここでは「SurvivalObjects.h」に追加したと仮定して GetPieces() を呼ぶか、
-        // あるいは objects_ の中から DebrisPiece を探す。
-        // 一番きれいなのは DebrisController が判定メソッドを持つことだが、今回はここでやる。
-
-        // 暫定：DebrisController はフレンドまたはアクセサ経由で pieces_ を公開してください。
-        // ここでは擬似コード的に書きます。
-        // const auto& pieces = debrisController_->GetPieces(); 
-        // というメソッドを作ってください！
-
-        // ↓ 仕方ないので objects_ から dynamic_cast で探す（重いが確実）
-        // 実際は DebrisController::GetPieces() を推奨
-
-        // ★修正案：前のコードで DebrisPiece も AddObject しているので、objects_ に混ざっています。
-        // objects_ループだと効率悪いので、Managerに debrisPieces_ リストも持たせるのがベスト。
-
-        // ここではロジックの意図を示すため、「Managerがデブリ片のリストを持っている」と仮定します。
-        // 実装時は AddObject で DebrisPiece だった場合に debrisPieces_ にもポインタを入れてください。
-
-        for (auto& piece : debrisController_->GetPieces()) {
-            Vector2 debrisPos = piece->GetActualPosition(); // 慣性適用後の座標
-            float debrisRadius = 6.0f; // 半径
-
-            if (Vector2::Length(enemyPos - debrisPos) < enemyRadius + debrisRadius) {
-                // ヒット！
-
-                if (isAttacking) {
-                    // 攻撃モード：ダメージ
-                    int dmg = isCritical ? 5 : 1;
-                    float power = isCritical ? 1200.0f : 400.0f;
-                    Vector2 knockDir = Vector2::Normalize(enemyPos - playerPos);
-
-                    enemy->OnHit(dmg, knockDir, power);
-
-                } else {
-                    // 防御モード：押し出し（ダメージなし、あるいは微小）
-                    Vector2 pushDir = Vector2::Normalize(enemyPos - debrisPos);
-                    enemy->PushBack(pushDir, 5.0f); // グイッと押し出す
-                }
+    });
+
+    // B. デブリ vs 敵（デブリ1粒ごとに近くのセルだけ調べる）
+    const int dmg = isCritical ? 5 : 1;
+    const float power = isCritical ? 1200.0f : 400.0f;
+
+    for (auto& piece : pieces) {
+        const Vector2 debrisPos = piece->GetActualPosition(); // 慣性適用後の座標
+
+        enemyGrid_.QueryCircle(debrisPos, debrisRadius + queryMargin, [&](int i) {
+            // 今フレームで倒された敵は無視（削除は判定後にまとめて行う）
+            if (enemies_.IsDead(i)) return;
+
+            const Vector2 enemyPos = enemies_.GetPosition(i);
+            if (Vector2::Length(enemyPos - debrisPos) >= enemies_.GetRadius(i) + debrisRadius) return;
+
+            // ヒット！
+            if (isAttacking) {
+                // 攻撃モード：ダメージ
+                Vector2 knockDir = Vector2::Normalize(enemyPos - playerPos);
+                enemies_.Hit(i, dmg, knockDir, power);
+            } else {
+                // 防御モード：押し出し（ダメージなし）
+                Vector2 pushDir = Vector2::Normalize(enemyPos - debrisPos);
+                enemies_.PushBack(i, pushDir * 5.0f); // グイッと押し出す
             }
-        }
-        
+        });
     }
-}
\ No newline at end of file
+}
@@ -4,11 +4,12 @@
 #include <vector>
 #include "GameObject2D.h"
 #include "Camera2D.h"
+#include "SurvivalEnemyStore.h"
+#include "SurvivalSpatialGrid.h"
 
 // 前方宣言
 class SurvivalPlayer;
 class DebrisController;
-class SurvivalEnemy;
 
 /// <summary>
 /// サバイバルゲーム用オブジェクトマネージャー
@@ -24,9 +25,12 @@ public:
     // 描画（全オブジェクトの描画）
     void Draw(const Camera2D& camera);
 
-    // オブジェクト登録
+    // オブジェクト登録（敵以外）
     void AddObject(const std::shared_ptr<GameObject2D>& obj, const std::string& tag);
 
+    // 敵の生成（ストアに直接追加する）
+    SurvivalEnemyHandle SpawnEnemy(const Vector2& pos, EnemyType type) { return enemies_.Spawn(pos, type); }
+
     // 特定オブジェクトへのアクセサ（判定やカメラ制御で使用）
     void SetPlayer(std::shared_ptr<SurvivalPlayer> player) { player_ = player; }
     std::shared_ptr<SurvivalPlayer> GetPlayer() const { return player_; }
@@ -34,8 +38,13 @@ public:
     void SetDebrisController(std::shared_ptr<DebrisController> debris) { debrisController_ = debris; }
     std::shared_ptr<DebrisController> GetDebrisController() const { return debrisController_; }
 
-    // 敵のリストを取得（デブリ側から参照するため）
-    const std::list<std::shared_ptr<SurvivalEnemy>>& GetEnemies() const { return enemies_; }
+    // 敵のストアを取得（デブリ側から参照するため）
+    const SurvivalEnemyStore& GetEnemies() const { return enemies_; }
+    SurvivalEnemyStore& GetEnemies() { return enemies_; }
+    int GetEnemyCount() const { return enemies_.Size(); }
+
+    // 直近フレームの敵処理時間（更新 + 判定 + 削除, ms）
+    float GetLastEnemyUpdateMs() const { return lastEnemyUpdateMs_; }
 
     // 全消去（リセット用）
     void Clear();
@@ -52,7 +61,18 @@ private:
     // 毎回キャストして探すと重いため、分けて保持する
     std::shared_ptr<SurvivalPlayer> player_;
     std::shared_ptr<DebrisController> debrisController_;
-    std::list<std::shared_ptr<SurvivalEnemy>> enemies_;
+
+    // 敵は連続配列でまとめて持つ（shared_ptr にしない）
+    SurvivalEnemyStore enemies_;
+
+    // 敵の位置から毎フレーム作り直すグリッド（判定・押し合い用）
+    SurvivalSpatialGrid enemyGrid_;
+
+    // 敵同士の押し合いの強さ（1フレームで解消する重なりの割合）
+    float separationStrength_ = 0.5f;
+
+    int enemyTexture_ = -1;
+    float lastEnemyUpdateMs_ = 0.0f;
 
     // 衝突判定ロジック（内部で呼ぶ）
     void CheckCollisions();
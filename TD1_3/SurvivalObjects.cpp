@@ -83,86 +83,6 @@ void SurvivalPlayer::OnDamage() {
     //drawComp_->StartFlash({ 1.0f, 0.0f, 0.0f, 1.0f }, 0.2f);
 }
 
-// ==========================================
-// SurvivalEnemy
-// ==========================================
-SurvivalEnemy::SurvivalEnemy(Vector2 startPos, EnemyType type, std::shared_ptr<SurvivalPlayer> target)
-    : type_(type), target_(target) {
-
-    transform_.translate = startPos;
-
-    // タイプ別のパラメータ設定
-    if (type_ == EnemyType::Tank) {
-        hp_ = 15;
-        radius_ = 24.0f;
-       // drawComp_ = AddComponent<DrawComponent2D>();
-        drawComp_->SetBaseColor(0x882222FF); // 濃い赤
-    }
-    else {
-        hp_ = 2;
-        radius_ = 12.0f;
-       // drawComp_ = AddComponent<DrawComponent2D>();
-        drawComp_->SetBaseColor(0xFF4444FF); // 明るい赤
-    }
-
-    drawComp_->SetDrawSize(radius_ * 2, radius_ * 2);
-    drawComp_->SetAnchorPoint({ 0.5f, 0.5f });
-}
-
-void SurvivalEnemy::Update(float dt) {
-    if (isDead_) return;
-
-    if (hitInvincibility_ > 0.0f) hitInvincibility_ -= dt;
-
-    if (knockbackDuration_ > 0.0f) {
-        // --- ノックバック中 ---
-        knockbackDuration_ -= dt;
-        transform_.translate += knockbackVel_ * dt;
-        knockbackVel_ *= 0.9f; // 摩擦で減速
-        drawComp_->SetBaseColor(0xFFFFFFFF); // 白飛び演出
-    }
-    else {
-        // --- 通常AI（追尾） ---
-        drawComp_->SetBaseColor((type_ == EnemyType::Tank) ? 0x882222FF : 0xFF4444FF);
-
-        if (target_) {
-            Vector2 toPlayer = target_->GetPosition() - transform_.translate;
-            if (Vector2::Length(toPlayer) > 1.0f) {
-                Vector2 dir = Vector2::Normalize(toPlayer);
-                float speed = (type_ == EnemyType::Tank) ? 40.0f : 100.0f;
-                transform_.translate += dir * speed * dt;
-            }
-        }
-    }
-
-    GameObject2D::Update(dt);
-}
-
-void SurvivalEnemy::OnHit(int damage, Vector2 knockbackDir, float knockbackPower) {
-    // 無敵時間中はスキップ（ただし多段ヒット防止用なので極短）
-    if (hitInvincibility_ > 0.0f) return;
-
-    hp_ -= damage;
-
-    // ノックバック適用
-    knockbackVel_ = knockbackDir * knockbackPower;
-    knockbackDuration_ = 0.2f + (knockbackPower / 2000.0f); // 強い攻撃ほど長く飛ぶ
-
-    // ヒット演出：つぶれるアニメーション
-    drawComp_->StartSquash({ 1.3f, 0.7f }, 0.1f);
-
-    if (hp_ <= 0) {
-        isDead_ = true;
-        GetInfo().isActive = false;
-        // 死亡エフェクトがあればここで再生（ParticleManagerなどに依頼）
-    }
-}
-
-void SurvivalEnemy::PushBack(Vector2 dir, float dist) {
-    // 物理的に押し出される処理（ダメージなし）
-    transform_.translate += dir * dist;
-}
-
 // ==========================================
 // DebrisPiece (慣性を持つがれき)
 // ==========================================
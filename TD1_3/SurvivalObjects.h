@@ -2,6 +2,7 @@
 #include "GameObject2D.h"
 #include "DrawComponent2D.h"
 #include "InputManager.h"
+#include "SurvivalEnemyStore.h"
 
 // 共通定数や前方宣言
 class SurvivalGameObjectManager;
@@ -34,33 +35,7 @@ private:
 // ==========================================
 // 敵 (Enemy)
 // ==========================================
-enum class EnemyType { Normal, Tank };
-
-class SurvivalEnemy : public GameObject2D {
-public:
-    SurvivalEnemy(Vector2 startPos, EnemyType type, std::shared_ptr<SurvivalPlayer> target);
-    void Update(float dt) override;
-
-    // 固有メソッド
-    void OnHit(int damage, Vector2 knockbackDir, float knockbackPower);
-    void PushBack(Vector2 dir, float dist); // 押し出し処理
-
-    EnemyType GetType() const { return type_; }
-    float GetRadius() const { return radius_; }
-    bool IsInvincible() const { return hitInvincibility_ > 0.0f; }
-
-private:
-    std::shared_ptr<SurvivalPlayer> target_; // 追尾対象
-
-    EnemyType type_;
-    int hp_;
-    float radius_;
-
-    // ノックバック制御
-    Vector2 knockbackVel_ = { 0,0 };
-    float knockbackDuration_ = 0.0f;
-    float hitInvincibility_ = 0.0f;
-};
+// 敵は数が多いので GameObject2D にせず、SurvivalEnemyStore でまとめて持つ
 
 // ==========================================
 // がれき1粒 (DebrisPiece)
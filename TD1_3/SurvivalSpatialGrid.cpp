@@ -0,0 +1,53 @@
+﻿#include "SurvivalSpatialGrid.h"
+#include <algorithm>
+
+SurvivalSpatialGrid::SurvivalSpatialGrid(float cellSize, int bucketCount)
+    : cellSize_(cellSize)
+    , invCellSize_(1.0f / cellSize) {
+
+    // バケット数は2の累乗に切り上げる（ハッシュをマスクで取るため）
+    int count = 1;
+    while (count < bucketCount) count <<= 1;
+    bucketMask_ = static_cast<uint32_t>(count - 1);
+
+    bucketStart_.assign(static_cast<size_t>(count) + 1, 0);
+    writeCursor_.assign(static_cast<size_t>(count), 0);
+}
+
+void SurvivalSpatialGrid::Build(const std::vector<Vector2>& positions) {
+    const int itemCount = static_cast<int>(positions.size());
+
+    itemBucket_.resize(itemCount);
+    itemCellX_.resize(itemCount);
+    itemCellY_.resize(itemCount);
+    entries_.resize(itemCount);
+    entryCellX_.resize(itemCount);
+    entryCellY_.resize(itemCount);
+
+    // 1. バケットごとの個数を数える
+    std::fill(bucketStart_.begin(), bucketStart_.end(), 0);
+    for (int i = 0; i < itemCount; ++i) {
+        const int cx = ToCell(positions[i].x);
+        const int cy = ToCell(positions[i].y);
+        const int bucket = HashCell(cx, cy);
+        itemCellX_[i] = cx;
+        itemCellY_[i] = cy;
+        itemBucket_[i] = bucket;
+        bucketStart_[bucket + 1]++;
+    }
+
+    // 2. 累積和で開始位置にする
+    const int bucketCount = static_cast<int>(bucketMask_) + 1;
+    for (int b = 0; b < bucketCount; ++b) {
+        bucketStart_[b + 1] += bucketStart_[b];
+    }
+
+    // 3. バケット順に並べる
+    std::copy(bucketStart_.begin(), bucketStart_.end() - 1, writeCursor_.begin());
+    for (int i = 0; i < itemCount; ++i) {
+        const int dst = writeCursor_[itemBucket_[i]]++;
+        entries_[dst] = i;
+        entryCellX_[dst] = itemCellX_[i];
+        entryCellY_[dst] = itemCellY_[i];
+    }
+}
@@ -0,0 +1,73 @@
+﻿#pragma once
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include "Vector2.h"
+
+/// <summary>
+/// サバイバル用の一様グリッド（毎フレーム敵の位置から作り直す）
+/// セル座標をハッシュしてバケットに振り分け、カウンティングソートで
+/// バケットごとに添字を連続配置する。作り直しでメモリ確保は起きない（容量は使い回す）
+/// </summary>
+class SurvivalSpatialGrid {
+public:
+    explicit SurvivalSpatialGrid(float cellSize = 64.0f, int bucketCount = 4096);
+
+    // 位置配列からグリッドを作り直す（添字は positions の添字）
+    void Build(const std::vector<Vector2>& positions);
+
+    /// <summary>
+    /// 円と重なるセルに入っている要素を列挙する
+    /// 返すのはセル単位の候補なので、距離判定は呼び出し側で行うこと
+    /// </summary>
+    /// <param name="fn">void(int index)</param>
+    template <typename Func>
+    void QueryCircle(const Vector2& center, float radius, Func&& fn) const {
+        if (entries_.empty()) return;
+
+        const int minX = ToCell(center.x - radius);
+        const int maxX = ToCell(center.x + radius);
+        const int minY = ToCell(center.y - radius);
+        const int maxY = ToCell(center.y + radius);
+
+        for (int cy = minY; cy <= maxY; ++cy) {
+            for (int cx = minX; cx <= maxX; ++cx) {
+                const int bucket = HashCell(cx, cy);
+                for (int e = bucketStart_[bucket]; e < bucketStart_[bucket + 1]; ++e) {
+                    // 別セルが同じバケットに入っていることがあるので、セル座標で弾く
+                    if (entryCellX_[e] != cx || entryCellY_[e] != cy) continue;
+                    fn(entries_[e]);
+                }
+            }
+        }
+    }
+
+    float GetCellSize() const { return cellSize_; }
+    int GetEntryCount() const { return static_cast<int>(entries_.size()); }
+
+private:
+    int ToCell(float v) const { return static_cast<int>(std::floor(v * invCellSize_)); }
+
+    int HashCell(int cx, int cy) const {
+        const uint32_t h = static_cast<uint32_t>(cx) * 73856093u ^ static_cast<uint32_t>(cy) * 19349663u;
+        return static_cast<int>(h & bucketMask_);
+    }
+
+    float cellSize_;
+    float invCellSize_;
+    uint32_t bucketMask_;
+
+    // バケットごとの開始位置（bucketCount + 1 個）
+    std::vector<int> bucketStart_;
+
+    // バケット順に並べた要素（添字とセル座標）
+    std::vector<int> entries_;
+    std::vector<int> entryCellX_;
+    std::vector<int> entryCellY_;
+
+    // 作り直し用の作業領域
+    std::vector<int> itemBucket_;
+    std::vector<int> itemCellX_;
+    std::vector<int> itemCellY_;
+    std::vector<int> writeCursor_;
+};
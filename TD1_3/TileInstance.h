@@ -6,7 +6,8 @@
 
 class TileInstance {
 public:
-    TileInstance(const TileDefinition& def, const Vector2& worldPos)
+    // animOffset: アニメーションの開始位置（0.0f～1.0f、生成側の乱数で決める）
+    TileInstance(const TileDefinition& def, const Vector2& worldPos, float animOffset)
         : id_(def.id), worldPos_(worldPos), isActive_(false) {
 
         if (def.renderMode == RenderMode::Component) {
@@ -23,8 +24,7 @@ public:
 
             // アニメーションの開始時間をバラつかせて「自然さ」を出す
             if (def.animConfig.isAnimated) {
-                float randomOffset = static_cast<float>(rand()) / RAND_MAX;
-                drawComp_->Update(randomOffset);
+                drawComp_->Update(animOffset);
             }
 
 			drawLayer_ = def.drawLayer;
@@ -59,6 +59,14 @@ public:
         }
     }
 
+    // 演出状態を生成直後に戻す（リトライ時）
+    void ResetState() {
+        if (drawComp_) {
+            drawComp_->StopAllEffects();
+        }
+        isActive_ = false;
+    }
+
 	Vector2 GetWorldPos() const { return worldPos_; }
     DrawLayer GetDrawLayer() const { return drawLayer_; }
 
@@ -9,6 +9,7 @@ TipsCardUI::TipsCardUI(int tipsId, const Vector2& position, const Vector2& size)
     , position_(position)
     , size_(size)
     , isUnlocked_(false)
+    , isUnlockStateDirty_(true)
     , isSelected_(false)
     , currentScale_(1.0f)
     , pulseTimer_(0.0f)
@@ -34,8 +35,23 @@ void TipsCardUI::Initialize() {
     }
 }
 
+void TipsCardUI::Rebind(int tipsId) {
+    if (tipsId == tipsId_ && unlockedImage_) {
+        return;
+    }
+
+    tipsId_ = tipsId;
+    pulseTimer_ = 0.0f;
+    unlockedImage_.reset();
+    shadowImage_.reset();
+    Initialize();
+}
+
 void TipsCardUI::Update(float deltaTime) {
-    UpdateUnlockState();
+    // 解放状態はコレクションへ毎フレーム問い合わせず、変化通知があった時だけ読む
+    if (isUnlockStateDirty_) {
+        UpdateUnlockState();
+    }
 
     // パルスアニメーション（未解放時のみ）
     if (!isUnlocked_) {
@@ -89,4 +105,5 @@ void TipsCardUI::Draw(DrawComponent2D* lockIcon) {
 
 void TipsCardUI::UpdateUnlockState() {
     isUnlocked_ = TipsManager::GetInstance().GetCollection().IsTipsUnlocked(tipsId_);
+    isUnlockStateDirty_ = false;
 }
\ No newline at end of file
@@ -21,6 +21,12 @@ public:
 
     void UpdateUnlockState();
 
+    // 別のTipsを表示するカードとして使い回す（ページ切り替え時）
+    void Rebind(int tipsId);
+
+    // 解放状態が変わった時だけ呼ぶ（次の Update で読み直す）
+    void InvalidateUnlockState() { isUnlockStateDirty_ = true; }
+
     void SetSelected(bool selected) { isSelected_ = selected; }
     bool IsSelected() const { return isSelected_; }
 
@@ -37,6 +43,7 @@ private:
     Vector2 size_;
 
     bool isUnlocked_;
+    bool isUnlockStateDirty_; // 解放状態を読み直す必要がある
     bool isSelected_;
 
     // 各カード固有の画像
@@ -1,5 +1,6 @@
 ﻿#include "TipsCollection.h"
 #include "TextureManager.h"
+#include <algorithm>
 
 TipsCollection& TipsCollection::GetInstance() {
     static TipsCollection instance;
@@ -80,6 +81,30 @@ std::vector<TipsData> TipsCollection::GetAllTips() const {
     return tipsDatabase_;
 }
 
+void TipsCollection::GetTipsIds(std::vector<int>& outIds) const {
+    outIds.clear();
+    outIds.reserve(tipsDatabase_.size());
+    for (const auto& tips : tipsDatabase_) {
+        outIds.push_back(tips.id);
+    }
+}
+
+void TipsCollection::GetUnlockedIds(std::vector<int>& outIds) const {
+    outIds.clear();
+    for (const auto& tips : tipsDatabase_) {
+        if (tips.isUnlocked) {
+            outIds.push_back(tips.id);
+        }
+    }
+}
+
+void TipsCollection::RestoreUnlocked(const std::vector<int>& unlockedIds) {
+    for (auto& tips : tipsDatabase_) {
+        tips.isUnlocked =
+            std::find(unlockedIds.begin(), unlockedIds.end(), tips.id) != unlockedIds.end();
+    }
+}
+
 int TipsCollection::GetUnlockedCount() const {
     int count = 0;
     for (const auto& tips : tipsDatabase_) {
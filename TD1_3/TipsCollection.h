@@ -16,7 +16,12 @@ public:
     bool IsTipsUnlocked(int tipsId) const;
     const TipsData* GetTipsData(int tipsId) const;
     std::vector<TipsData> GetAllTips() const;
+    void GetTipsIds(std::vector<int>& outIds) const; // 並び順どおりのID一覧（文字列はコピーしない）
     int GetUnlockedCount() const;
+
+    // 解放状態の保存・復元（リトライ時に開始時点へ戻す）
+    void GetUnlockedIds(std::vector<int>& outIds) const;
+    void RestoreUnlocked(const std::vector<int>& unlockedIds);
     int GetTotalCount() const { return static_cast<int>(tipsDatabase_.size()); }
 
 private:
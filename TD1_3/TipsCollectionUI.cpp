@@ -5,7 +5,6 @@
 
 TipsCollectionUI::TipsCollectionUI()
     : animState_(AnimState::Closed)
-    , animTimer_(0.0f)
     , animDuration_(0.3f)
     , isOpen_(false)
     , currentScale_(0.0f)
@@ -43,24 +42,64 @@ void TipsCollectionUI::Initialize() {
 
 void TipsCollectionUI::InitializeCards() {
     cards_.clear();
+    TipsManager::GetInstance().GetCollection().GetTipsIds(tipsIds_);
 
-    // 4枚のカードを 2x2 グリッドで配置
-    // Tips ID は 1, 2, 3, 4
-    for (int row = 0; row < 2; ++row) {
-        for (int col = 0; col < 2; ++col) {
-            int tipsId = row * 2 + col + 1;  // 1, 2, 3, 4
-
-            // カードの位置を計算
-            Vector2 cardPos = {
-                cardGridStart_.x + col * cardSpacing_.x,
-                cardGridStart_.y + row * cardSpacing_.y
-            };
-
-            auto card = std::make_unique<TipsCardUI>(tipsId, cardPos, cardSize_);
-            card->Initialize();
-            cards_.push_back(std::move(card));
+    // カードは 2x2 グリッドの1ページ分だけ作り、ページを変えたら中身を差し替える
+    // （コレクションが増えても、生成・更新・描画するのは表示中の分だけ）
+    for (int i = 0; i < kCardsPerPage; ++i) {
+        cards_.push_back(std::make_unique<TipsCardUI>(0, Vector2{ 0.0f, 0.0f }, cardSize_));
+    }
+
+    // 解放通知で該当カードだけを読み直す
+    if (!isCallbackRegistered_) {
+        TipsManager::GetInstance().RegisterUnlockCallback(
+            [this](int tipsId) { InvalidateCard(tipsId); });
+        isCallbackRegistered_ = true;
+    }
+
+    currentPage_ = -1;
+    ShowPage(0);
+}
+
+int TipsCollectionUI::GetPageCount() const {
+    const int count = static_cast<int>(tipsIds_.size());
+    return std::max(1, (count + kCardsPerPage - 1) / kCardsPerPage);
+}
+
+void TipsCollectionUI::ShowPage(int page) {
+    page = std::clamp(page, 0, GetPageCount() - 1);
+    if (page == currentPage_) {
+        return;
+    }
+    currentPage_ = page;
+
+    const int first = page * kCardsPerPage;
+    visibleCardCount_ = std::min(kCardsPerPage, static_cast<int>(tipsIds_.size()) - first);
+    for (int i = 0; i < visibleCardCount_; ++i) {
+        cards_[i]->Rebind(tipsIds_[first + i]);
+    }
+
+    LayoutCards();
+}
+
+void TipsCollectionUI::LayoutCards() {
+    for (int i = 0; i < visibleCardCount_; ++i) {
+        const int row = i / kCardColumns;
+        const int col = i % kCardColumns;
+        cards_[i]->SetPosition({
+            cardGridStart_.x + col * cardSpacing_.x,
+            cardGridStart_.y + row * cardSpacing_.y
+        });
+    }
+}
+
+void TipsCollectionUI::InvalidateCard(int tipsId) {
+    for (int i = 0; i < visibleCardCount_; ++i) {
+        if (cards_[i]->GetTipsId() == tipsId) {
+            cards_[i]->InvalidateUnlockState();
         }
     }
+    // 表示していないページのカードは、ページを開いた時に読み直される
 }
 
 void TipsCollectionUI::Update(float deltaTime) {
@@ -71,10 +110,10 @@ void TipsCollectionUI::Update(float deltaTime) {
         bookBackground_->Update(deltaTime);
     }
 
-    // カードを更新（開いている時のみ）
+    // カードを更新（開いている時のみ、表示中のページ分だけ）
     if (animState_ == AnimState::Open || animState_ == AnimState::Opening) {
-        for (auto& card : cards_) {
-            card->Update(deltaTime);
+        for (int i = 0; i < visibleCardCount_; ++i) {
+            cards_[i]->Update(deltaTime);
         }
     }
 }
@@ -99,19 +138,30 @@ void TipsCollectionUI::Draw() {
     if (currentScale_ > 0.5f && lockIcon_) {
         lockIcon_->Update(0.0f);  // ロックアイコンを更新
 
-        for (auto& card : cards_) {
-            card->Draw(lockIcon_.get());  // ロックアイコンを渡す
+        for (int i = 0; i < visibleCardCount_; ++i) {
+            cards_[i]->Draw(lockIcon_.get());  // ロックアイコンを渡す
         }
     }
 }
 
+void TipsCollectionUI::ResetState() {
+    TweenManager::GetInstance().Stop(animTween_);
+    animState_ = AnimState::Closed;
+    isOpen_ = false;
+    currentScale_ = 0.0f;
+
+    // 解放状態は通知なしで巻き戻されるので、表示中のカードを読み直す
+    for (int i = 0; i < visibleCardCount_; ++i) {
+        cards_[i]->InvalidateUnlockState();
+    }
+}
+
 void TipsCollectionUI::Open() {
     if (animState_ == AnimState::Open || animState_ == AnimState::Opening) {
         return;
     }
 
     animState_ = AnimState::Opening;
-    animTimer_ = 0.0f;
     isOpen_ = true;
 
 #ifdef _DEBUG
@@ -119,6 +169,10 @@ void TipsCollectionUI::Open() {
 #else
     animDuration_ = 0.3f;
 #endif
+
+    auto& tweens = TweenManager::GetInstance();
+    tweens.Stop(animTween_);
+    animTween_ = tweens.Start(0.0f, 1.0f, animDuration_, EaseType::EaseOutBack, TweenGroup::UI);
 }
 
 void TipsCollectionUI::Close() {
@@ -127,7 +181,6 @@ void TipsCollectionUI::Close() {
     }
 
     animState_ = AnimState::Closing;
-    animTimer_ = 0.0f;
     isOpen_ = false;
 
 #ifdef _DEBUG
@@ -135,6 +188,11 @@ void TipsCollectionUI::Close() {
 #else
     animDuration_ = 0.2f;
 #endif
+
+    // 1→0 に EaseOutBack をかけると、閉じる直前に少し膨らんでから縮む
+    auto& tweens = TweenManager::GetInstance();
+    tweens.Stop(animTween_);
+    animTween_ = tweens.Start(1.0f, 0.0f, animDuration_, EaseType::EaseOutBack, TweenGroup::UI);
 }
 
 void TipsCollectionUI::Toggle() {
@@ -158,46 +216,41 @@ void TipsCollectionUI::UpdateInput() {
     if (isOpen_ && Input().GetPad()->Trigger(Pad::Button::B)) {
         Close();
     }
+
+    // ページ送り（開いている時のみ）
+    if (isOpen_ && GetPageCount() > 1) {
+        if (Input().TriggerKey(DIK_Q) || Input().GetPad()->Trigger(Pad::Button::LShoulder)) {
+            ShowPage(currentPage_ - 1);
+        }
+        if (Input().TriggerKey(DIK_E) || Input().GetPad()->Trigger(Pad::Button::RShoulder)) {
+            ShowPage(currentPage_ + 1);
+        }
+    }
 }
 
 void TipsCollectionUI::UpdateAnimation(float deltaTime) {
+    (void)deltaTime; // 時間は TweenManager 側で進む
     if (animState_ == AnimState::Closed || animState_ == AnimState::Open) {
         return;
     }
 
-    animTimer_ += deltaTime;
-    float t = std::min(animTimer_ / animDuration_, 1.0f);
-
-    switch (animState_) {
-    case AnimState::Opening: {
-        float c1 = 1.70158f;
-        float c3 = c1 + 1.0f;
-        float eased = 1.0f + c3 * std::pow(t - 1.0f, 3.0f) + c1 * std::pow(t - 1.0f, 2.0f);
-        currentScale_ = std::clamp(eased, 0.0f, 1.0f);
+    auto& tweens = TweenManager::GetInstance();
+    float eased = currentScale_;
+    tweens.Sample(animTween_, eased);
+    currentScale_ = std::clamp(eased, 0.0f, 1.0f);
 
-        if (t >= 1.0f) {
-            animState_ = AnimState::Open;
-            currentScale_ = 1.0f;
-        }
-        break;
+    if (tweens.IsPlaying(animTween_)) {
+        return;
     }
 
-    case AnimState::Closing: {
-        float c1 = 1.70158f;
-        float c3 = c1 + 1.0f;
-        float reversed = 1.0f - t;
-        float eased = c3 * std::pow(reversed, 3.0f) - c1 * std::pow(reversed, 2.0f);
-        currentScale_ = std::clamp(eased, 0.0f, 1.0f);
-
-        if (t >= 1.0f) {
-            animState_ = AnimState::Closed;
-            currentScale_ = 0.0f;
-        }
-        break;
+    animTween_ = {};
+    if (animState_ == AnimState::Opening) {
+        animState_ = AnimState::Open;
+        currentScale_ = 1.0f;
     }
-
-    default:
-        break;
+    else {
+        animState_ = AnimState::Closed;
+        currentScale_ = 0.0f;
     }
 }
 
@@ -210,7 +263,8 @@ void TipsCollectionUI::DrawImGui() {
         animState_ == AnimState::Opening ? "Opening" :
         animState_ == AnimState::Open ? "Open" : "Closing");
     ImGui::Text("Current Scale: %.2f", currentScale_);
-    ImGui::Text("Cards Count: %d", static_cast<int>(cards_.size()));
+    ImGui::Text("Tips Count: %d", static_cast<int>(tipsIds_.size()));
+    ImGui::Text("Page: %d / %d (visible cards: %d)", currentPage_ + 1, GetPageCount(), visibleCardCount_);
 
     ImGui::Separator();
     ImGui::DragFloat2("Book Position", &bookPosition_.x, 1.0f);
@@ -241,19 +295,7 @@ void TipsCollectionUI::DrawImGui() {
     }
 
     // カード位置の再計算
-    int index = 0;
-    for (int row = 0; row < 2; ++row) {
-        for (int col = 0; col < 2; ++col) {
-            if (index < cards_.size()) {
-                Vector2 cardPos = {
-                    cardGridStart_.x + col * cardSpacing_.x,
-                    cardGridStart_.y + row * cardSpacing_.y
-                };
-                cards_[index]->SetPosition(cardPos);
-            }
-            index++;
-        }
-    }
+    LayoutCards();
 
     ImGui::End();
 }
@@ -5,6 +5,7 @@
 #include "InputManager.h"
 #include "TipsManager.h"
 #include "TipsCardUI.h"  // 追加
+#include "Tween.h"
 #include <memory>
 #include <vector>  // 追加
 
@@ -26,6 +27,9 @@ public:
     void Close();
     void Toggle();
 
+    // 開閉アニメーションを止めて閉じた状態に戻す（リトライ時）
+    void ResetState();
+
 #ifdef _DEBUG
     void DrawImGui();
 #endif
@@ -35,6 +39,14 @@ private:
     void UpdateAnimation(float deltaTime);
     void InitializeCards();  // 追加
 
+    // ページ単位の表示（カードは1ページ分だけ持ち、ページを変えたら使い回す）
+    int GetPageCount() const;
+    void ShowPage(int page);
+    void LayoutCards();
+
+    // TipsManager からの解放通知（表示中のカードだけ読み直す）
+    void InvalidateCard(int tipsId);
+
     enum class AnimState {
         Closed,
         Opening,
@@ -43,7 +55,7 @@ private:
     };
 
     AnimState animState_;
-    float animTimer_;
+    TweenHandle animTween_; // 本のスケール（イージング適用済み）
     float animDuration_;
 
     bool isOpen_;
@@ -57,7 +69,16 @@ private:
 
     // カード管理（追加）
 
-    std::vector<std::unique_ptr<TipsCardUI>> cards_;
+    static constexpr int kCardColumns = 2;
+    static constexpr int kCardRows = 2;
+    static constexpr int kCardsPerPage = kCardColumns * kCardRows;
+
+    std::vector<std::unique_ptr<TipsCardUI>> cards_; // 1ページ分のカード
+    std::vector<int> tipsIds_;   // コレクション全体のID（表示順）
+    int currentPage_ = 0;
+    int visibleCardCount_ = 0;   // 現在のページで使っているカード数（最終ページは少ない）
+    bool isCallbackRegistered_ = false;
+
     Vector2 cardGridStart_;   // グリッドの開始位置
     Vector2 cardSize_;        // 各カードのサイズ
     Vector2 cardSpacing_;     // カード間の間隔
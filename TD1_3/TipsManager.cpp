@@ -35,6 +35,11 @@ void TipsManager::UnlockTips(int tipsId) {
     }
 }
 
+void TipsManager::RestoreProgress(const std::vector<int>& unlockedIds) {
+    GetCollection().RestoreUnlocked(unlockedIds);
+    hasNewUnlock_ = false;
+}
+
 void TipsManager::RegisterUnlockCallback(const TipsUnlockCallback& callback) {
     if (callback) {
         unlockCallbacks_.push_back(callback);
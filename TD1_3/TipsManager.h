@@ -17,6 +17,9 @@ public:
     // Tips解放
     void UnlockTips(int tipsId);
 
+    // 解放状態を保存時点に戻す（コールバックは呼ばず、登録もそのまま残す）
+    void RestoreProgress(const std::vector<int>& unlockedIds);
+
     // 新規解放があったかチェック
     bool HasNewUnlock() const { return hasNewUnlock_; }
     void ClearNewUnlockFlag() { hasNewUnlock_ = false; }
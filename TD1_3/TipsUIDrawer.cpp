@@ -102,6 +102,14 @@ void TipsUIDrawer::Draw() {
     }
 }
 
+void TipsUIDrawer::ResetState() {
+    animState_ = AnimState::Idle;
+    animTimer_ = 0.0f;
+    bounceOffset_ = 0.0f;
+    glowIntensity_ = 0.0f;
+    ClearNotification();
+}
+
 void TipsUIDrawer::PlayUnlockReaction() {
     animState_ = AnimState::Bounce;
     animTimer_ = 0.0f;
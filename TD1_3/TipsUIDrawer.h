@@ -25,6 +25,9 @@ public:
         showNotification_ = false;
         unreadCount_ = 0;
     }
+
+    // アニメーションと通知を初期状態に戻す（リトライ時）
+    void ResetState();
     
 private:
     void UpdateAnimation(float deltaTime);
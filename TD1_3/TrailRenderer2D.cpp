@@ -0,0 +1,194 @@
+﻿#include "TrailRenderer2D.h"
+#include <algorithm>
+#include <cmath>
+#include "Camera2D.h"
+#include "DrawComponent2D.h"
+#include "Affine2x3.h"
+
+TrailRenderer2D::TrailRenderer2D(int capacity, TrailDrawMode mode)
+	: samples_(static_cast<size_t>(std::max(2, capacity))), mode_(mode) {
+}
+
+TrailSample& TrailRenderer2D::At(int i) {
+	const int capacity = GetCapacity();
+	return samples_[(head_ - count_ + i + capacity) % capacity];
+}
+
+const TrailSample& TrailRenderer2D::At(int i) const {
+	const int capacity = GetCapacity();
+	return samples_[(head_ - count_ + i + capacity) % capacity];
+}
+
+TrailSample& TrailRenderer2D::Push() {
+	TrailSample& sample = samples_[head_];
+	head_ = (head_ + 1) % GetCapacity();
+	if (count_ < GetCapacity()) {
+		++count_;
+	}
+	return sample;
+}
+
+void TrailRenderer2D::AddPoint(const Vector2& position, float life) {
+	if (life <= 0.0f) return;
+
+	TrailSample& sample = Push();
+	sample.position = position;
+	sample.life = life;
+	sample.maxLife = life;
+}
+
+void TrailRenderer2D::AddGhost(const DrawComponent2D& source, float life) {
+	if (life <= 0.0f || source.GetGraphHandle() < 0) return;
+
+	TrailSample& sample = Push();
+	sample.position = source.GetPosition();
+	sample.life = life;
+	sample.maxLife = life;
+
+	sample.graphHandle = source.GetGraphHandle();
+	source.GetSourceRect(sample.srcX, sample.srcY, sample.srcW, sample.srcH);
+	sample.drawSize = source.GetDrawSize();
+	sample.anchor = source.GetAnchorPoint();
+	sample.scale = source.GetScale();
+	sample.rotation = source.GetRotation();
+	sample.flipX = source.IsFlipX();
+}
+
+void TrailRenderer2D::Update(float deltaTime) {
+	for (int i = 0; i < count_; ++i) {
+		At(i).life -= deltaTime;
+	}
+
+	// 古い順に並んでいるので、先頭（最古）から尽きたものを捨てる
+	while (count_ > 0 && At(0).life <= 0.0f) {
+		--count_;
+	}
+}
+
+void TrailRenderer2D::SetTexture(int graphHandle) {
+	textureHandle_ = graphHandle;
+	textureWidth_ = 1;
+	textureHeight_ = 1;
+	if (graphHandle >= 0) {
+		Novice::GetTextureSize(graphHandle, &textureWidth_, &textureHeight_);
+		textureWidth_ = std::max(1, textureWidth_);
+		textureHeight_ = std::max(1, textureHeight_);
+	}
+}
+
+unsigned int TrailRenderer2D::FadeColor(float alphaRate) const {
+	const float baseAlpha = static_cast<float>(color_ & 0xFF);
+	const float alpha = std::clamp(baseAlpha * alphaRate, 0.0f, 255.0f);
+	return (color_ & 0xFFFFFF00) | static_cast<unsigned int>(alpha);
+}
+
+void TrailRenderer2D::Draw(const Camera2D& camera) const {
+	if (count_ == 0) return;
+
+	Novice::SetBlendMode(blendMode_);
+	if (mode_ == TrailDrawMode::Ribbon) {
+		DrawRibbon(camera);
+	}
+	else {
+		DrawGhosts(camera);
+	}
+	Novice::SetBlendMode(kBlendModeNormal);
+}
+
+void TrailRenderer2D::DrawRibbon(const Camera2D& camera) const {
+	if (count_ < 2 || textureHandle_ < 0) return;
+
+	const Affine2x3& vpMatrix = camera.GetVpVpAffine();
+	const int segmentCount = count_ - 1;
+
+	// 各サンプルの左右の端（ワールド座標）を求めてからスクリーンへ
+	// 向きは前後のサンプルから決め、重なった点では直前の向きを使う
+	Vector2 normal = { 0.0f, 1.0f };
+	Vector2 prevLeft = { 0.0f, 0.0f };
+	Vector2 prevRight = { 0.0f, 0.0f };
+	float prevFade = 0.0f;
+
+	for (int i = 0; i < count_; ++i) {
+		const TrailSample& sample = At(i);
+		const Vector2& prevPos = At(std::max(0, i - 1)).position;
+		const Vector2& nextPos = At(std::min(count_ - 1, i + 1)).position;
+
+		const float dx = nextPos.x - prevPos.x;
+		const float dy = nextPos.y - prevPos.y;
+		const float length = std::sqrt(dx * dx + dy * dy);
+		if (length > 1e-3f) {
+			normal = { -dy / length, dx / length };
+		}
+
+		// 末尾（最古）→ 先頭（最新）で太くなる
+		const float t = static_cast<float>(i) / static_cast<float>(segmentCount);
+		const float halfWidth = (tailWidth_ + (headWidth_ - tailWidth_) * t) * 0.5f;
+
+		const Vector2 left = Affine2x3::Transform(
+			{ sample.position.x + normal.x * halfWidth, sample.position.y + normal.y * halfWidth }, vpMatrix);
+		const Vector2 right = Affine2x3::Transform(
+			{ sample.position.x - normal.x * halfWidth, sample.position.y - normal.y * halfWidth }, vpMatrix);
+		const float fade = sample.life / sample.maxLife;
+
+		if (i > 0) {
+			// テクスチャの横方向を軌跡の長さに割り当てる
+			const int srcX = textureWidth_ * (i - 1) / segmentCount;
+			const int srcW = std::max(1, textureWidth_ * i / segmentCount - srcX);
+
+			Novice::DrawQuad(
+				static_cast<int>(prevLeft.x), static_cast<int>(prevLeft.y),
+				static_cast<int>(left.x), static_cast<int>(left.y),
+				static_cast<int>(prevRight.x), static_cast<int>(prevRight.y),
+				static_cast<int>(right.x), static_cast<int>(right.y),
+				srcX, 0, srcW, textureHeight_,
+				textureHandle_,
+				FadeColor((prevFade + fade) * 0.5f)
+			);
+		}
+
+		prevLeft = left;
+		prevRight = right;
+		prevFade = fade;
+	}
+}
+
+void TrailRenderer2D::DrawGhosts(const Camera2D& camera) const {
+	const Affine2x3& vpMatrix = camera.GetVpVpAffine();
+	const float yScale = camera.IsWorldYUp() ? -1.0f : 1.0f;
+
+	// 古いものから描いて、新しい残像が上に来るようにする
+	for (int i = 0; i < count_; ++i) {
+		const TrailSample& sample = At(i);
+		if (sample.graphHandle < 0) continue;
+
+		const float ax = sample.drawSize.x * sample.anchor.x;
+		const float ay = sample.drawSize.y * sample.anchor.y;
+		Vector2 local[4] = {
+			{ -ax, -ay },                                        // 左上
+			{ sample.drawSize.x - ax, -ay },                     // 右上
+			{ -ax, sample.drawSize.y - ay },                     // 左下
+			{ sample.drawSize.x - ax, sample.drawSize.y - ay }  // 右下
+		};
+
+		// ローカル → ワールド → スクリーンを1つの行列にまとめて4頂点を変換
+		const Affine2x3 world = Affine2x3::MakeAffine(
+			{ sample.scale.x, sample.scale.y * yScale }, sample.rotation, sample.position);
+		Vector2 screen[4];
+		Affine2x3::TransformPoints(local, screen, 4, Affine2x3::Multiply(world, vpMatrix));
+
+		if (sample.flipX) {
+			std::swap(screen[0], screen[1]);
+			std::swap(screen[2], screen[3]);
+		}
+
+		Novice::DrawQuad(
+			static_cast<int>(screen[0].x), static_cast<int>(screen[0].y),
+			static_cast<int>(screen[1].x), static_cast<int>(screen[1].y),
+			static_cast<int>(screen[2].x), static_cast<int>(screen[2].y),
+			static_cast<int>(screen[3].x), static_cast<int>(screen[3].y),
+			sample.srcX, sample.srcY, sample.srcW, sample.srcH,
+			sample.graphHandle,
+			FadeColor(sample.life / sample.maxLife)
+		);
+	}
+}
@@ -0,0 +1,118 @@
+﻿#pragma once
+#include <vector>
+#include <Novice.h>
+#include "Vector2.h"
+
+class Camera2D;
+class DrawComponent2D;
+
+// 軌跡の描き方
+enum class TrailDrawMode {
+	Ribbon, // サンプルをつないだ1本の帯（ブーメランの軌跡など）
+	Ghost   // サンプルごとにスプライトの残像（ダッシュ残像など）
+};
+
+/// <summary>
+/// 軌跡の1サンプル
+/// </summary>
+struct TrailSample {
+	Vector2 position = { 0.0f, 0.0f };
+	float life = 0.0f;     // 残り寿命（フレーム）
+	float maxLife = 1.0f;  // 追加時の寿命（フェード計算用）
+
+	// 残像用（追加時のスプライトの状態）
+	int graphHandle = -1;
+	int srcX = 0, srcY = 0, srcW = 0, srcH = 0;
+	Vector2 drawSize = { 0.0f, 0.0f };
+	Vector2 anchor = { 0.5f, 0.5f };
+	Vector2 scale = { 1.0f, 1.0f };
+	float rotation = 0.0f;
+	bool flipX = false;
+};
+
+/// <summary>
+/// 固定長リングバッファの軌跡コンポーネント
+/// 毎フレームの確保・詰め直しをせず、古いサンプルから上書き・消滅させる
+/// 描画はブレンドモードを1回だけ設定して、まとめてクアッドを並べる
+/// </summary>
+class TrailRenderer2D {
+public:
+	/// <param name="capacity">保持できるサンプル数の上限（超えたら最古のものを上書き）</param>
+	/// <param name="mode">描き方</param>
+	explicit TrailRenderer2D(int capacity = 32, TrailDrawMode mode = TrailDrawMode::Ribbon);
+
+	// ========== サンプル追加 ==========
+
+	/// <summary>
+	/// 帯用の点を追加
+	/// </summary>
+	void AddPoint(const Vector2& position, float life);
+
+	/// <summary>
+	/// 残像用に、スプライトの現在の見た目（フレーム・向き・大きさ）を記録
+	/// </summary>
+	void AddGhost(const DrawComponent2D& source, float life);
+
+	// ========== 更新・描画 ==========
+
+	/// <summary>
+	/// 寿命を減らし、尽きた古いサンプルを捨てる
+	/// </summary>
+	void Update(float deltaTime);
+
+	void Draw(const Camera2D& camera) const;
+
+	void Clear() { count_ = 0; }
+
+	// ========== 設定 ==========
+
+	/// <summary>
+	/// 帯のテクスチャ（横方向が軌跡の長さ方向になる）
+	/// </summary>
+	void SetTexture(int graphHandle);
+
+	/// <summary>
+	/// 帯の太さ（先頭＝最新 → 末尾＝最古）
+	/// </summary>
+	void SetWidth(float headWidth, float tailWidth) { headWidth_ = headWidth; tailWidth_ = tailWidth; }
+
+	/// <summary>
+	/// 色（アルファは寿命に合わせて 0 まで下がる）
+	/// </summary>
+	void SetColor(unsigned int color) { color_ = color; }
+
+	void SetBlendMode(BlendMode blendMode) { blendMode_ = blendMode; }
+
+	// ========== 取得 ==========
+	int GetCount() const { return count_; }
+	int GetCapacity() const { return static_cast<int>(samples_.size()); }
+	bool IsEmpty() const { return count_ == 0; }
+
+private:
+	// i = 0 が最古、count_ - 1 が最新
+	TrailSample& At(int i);
+	const TrailSample& At(int i) const;
+
+	TrailSample& Push();
+
+	void DrawRibbon(const Camera2D& camera) const;
+	void DrawGhosts(const Camera2D& camera) const;
+
+	// 色のアルファに倍率をかける
+	unsigned int FadeColor(float alphaRate) const;
+
+	std::vector<TrailSample> samples_;
+	int head_ = 0;  // 次に書き込む位置
+	int count_ = 0;
+
+	TrailDrawMode mode_ = TrailDrawMode::Ribbon;
+
+	int textureHandle_ = -1;
+	int textureWidth_ = 1;
+	int textureHeight_ = 1;
+
+	float headWidth_ = 16.0f;
+	float tailWidth_ = 0.0f;
+	unsigned int color_ = 0xFFFFFFFF;
+	BlendMode blendMode_ = kBlendModeNormal;
+};
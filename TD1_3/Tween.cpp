@@ -0,0 +1,149 @@
+﻿#include "Tween.h"
+#include <algorithm>
+
+namespace {
+	constexpr uint32_t kNoDense = 0xFFFFFFFF;
+	constexpr size_t kInitialCapacity = 64;
+}
+
+TweenManager::TweenManager() {
+	groupTimeScales_.fill(1.0f);
+
+	froms_.reserve(kInitialCapacity);
+	tos_.reserve(kInitialCapacity);
+	elapsed_.reserve(kInitialCapacity);
+	durations_.reserve(kInitialCapacity);
+	values_.reserve(kInitialCapacity);
+	eases_.reserve(kInitialCapacity);
+	groups_.reserve(kInitialCapacity);
+	finished_.reserve(kInitialCapacity);
+	denseToSlot_.reserve(kInitialCapacity);
+}
+
+// ========== 生成・停止 ==========
+TweenHandle TweenManager::Start(float from, float to, float duration, EaseType ease, TweenGroup group) {
+	// スロット確保（空きがあれば再利用）
+	uint32_t slot;
+	if (!freeSlots_.empty()) {
+		slot = freeSlots_.back();
+		freeSlots_.pop_back();
+	}
+	else {
+		slot = static_cast<uint32_t>(slotToDense_.size());
+		slotToDense_.push_back(kNoDense);
+		slotGenerations_.push_back(0);
+	}
+
+	bool isInstant = duration <= 0.0f;
+
+	slotToDense_[slot] = static_cast<uint32_t>(values_.size());
+	froms_.push_back(from);
+	tos_.push_back(to);
+	elapsed_.push_back(0.0f);
+	durations_.push_back(duration);
+	values_.push_back(isInstant ? to : from);
+	eases_.push_back(ease);
+	groups_.push_back(group);
+	finished_.push_back(isInstant ? 1 : 0);
+	denseToSlot_.push_back(slot);
+
+	return { slot, slotGenerations_[slot] };
+}
+
+void TweenManager::Stop(TweenHandle& handle) {
+	int index = GetIndex(handle);
+	if (index >= 0) {
+		RemoveAt(static_cast<size_t>(index));
+	}
+	handle = {};
+}
+
+void TweenManager::Clear() {
+	// 既存のハンドルをすべて無効にする
+	for (uint32_t slot : denseToSlot_) {
+		slotToDense_[slot] = kNoDense;
+		slotGenerations_[slot]++;
+		freeSlots_.push_back(slot);
+	}
+
+	froms_.clear();
+	tos_.clear();
+	elapsed_.clear();
+	durations_.clear();
+	values_.clear();
+	eases_.clear();
+	groups_.clear();
+	finished_.clear();
+	denseToSlot_.clear();
+}
+
+// ========== 取得 ==========
+bool TweenManager::Sample(TweenHandle handle, float& outValue) const {
+	int index = GetIndex(handle);
+	if (index < 0) return false;
+	outValue = values_[index];
+	return true;
+}
+
+bool TweenManager::IsPlaying(TweenHandle handle) const {
+	int index = GetIndex(handle);
+	return index >= 0 && finished_[index] == 0;
+}
+
+int TweenManager::GetIndex(TweenHandle handle) const {
+	if (handle.IsNull() || handle.slot >= slotToDense_.size()) return -1;
+	if (slotGenerations_[handle.slot] != handle.generation) return -1;
+	uint32_t dense = slotToDense_[handle.slot];
+	return dense == kNoDense ? -1 : static_cast<int>(dense);
+}
+
+// ========== 一括更新 ==========
+void TweenManager::Update(float deltaTime) {
+	// 前のフレームで終了したものを詰める（後ろから回すと入れ替え後の要素を飛ばさない）
+	for (size_t i = values_.size(); i-- > 0;) {
+		if (finished_[i]) {
+			RemoveAt(i);
+		}
+	}
+
+	const size_t count = values_.size();
+	for (size_t i = 0; i < count; ++i) {
+		elapsed_[i] += deltaTime * groupTimeScales_[static_cast<int>(groups_[i])];
+		float t = std::min(elapsed_[i] / durations_[i], 1.0f);
+		values_[i] = froms_[i] + (tos_[i] - froms_[i]) * Easing::Evaluate(eases_[i], t);
+		finished_[i] = t >= 1.0f ? 1 : 0;
+	}
+}
+
+void TweenManager::RemoveAt(size_t index) {
+	// ハンドルを無効化してスロットを返す
+	uint32_t slot = denseToSlot_[index];
+	slotToDense_[slot] = kNoDense;
+	slotGenerations_[slot]++;
+	freeSlots_.push_back(slot);
+
+	// 末尾の要素を空いた位置に移す
+	size_t last = values_.size() - 1;
+	if (index != last) {
+		froms_[index] = froms_[last];
+		tos_[index] = tos_[last];
+		elapsed_[index] = elapsed_[last];
+		durations_[index] = durations_[last];
+		values_[index] = values_[last];
+		eases_[index] = eases_[last];
+		groups_[index] = groups_[last];
+		finished_[index] = finished_[last];
+		denseToSlot_[index] = denseToSlot_[last];
+		slotToDense_[denseToSlot_[index]] = static_cast<uint32_t>(index);
+	}
+
+	froms_.pop_back();
+	tos_.pop_back();
+	elapsed_.pop_back();
+	durations_.pop_back();
+	values_.pop_back();
+	eases_.pop_back();
+	groups_.pop_back();
+	finished_.pop_back();
+	denseToSlot_.pop_back();
+}
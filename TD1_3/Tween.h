@@ -0,0 +1,100 @@
+﻿#pragma once
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "Easing.h"
+
+// ==========================================
+// トゥイーンハンドル（スロット番号 + 世代）
+// 終了したトゥイーンのスロットは再利用されるので、世代が一致するときだけ有効
+// ==========================================
+struct TweenHandle {
+	static constexpr uint32_t kInvalidSlot = 0xFFFFFFFF;
+
+	uint32_t slot = kInvalidSlot;
+	uint32_t generation = 0;
+
+	bool IsNull() const { return slot == kInvalidSlot; }
+};
+
+// 時間の進み方をまとめて変えるためのグループ
+enum class TweenGroup : uint8_t {
+	Gameplay, // ポーズ中は止まる（カメラ・オブジェクトの演出）
+	UI,       // ポーズ中も進む
+	Count // 総数
+};
+
+/// <summary>
+/// float のトゥイーンをまとめて持つマネージャー
+/// 値・経過時間・イージング種類などを連続配列で持ち（SoA）、
+/// SceneManager から毎フレーム1回 Update で一括更新する。
+/// 終了したトゥイーンは次の Update の先頭で末尾と入れ替えて詰める（swap-remove）ので、
+/// 終了したフレームの間は Sample で最終値を読める。
+/// 時間の単位は Update に渡す deltaTime と同じ（フレーム）
+/// </summary>
+class TweenManager {
+public:
+	// シングルトンインスタンス取得
+	static TweenManager& GetInstance() {
+		static TweenManager instance;
+		return instance;
+	}
+
+	// コピー/ムーブ禁止
+	TweenManager(const TweenManager&) = delete;
+	TweenManager& operator=(const TweenManager&) = delete;
+
+	// ========== 生成・停止 ==========
+	// duration が 0 以下なら即座に終了扱い（値は to）
+	TweenHandle Start(float from, float to, float duration, EaseType ease,
+		TweenGroup group = TweenGroup::Gameplay);
+
+	// 停止してハンドルを無効にする（無効なハンドルなら何もしない）
+	void Stop(TweenHandle& handle);
+
+	void Clear();
+
+	// ========== 取得 ==========
+	// 現在値を取得（無効なハンドルなら false を返し、outValue は変更しない）
+	bool Sample(TweenHandle handle, float& outValue) const;
+
+	// 再生中か（終了済み・無効なハンドルなら false）
+	bool IsPlaying(TweenHandle handle) const;
+
+	int GetActiveCount() const { return static_cast<int>(values_.size()); }
+
+	// ========== 一括更新 ==========
+	void Update(float deltaTime);
+
+	// グループごとの時間倍率（0 で一時停止）
+	void SetGroupTimeScale(TweenGroup group, float scale) { groupTimeScales_[static_cast<int>(group)] = scale; }
+	float GetGroupTimeScale(TweenGroup group) const { return groupTimeScales_[static_cast<int>(group)]; }
+
+private:
+	TweenManager();
+	~TweenManager() = default;
+
+	// 現在の添字（無効なハンドルなら -1）
+	int GetIndex(TweenHandle handle) const;
+
+	// 添字の要素を末尾と入れ替えて削除する
+	void RemoveAt(size_t index);
+
+	// ========== 要素ごとの連続配列 ==========
+	std::vector<float> froms_;
+	std::vector<float> tos_;
+	std::vector<float> elapsed_;
+	std::vector<float> durations_;
+	std::vector<float> values_;
+	std::vector<EaseType> eases_;
+	std::vector<TweenGroup> groups_;
+	std::vector<uint8_t> finished_;
+	std::vector<uint32_t> denseToSlot_;
+
+	// ========== スロット表（ハンドル → 添字） ==========
+	std::vector<uint32_t> slotToDense_;
+	std::vector<uint32_t> slotGenerations_;
+	std::vector<uint32_t> freeSlots_;
+
+	std::array<float, static_cast<int>(TweenGroup::Count)> groupTimeScales_;
+};
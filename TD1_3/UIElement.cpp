@@ -28,22 +28,17 @@ GaugeUIElement::GaugeUIElement(const std::string& name, TextureId frameId,
 void GaugeUIElement::Update(float dt) {
     if (!isVisible_) return;
 
-    // ゴーストゲージの制御
+    // ゴーストゲージの制御（少し待ってから現在値まで縮める。追加のダメージで待ち直し）
+    auto& tweens = TweenManager::GetInstance();
     if (currentRatio_ < ghostRatio_) {
         ghostTimer_ += dt;
-        if (ghostTimer_ > 0.5f) {
-            float diff = ghostRatio_ - currentRatio_;
-            float t = std::min(dt * 4.0f, 1.0f);
-            float invT = 1.0f - t;
-            float easedT = 1.0f - invT * invT * invT;
-            ghostRatio_ -= diff * easedT;
-
-            if (std::abs(ghostRatio_ - currentRatio_) < 0.01f) {
-                ghostRatio_ = currentRatio_;
-            }
+        if (ghostTimer_ > ghostDelay_ && ghostTween_.IsNull()) {
+            ghostTween_ = tweens.Start(ghostRatio_, currentRatio_, ghostDrainDuration_, EaseType::EaseOutCubic);
         }
+        tweens.Sample(ghostTween_, ghostRatio_);
     }
     else {
+        tweens.Stop(ghostTween_);
         ghostRatio_ = currentRatio_;
         ghostTimer_ = 0.0f;
     }
@@ -64,6 +59,16 @@ void GaugeUIElement::Update(float dt) {
     frame_.Update(dt);
     bar_.Update(dt);
     ghost_.Update(dt);
+
+    needsRefresh_ = false;
+}
+
+bool GaugeUIElement::NeedsUpdate() const {
+    if (!isVisible_) return false;
+
+    // 割合の変化・ゴーストの追従・演出中のどれかがあれば更新する
+    return needsRefresh_ || ghostRatio_ != currentRatio_ ||
+        frame_.IsAnyEffectActive() || bar_.IsAnyEffectActive() || ghost_.IsAnyEffectActive();
 }
 
 void GaugeUIElement::Draw() {
@@ -136,9 +141,13 @@ void GaugeUIElement::DrawImGuiControls() {
 void GaugeUIElement::SetRatio(float ratio) {
     float prev = currentRatio_;
     currentRatio_ = std::clamp(ratio, 0.0f, 1.0f);
+    if (currentRatio_ != prev) {
+        needsRefresh_ = true;
+    }
 
     if (currentRatio_ < prev) {
         ghostTimer_ = 0.0f;
+        TweenManager::GetInstance().Stop(ghostTween_);
         if (prev - currentRatio_ > 0.1f) {
             frame_.StartShake(5.0f, 0.3f);
         }
@@ -167,6 +176,11 @@ void KeyGuideUIElement::Update(float dt) {
     component_->Update(dt);
 }
 
+bool KeyGuideUIElement::NeedsUpdate() const {
+    if (!isVisible_) return false;
+    return component_->IsAnyEffectActive() || component_->IsAnimationPlaying();
+}
+
 void KeyGuideUIElement::Draw() {
     if (!isVisible_) return;
     component_->SetPosition(position_);
@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "Vector2.h"
 #include "DrawComponent2D.h"
+#include "Tween.h"
 #include <string>
 #include <memory>
 #include <vector>
@@ -19,6 +20,9 @@ public:
     virtual void Draw(const Vector2& drawPos) = 0;
     virtual void DrawImGuiControls() = 0;
 
+    // Update を呼ぶ必要があるか（演出が止まっている要素は更新を飛ばせる）
+    virtual bool NeedsUpdate() const { return isVisible_; }
+
     const std::string& GetName() const { return name_; }
     Vector2 GetPosition() const { return position_; }
     virtual void SetPosition(const Vector2& pos) { position_ = pos; }
@@ -46,6 +50,7 @@ public:
     void Draw() override;
     void Draw(const Vector2& drawPos) override;
     void DrawImGuiControls() override;
+    bool NeedsUpdate() const override;
 
     void SetRatio(float ratio);
     void SetColor(uint32_t color);
@@ -60,6 +65,10 @@ private:
     float currentRatio_ = 1.0f;
     float ghostRatio_ = 1.0f;
     float ghostTimer_ = 0.0f;
+    float ghostDelay_ = 30.0f;         // 減ってからゴーストが縮み始めるまで（フレーム）
+    float ghostDrainDuration_ = 15.0f; // ゴーストが現在値まで縮む時間（フレーム）
+    TweenHandle ghostTween_;
+    bool needsRefresh_ = true; // 割合が変わったので切り抜き・瀕死演出を反映する
 };
 
 // =================================================================
@@ -73,6 +82,7 @@ public:
     void Draw() override;
     void Draw(const Vector2& drawPos) override;
     void DrawImGuiControls() override;
+    bool NeedsUpdate() const override;
 
     void TriggerSquash();
     void SetTexture(TextureId texId);
@@ -119,6 +129,7 @@ public:
 	void Draw(const Vector2& drawPos) override;
     void DrawImGuiControls() override;
     void SetPosition(const Vector2& pos) override;
+    bool NeedsUpdate() const override { return false; } // UpdateState で更新する
 
     void AddIconTexture(TextureId texId);
     void UpdateState(float dt, bool useSkill, bool canUseSkill, bool isWaiting = false);
@@ -9,8 +9,14 @@
 // =================================================================
 
 void UIManager::Initialize() {
-	uiElements_.clear();
+	slots_.clear();
+	freeSlots_.clear();
 	elementMap_.clear();
+	keyBindings_.clear();
+	for (auto& layer : layers_) {
+		layer = Layer{};
+	}
+	hasAppliedInputMode_ = false;
 
 	InitializeGauges();
 	InitializeKeyGuides();
@@ -25,8 +31,8 @@ void UIManager::InitializeGauges() {
 		Vector2(250.0f, 650.0f), Vector2(0.0f, 0.0f)
 	);
 	playerHP->SetColor(0xFFFFFFFF);
-	AddElement(std::move(playerHP));
-	gaugeElements_.push_back("PlayerHP");
+	playerHP_ = AddElement(std::move(playerHP));
+	AddToLayer(UILayer::Gauge, playerHP_, 0);
 
 	// ボスHP
 	auto bossHP = std::make_unique<GaugeUIElement>(
@@ -35,8 +41,8 @@ void UIManager::InitializeGauges() {
 	);
 	bossHP->SetColor(0xFF0000FF);
 	bossHP->SetScale(0.8f);
-	AddElement(std::move(bossHP));
-	gaugeElements_.push_back("BossHP");
+	bossHP_ = AddElement(std::move(bossHP));
+	AddToLayer(UILayer::Gauge, bossHP_, 1);
 }
 
 void UIManager::InitializeKeyGuides() {
@@ -44,80 +50,243 @@ void UIManager::InitializeKeyGuides() {
 	float keyScale = 0.72f;
 	float offset = 50.0f;
 
-	Vector2 titleOffset{0.0f,-45.f};
-
 	// キーボード用
-	AddElement(std::make_unique<KeyGuideUIElement>("KeyW", TextureId::KeyW, Vector2(basePos.x, basePos.y - offset), keyScale));
-	AddElement(std::make_unique<KeyGuideUIElement>("KeyA", TextureId::KeyA, Vector2(basePos.x - offset, basePos.y), keyScale));
-	AddElement(std::make_unique<KeyGuideUIElement>("KeyS", TextureId::KeyS, basePos, keyScale));
-	AddElement(std::make_unique<KeyGuideUIElement>("KeyD", TextureId::KeyD, Vector2(basePos.x + offset, basePos.y), keyScale));
-	AddElement(std::make_unique<KeyGuideUIElement>("KeyJ", TextureId::KeyJ, Vector2(1100.f, 665.f)));
-	AddElement(std::make_unique<KeyGuideUIElement>("KeyK", TextureId::KeyK, Vector2(1205.f, 665.f)));
-	AddElement(std::make_unique<KeyGuideUIElement>("KeySpace", TextureId::KeySpace, Vector2(kWindowCenterX, 665.f)));
+	UIHandle keyW = AddElement(std::make_unique<KeyGuideUIElement>("KeyW", TextureId::KeyW, Vector2(basePos.x, basePos.y - offset), keyScale));
+	UIHandle keyA = AddElement(std::make_unique<KeyGuideUIElement>("KeyA", TextureId::KeyA, Vector2(basePos.x - offset, basePos.y), keyScale));
+	UIHandle keyS = AddElement(std::make_unique<KeyGuideUIElement>("KeyS", TextureId::KeyS, basePos, keyScale));
+	UIHandle keyD = AddElement(std::make_unique<KeyGuideUIElement>("KeyD", TextureId::KeyD, Vector2(basePos.x + offset, basePos.y), keyScale));
+	UIHandle keyJ = AddElement(std::make_unique<KeyGuideUIElement>("KeyJ", TextureId::KeyJ, Vector2(1100.f, 665.f)));
+	UIHandle keyK = AddElement(std::make_unique<KeyGuideUIElement>("KeyK", TextureId::KeyK, Vector2(1205.f, 665.f)));
+	UIHandle keySpace = AddElement(std::make_unique<KeyGuideUIElement>("KeySpace", TextureId::KeySpace, Vector2(kWindowCenterX, 665.f)));
+
+	keyBindings_ = {
+		{ DIK_W, keyW }, { DIK_A, keyA }, { DIK_S, keyS },
+		{ DIK_D, keyD }, { DIK_J, keyJ }, { DIK_K, keyK },
+		{ DIK_SPACE, keySpace }
+	};
 
-	keyGuideElements_ = { "KeyW", "KeyA", "KeyS", "KeyD", "KeyJ", "KeyK" ,"KeySpace"};
+	// ゲームプレイ中は KeySpace を出さない
+	int order = 0;
+	for (UIHandle handle : { keyW, keyA, keyS, keyD, keyJ, keyK }) {
+		AddToLayer(UILayer::KeyGuide, handle, order++);
+	}
 
 	// ゲームパッド用
-	AddElement(std::make_unique<KeyGuideUIElement>("PadJump", TextureId::PadJump_A, Vector2(983.f, 584.f), 0.79f));
-	AddElement(std::make_unique<KeyGuideUIElement>("PadStick", TextureId::PadStickAndArrow, Vector2(981.f, 652.f), 0.82f));
-	AddElement(std::make_unique<KeyGuideUIElement>("PadButtonX", TextureId::PadButtonX, Vector2(1100.f, 663.f), 0.85f));
-	AddElement(std::make_unique<KeyGuideUIElement>("PadButtonRT", TextureId::PadButtonRT, Vector2(1205.f, 663.f), 0.85f));
-	AddElement(std::make_unique<KeyGuideUIElement>("PadButtonA", TextureId::PadButtonA, Vector2(1205.f, 663.f), 0.85f));
-	AddElement(std::make_unique<KeyGuideUIElement>("PadButtonB", TextureId::PadButtonB, Vector2(1205.f, 663.f), 0.85f));
-
-	//AddElement(std::make_unique<KeyGuideUIElement>("PadButtonB", TextureId::PadButtonB, Vector2(1205.f, 663.f), 0.85f));
+	padJump_ = AddElement(std::make_unique<KeyGuideUIElement>("PadJump", TextureId::PadJump_A, Vector2(983.f, 584.f), 0.79f));
+	padStick_ = AddElement(std::make_unique<KeyGuideUIElement>("PadStick", TextureId::PadStickAndArrow, Vector2(981.f, 652.f), 0.82f));
+	padButtonX_ = AddElement(std::make_unique<KeyGuideUIElement>("PadButtonX", TextureId::PadButtonX, Vector2(1100.f, 663.f), 0.85f));
+	padButtonRT_ = AddElement(std::make_unique<KeyGuideUIElement>("PadButtonRT", TextureId::PadButtonRT, Vector2(1205.f, 663.f), 0.85f));
+	padButtonA_ = AddElement(std::make_unique<KeyGuideUIElement>("PadButtonA", TextureId::PadButtonA, Vector2(1205.f, 663.f), 0.85f));
+	padButtonB_ = AddElement(std::make_unique<KeyGuideUIElement>("PadButtonB", TextureId::PadButtonB, Vector2(1205.f, 663.f), 0.85f));
+
+	// PadButtonB / PadButtonRT は現在のレイアウトでは表示しない
+	AddToLayer(UILayer::PadGuide, padJump_, 0);
+	AddToLayer(UILayer::PadGuide, padStick_, 1);
+	AddToLayer(UILayer::PadGuide, padButtonX_, 2);
+	AddToLayer(UILayer::PadGuide, padButtonA_, 3, Vector2(1205.f, 665.f));
+
+	// タイトル画面
+	const float titleOffsetY = -40.0f;
+	AddToLayer(UILayer::TitleKeyGuide, keyW, 0, Vector2(kWindowCenterX * 1.2f, 635.0f + titleOffsetY));
+	AddToLayer(UILayer::TitleKeyGuide, keyS, 1, Vector2(kWindowCenterX * 1.2f, 685.0f + titleOffsetY));
+	AddToLayer(UILayer::TitleKeyGuide, keySpace, 2, Vector2(kWindowCenterX, 660.0f + titleOffsetY));
+	AddToLayer(UILayer::TitlePadGuide, padButtonA_, 0, Vector2(kWindowCenterX, 650.0f));
 }
 
 void UIManager::InitializeSkillIcons() {
 	auto dashIcon = std::make_unique<SkillIconUIElement>("SkillIconDash", Vector2(1206.f, 580.f));
 	dashIcon->AddIconTexture(TextureId::Icon_Dash);
-	AddElement(std::move(dashIcon));
-	skillIconElements_.push_back("SkillIconDash");
+	dashIcon_ = AddElement(std::move(dashIcon));
+	AddToLayer(UILayer::SkillIcon, dashIcon_, 0);
 
 	auto boomerangIcon = std::make_unique<SkillIconUIElement>("SkillIconBoomerang", Vector2(1100.0f, 580.0f));
 	boomerangIcon->AddIconTexture(TextureId::Icon_BoomerangThrow);
 	boomerangIcon->AddIconTexture(TextureId::Icon_BoomerangReturn);
-	AddElement(std::move(boomerangIcon));
-	skillIconElements_.push_back("SkillIconBoomerang");
+	boomerangIcon_ = AddElement(std::move(boomerangIcon));
+	AddToLayer(UILayer::SkillIcon, boomerangIcon_, 1);
 }
 
 void UIManager::InitializePauseAndResult() {
 	auto pauseBg = std::make_unique<KeyGuideUIElement>("PauseBg", TextureId::White1x1, Vector2(640.0f, 360.0f));
 	pauseBg->SetBaseColor(0x00000080);
 	pauseBg->SetDrawSize(1280.0f, 720.0f);
-	AddElement(std::move(pauseBg));
+	UIHandle pauseBgHandle = AddElement(std::move(pauseBg));
 
 	auto pauseText = std::make_unique<KeyGuideUIElement>("PauseText", TextureId::PauseText, Vector2(640.0f, 360.0f));
-	AddElement(std::move(pauseText));
+	pauseText_ = AddElement(std::move(pauseText));
 
 	auto resultImage = std::make_unique<KeyGuideUIElement>("ResultImage", TextureId::ResultClear, Vector2(640.0f, 360.0f));
-	AddElement(std::move(resultImage));
+	resultImage_ = AddElement(std::move(resultImage));
 
-	pauseElements_ = { "PauseBg", "PauseText", "ResultImage" };
+	// 背景は両方の画面で共有する
+	AddToLayer(UILayer::Pause, pauseBgHandle, 0);
+	AddToLayer(UILayer::Pause, pauseText_, 1);
+	AddToLayer(UILayer::Result, pauseBgHandle, 0);
+	AddToLayer(UILayer::Result, resultImage_, 1);
 }
 
-void UIManager::AddElement(std::unique_ptr<UIElement> element) {
-	std::string name = element->GetName();
-	elementMap_[name] = element.get();
-	uiElements_.push_back(std::move(element));
+// ========== 要素管理 ==========
+
+UIHandle UIManager::AddElement(std::unique_ptr<UIElement> element) {
+	uint32_t slot;
+	if (!freeSlots_.empty()) {
+		slot = freeSlots_.back();
+		freeSlots_.pop_back();
+	}
+	else {
+		slot = static_cast<uint32_t>(slots_.size());
+		slots_.emplace_back();
+	}
+
+	UIHandle handle{ slot, slots_[slot].generation };
+	elementMap_[element->GetName()] = handle;
+	slots_[slot].element = std::move(element);
+	return handle;
 }
 
 void UIManager::RemoveElement(const std::string& name) {
-	elementMap_.erase(name);
-	uiElements_.erase(
-		std::remove_if(uiElements_.begin(), uiElements_.end(),
-			[&name](const std::unique_ptr<UIElement>& elem) {
-				return elem->GetName() == name;
-			}),
-		uiElements_.end()
-	);
+	RemoveElement(FindHandle(name));
+}
+
+void UIManager::RemoveElement(UIHandle handle) {
+	UIElement* element = GetElement(handle);
+	if (!element) return;
+
+	elementMap_.erase(element->GetName());
+
+	ElementSlot& slot = slots_[handle.slot];
+	slot.element.reset();
+	++slot.generation; // 古いハンドルを無効化
+	freeSlots_.push_back(handle.slot);
+
+	// レイヤーの登録は描画リストの作り直し時に取り除かれる
+	MarkAllLayersDirty();
 }
 
 UIElement* UIManager::GetElement(const std::string& name) {
+	return GetElement(FindHandle(name));
+}
+
+UIElement* UIManager::GetElement(UIHandle handle) const {
+	if (handle.IsNull() || handle.slot >= slots_.size()) return nullptr;
+
+	const ElementSlot& slot = slots_[handle.slot];
+	return (slot.generation == handle.generation) ? slot.element.get() : nullptr;
+}
+
+UIHandle UIManager::FindHandle(const std::string& name) const {
 	auto it = elementMap_.find(name);
-	return (it != elementMap_.end()) ? it->second : nullptr;
+	return (it != elementMap_.end()) ? it->second : UIHandle{};
+}
+
+// ========== レイヤー ==========
+
+void UIManager::AddToLayer(UILayer layer, UIHandle handle, int order) {
+	Layer& target = GetLayer(layer);
+	target.entries.push_back({ handle, order, false, { 0.0f, 0.0f } });
+	target.isDirty = true;
+}
+
+void UIManager::AddToLayer(UILayer layer, UIHandle handle, int order, const Vector2& drawPos) {
+	Layer& target = GetLayer(layer);
+	target.entries.push_back({ handle, order, true, drawPos });
+	target.isDirty = true;
+}
+
+void UIManager::SetLayerVisible(UILayer layer, bool visible) {
+	GetLayer(layer).isVisible = visible;
+}
+
+void UIManager::SetElementVisible(UIHandle handle, bool visible) {
+	UIElement* element = GetElement(handle);
+	if (!element || element->IsVisible() == visible) return;
+
+	element->SetVisible(visible);
+	MarkAllLayersDirty();
 }
 
+void UIManager::MarkAllLayersDirty() {
+	for (auto& layer : layers_) {
+		layer.isDirty = true;
+	}
+}
+
+void UIManager::RebuildDrawList(Layer& layer) {
+	// 登録順を保ったまま order で並べる
+	std::stable_sort(layer.entries.begin(), layer.entries.end(),
+		[](const LayerEntry& a, const LayerEntry& b) { return a.order < b.order; });
+
+	// 削除済みのハンドルは登録ごと取り除く
+	layer.entries.erase(
+		std::remove_if(layer.entries.begin(), layer.entries.end(),
+			[this](const LayerEntry& entry) { return GetElement(entry.handle) == nullptr; }),
+		layer.entries.end());
+
+	layer.drawList.clear();
+	for (const auto& entry : layer.entries) {
+		UIElement* element = GetElement(entry.handle);
+		if (element->IsVisible()) {
+			layer.drawList.push_back({ element, entry.hasDrawPos, entry.drawPos });
+		}
+	}
+	layer.isDirty = false;
+}
+
+void UIManager::UpdateLayer(UILayer layerId, float dt) {
+	Layer& layer = GetLayer(layerId);
+	if (!layer.isVisible) return;
+	if (layer.isDirty) {
+		RebuildDrawList(layer);
+	}
+
+	// 演出の無い要素は更新しても変化しないので飛ばす
+	for (const auto& entry : layer.drawList) {
+		if (entry.element->NeedsUpdate()) {
+			entry.element->Update(dt);
+		}
+	}
+}
+
+void UIManager::DrawLayer(UILayer layerId) {
+	Layer& layer = GetLayer(layerId);
+	if (!layer.isVisible) return;
+	if (layer.isDirty) {
+		RebuildDrawList(layer);
+	}
+
+	for (const auto& entry : layer.drawList) {
+		if (entry.hasDrawPos) {
+			entry.element->Draw(entry.drawPos);
+		}
+		else {
+			entry.element->Draw();
+		}
+	}
+}
+
+void UIManager::ApplyInputMode() {
+	const InputMode mode = InputManager::GetInstance().GetInputMode();
+	if (hasAppliedInputMode_ && mode == appliedInputMode_) return;
+
+	appliedInputMode_ = mode;
+	hasAppliedInputMode_ = true;
+
+	const bool isGamepad = (mode == InputMode::Gamepad);
+	for (const auto& [key, handle] : keyBindings_) {
+		SetElementVisible(handle, !isGamepad);
+	}
+	for (UIHandle handle : { padJump_, padStick_, padButtonA_, padButtonB_, padButtonX_, padButtonRT_ }) {
+		SetElementVisible(handle, isGamepad);
+	}
+
+	SetLayerVisible(UILayer::KeyGuide, !isGamepad);
+	SetLayerVisible(UILayer::TitleKeyGuide, !isGamepad);
+	SetLayerVisible(UILayer::PadGuide, isGamepad);
+	SetLayerVisible(UILayer::TitlePadGuide, isGamepad);
+}
+
+// ========== 更新 ==========
+
 void UIManager::Update(float dt) {
 	if (isTitle_) return;
 
@@ -127,172 +296,110 @@ void UIManager::Update(float dt) {
 	}
 
 	if (isPaused_) {
-		if (auto* elem = GetElement("PauseText")) {
+		if (auto* elem = GetElement(pauseText_)) {
 			elem->Update(dt);
 		}
 		return;
 	}
 
 	if (isResult_) {
-		if (auto* elem = GetElement("ResultImage")) {
+		if (auto* elem = GetElement(resultImage_)) {
 			elem->Update(dt);
 		}
 		return;
 	}
 
 	if (isGamePlay_) {
-		// ゲージ更新
-		for (const auto& name : gaugeElements_) {
-			if (auto* elem = GetElement(name)) {
-				elem->Update(dt);
-			}
-		}
+		ApplyInputMode();
 
-		// キーガイド更新
-		UpdateKeyGuides();
+		// キーガイドの押下リアクション
+		UpdateKeyGuides(UILayer::KeyGuide, UILayer::PadGuide);
 
-		// 入力モードに応じて表示切替
-		bool isGamepad = InputManager::GetInstance().GetInputMode() == InputMode::Gamepad;
-		for (const auto& name : keyGuideElements_) {
-			if (auto* elem = GetElement(name)) {
-				elem->SetVisible(!isGamepad);
-				elem->Update(dt);
-			}
-		}
-
-		// パッドUI更新
-		if (auto* elem = GetElement("PadJump")) {
-			elem->SetVisible(isGamepad);
-			elem->Update(dt);
-		}
-		if (auto* elem = GetElement("PadStick")) {
-			elem->SetVisible(isGamepad);
-			elem->Update(dt);
-		}
-		if (auto* elem = GetElement("PadButtonX")) {
-			elem->SetVisible(isGamepad);
-			elem->Update(dt);
-		}
-		if (auto* elem = GetElement("PadButtonB")) {
-			elem->SetVisible(isGamepad);
-			elem->Update(dt);
-		}
-
-		if (auto* elem = GetElement("PadButtonA")) {
-			elem->SetVisible(isGamepad);
-			elem->Update(dt);
-		}
-
-		if (auto* elem = GetElement("PadButtonRT")) {
-			elem->SetVisible(isGamepad);
-			elem->Update(dt);
-		}
+		UpdateLayer(UILayer::Gauge, dt);
+		UpdateLayer(UILayer::KeyGuide, dt);
+		UpdateLayer(UILayer::PadGuide, dt);
 	}
 }
 
-void UIManager::UpdateKeyGuides() {
+void UIManager::UpdateKeyGuides(UILayer keyLayer, UILayer padLayer) {
 	InputManager& input = InputManager::GetInstance();
 
 	if (input.GetInputMode() == InputMode::Gamepad) {
-		UpdateGamepadUI();
+		UpdateGamepadUI(padLayer);
 	}
 	else {
-		UpdateKeyboardUI();
+		UpdateKeyboardUI(keyLayer);
 	}
 }
 
-void UIManager::UpdateGamepadUI() {
-	InputManager& input = InputManager::GetInstance();
-
-	if (input.GetPad()->Trigger(Pad::Button::A)) {
-		if (auto* elem = dynamic_cast<KeyGuideUIElement*>(GetElement("PadJump"))) {
-			elem->TriggerSquash();
+bool UIManager::IsInLayer(UILayer layer, UIHandle handle) {
+	for (const auto& entry : GetLayer(layer).entries) {
+		if (entry.handle.slot == handle.slot && entry.handle.generation == handle.generation) {
+			return true;
 		}
 	}
+	return false;
+}
+
+void UIManager::SquashKeyGuide(UILayer layer, UIHandle handle) {
+	// 更新しないレイヤーの要素を潰すと、次にそのレイヤーが動いた瞬間にまとめて再生されてしまう
+	if (!IsInLayer(layer, handle)) return;
+
+	if (auto* elem = static_cast<KeyGuideUIElement*>(GetElement(handle))) {
+		elem->TriggerSquash();
+	}
+}
+
+void UIManager::UpdateGamepadUI(UILayer layer) {
+	InputManager& input = InputManager::GetInstance();
+
 	if (input.GetPad()->Trigger(Pad::Button::A)) {
-		if (auto* elem = dynamic_cast<KeyGuideUIElement*>(GetElement("PadButtonA"))) {
-			elem->TriggerSquash();
-		}
+		SquashKeyGuide(layer, padJump_);
+		SquashKeyGuide(layer, padButtonA_);
 	}
 	if (input.GetPad()->Trigger(Pad::Button::B)) {
-		if (auto* elem = dynamic_cast<KeyGuideUIElement*>(GetElement("PadButtonB"))) {
-			elem->TriggerSquash();
-		}
+		SquashKeyGuide(layer, padButtonB_);
 	}
 	if (input.GetPad()->Trigger(Pad::Button::X)) {
-		if (auto* elem = dynamic_cast<KeyGuideUIElement*>(GetElement("PadButtonX"))) {
-			elem->TriggerSquash();
-		}
+		SquashKeyGuide(layer, padButtonX_);
 	}
 	if (input.GetPad()->TriggerRightTrigger()) {
-		if (auto* elem = dynamic_cast<KeyGuideUIElement*>(GetElement("PadButtonRT"))) {
-			elem->TriggerSquash();
-		}
+		SquashKeyGuide(layer, padButtonRT_);
 	}
 
 }
 
-void UIManager::UpdateKeyboardUI() {
+void UIManager::UpdateKeyboardUI(UILayer layer) {
 	InputManager& input = InputManager::GetInstance();
 
-	const std::vector<std::pair<int, std::string>> keyMappings = {
-		{DIK_W, "KeyW"}, {DIK_A, "KeyA"}, {DIK_S, "KeyS"},
-		{DIK_D, "KeyD"}, {DIK_J, "KeyJ"}, {DIK_K, "KeyK"},
-		{DIK_SPACE, "KeySpace"}
-	};
-
-	for (const auto& [key, name] : keyMappings) {
+	for (const auto& [key, handle] : keyBindings_) {
 		if (input.TriggerKey(key)) {
-			if (auto* elem = dynamic_cast<KeyGuideUIElement*>(GetElement(name))) {
-				elem->TriggerSquash();
- 			}
+			SquashKeyGuide(layer, handle);
 		}
 	}
 }
 
+// ========== 描画 ==========
+
 void UIManager::Draw() {
 	if (isTitle_) return;
 
-	// ゲームプレイUI
+	// ゲームプレイUI（操作ガイドは入力モードに応じてどちらかのレイヤーだけが表示される）
 	if (isGamePlay_) {
-		for (const auto& name : gaugeElements_) {
-			if (auto* elem = GetElement(name)) {
-				elem->Draw();
-			}
-		}
-
-		for (const auto& name : keyGuideElements_) {
-			if (auto* elem = GetElement(name)) {
-				if (name == "KeySpace") continue;
-				elem->Draw();
-			}
-		}
-
-		// パッドUI
-		if (auto* elem = GetElement("PadJump")) elem->Draw();
-		if (auto* elem = GetElement("PadStick")) elem->Draw();
-		if (auto* elem = GetElement("PadButtonX")) elem->Draw();
-		// if (auto* elem = GetElement("PadButtonB")) elem->Draw();
-		if (auto* elem = GetElement("PadButtonA")) elem->Draw(Vector2(1205.f, 665.f));
-
-		// スキルアイコン
-		for (const auto& name : skillIconElements_) {
-			if (auto* elem = GetElement(name)) {
-				elem->Draw();
-			}
-		}
+		DrawLayer(UILayer::Gauge);
+		DrawLayer(UILayer::KeyGuide);
+		DrawLayer(UILayer::PadGuide);
+		DrawLayer(UILayer::SkillIcon);
 	}
 
 	// ポーズ
 	if (isPaused_) {
-		if (auto* elem = GetElement("PauseBg")) elem->Draw();
-		if (auto* elem = GetElement("PauseText")) elem->Draw();
+		DrawLayer(UILayer::Pause);
 	}
 
 	// リザルト
 	if (isResult_) {
-		if (auto* elem = GetElement("PauseBg")) elem->Draw();
-		if (auto* elem = GetElement("ResultImage")) elem->Draw();
+		DrawLayer(UILayer::Result);
 	}
 }
 
@@ -304,61 +411,19 @@ void UIManager::UpdateTitleControlUI(float dt) {
 		showImGui_ = !showImGui_;
 	}
 
-	// キーガイド更新
-	UpdateKeyGuides();
+	ApplyInputMode();
 
-	// 入力モードに応じて表示切替
-	bool isGamepad = InputManager::GetInstance().GetInputMode() == InputMode::Gamepad;
-	for (const auto& name : keyGuideElements_) {
-		if (auto* elem = GetElement(name)) {
-			elem->SetVisible(!isGamepad);
-			elem->Update(dt);
-		}
-	}
+	// キーガイド更新（タイトルのレイヤーにある要素だけ）
+	UpdateKeyGuides(UILayer::TitleKeyGuide, UILayer::TitlePadGuide);
 
-	// パッドUI更新
-	if (auto* elem = GetElement("PadButtonA")) {
-		elem->SetVisible(isGamepad);
-		elem->Update(dt);
-	}
-
-	// キーボード
-	if (auto* elem = GetElement("KeyW")) {
-		elem->SetVisible(!isGamepad);
-		elem->Update(dt);
-	}
-	if (auto* elem = GetElement("KeyS")) {
-		elem->SetVisible(!isGamepad);
-		elem->Update(dt);
-	}
-	if (auto* elem = GetElement("KeySpace")) {
-		elem->SetVisible(!isGamepad);
-		elem->Update(dt);
-	}
+	UpdateLayer(UILayer::TitleKeyGuide, dt);
+	UpdateLayer(UILayer::TitlePadGuide, dt);
 }
 
 void UIManager::DrawTitleControlUI() {
-
-	if (InputManager::GetInstance().GetInputMode() == InputMode::Gamepad) {
-		// ゲームパッドUI
-		if (auto* elem = GetElement("PadButtonA")) {
-			elem->Draw(Vector2(kWindowCenterX, 650.0f));
-		}
-	}
-	else {
-		// キーボードUI
-		Vector2 drawOffset{0.f,-40.0f};
-		if (auto* elem = GetElement("KeyW")) {
-			elem->Draw(Vector2(kWindowCenterX * 1.2f,635.0f + drawOffset.y));
-		}
-
-		if (auto* elem = GetElement("KeyS")) {
-			elem->Draw(Vector2(kWindowCenterX * 1.2f, 685.0f + drawOffset.y));
-		}
-		if (auto* elem = GetElement("KeySpace")) {
-			elem->Draw(Vector2(kWindowCenterX,660.0f + drawOffset.y));
-		}
-	}
+	// 入力モードに応じてどちらかのレイヤーだけが表示される
+	DrawLayer(UILayer::TitleKeyGuide);
+	DrawLayer(UILayer::TitlePadGuide);
 }
 
 void UIManager::DrawImGui() {
@@ -385,9 +450,14 @@ void UIManager::DrawImGui() {
 	}
 
 	if (ImGui::CollapsingHeader("UI Elements")) {
-		for (auto& elem : uiElements_) {
-			elem->DrawImGuiControls();
+		for (auto& slot : slots_) {
+			if (slot.element) {
+				slot.element->DrawImGuiControls();
+			}
 		}
+
+		// Visible のチェックボックスで表示が変わるかもしれないので作り直す
+		MarkAllLayersDirty();
 	}
 
 	ImGui::End();
@@ -396,13 +466,13 @@ void UIManager::DrawImGui() {
 
 // 既存API互換性
 void UIManager::SetPlayerHP(float ratio) {
-	if (auto* gauge = dynamic_cast<GaugeUIElement*>(GetElement("PlayerHP"))) {
+	if (auto* gauge = static_cast<GaugeUIElement*>(GetElement(playerHP_))) {
 		gauge->SetRatio(ratio);
 	}
 }
 
 void UIManager::SetBossHP(float ratio) {
-	if (auto* gauge = dynamic_cast<GaugeUIElement*>(GetElement("BossHP"))) {
+	if (auto* gauge = static_cast<GaugeUIElement*>(GetElement(bossHP_))) {
 		gauge->SetRatio(ratio);
 	}
 }
@@ -411,12 +481,12 @@ void UIManager::UpdateIcons(float dt, const PlayerSkillState& state) {
 	if (!isGamePlay_) return;
 
 	// ダッシュアイコン更新
-	if (auto* dashIcon = dynamic_cast<SkillIconUIElement*>(GetElement("SkillIconDash"))) {
+	if (auto* dashIcon = static_cast<SkillIconUIElement*>(GetElement(dashIcon_))) {
 		dashIcon->UpdateState(dt, state.isDashing, state.canDash, false);
 	}
 
 	// ブーメランアイコン更新
-	if (auto* boomIcon = dynamic_cast<SkillIconUIElement*>(GetElement("SkillIconBoomerang"))) {
+	if (auto* boomIcon = static_cast<SkillIconUIElement*>(GetElement(boomerangIcon_))) {
 		bool isRecalling = (state.boomerangMode == PlayerSkillState::BoomerangMode::Recalling);
 		boomIcon->UpdateState(dt, isRecalling, state.canUseBoomerang, !state.canUseBoomerang);
 	}
@@ -427,7 +497,7 @@ void UIManager::ShowResult(bool isClear) {
 	isGamePlay_ = false;
 	isGameClear_ = isClear;
 
-	if (auto* resultImage = dynamic_cast<KeyGuideUIElement*>(GetElement("ResultImage"))) {
+	if (auto* resultImage = static_cast<KeyGuideUIElement*>(GetElement(resultImage_))) {
 		if (isClear) {
 			resultImage->SetTexture(TextureId::ResultClear);
 			resultImage->StartPulse(1.0f, 1.2f, 0.5f, true);
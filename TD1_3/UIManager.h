@@ -1,9 +1,12 @@
 ﻿#pragma once
 #include "UIElement.h"
 #include "InputManager.h"
+#include <array>
+#include <cstdint>
 #include <vector>
 #include <memory>
 #include <unordered_map>
+#include <utility>
 
 struct PlayerSkillState {
 	bool isDashing = false;
@@ -20,6 +23,32 @@ struct PlayerSkillState {
 
 
 
+/// <summary>
+/// UI要素のハンドル（スロット番号＋世代）
+/// 削除済みの要素を指している場合は解決に失敗する
+/// </summary>
+struct UIHandle {
+	static constexpr uint32_t kInvalidSlot = 0xFFFFFFFF;
+
+	uint32_t slot = kInvalidSlot;
+	uint32_t generation = 0;
+
+	bool IsNull() const { return slot == kInvalidSlot; }
+};
+
+// 描画レイヤー（列挙順に描画する）
+enum class UILayer : uint8_t {
+	Gauge,         // HPゲージ
+	KeyGuide,      // 操作ガイド（キーボード）
+	PadGuide,      // 操作ガイド（ゲームパッド）
+	SkillIcon,     // スキルアイコン
+	Pause,         // ポーズ画面
+	Result,        // リザルト画面
+	TitleKeyGuide, // タイトル画面の操作ガイド（キーボード）
+	TitlePadGuide, // タイトル画面の操作ガイド（ゲームパッド）
+	Count
+};
+
 class UIManager {
 public:
     static UIManager& GetInstance() {
@@ -36,10 +65,21 @@ public:
 	void UpdateTitleControlUI(float dt); // タイトル画面用UI更新
 	void DrawTitleControlUI(); // タイトル画面用UI調整
 
-    // UI要素の管理
-    void AddElement(std::unique_ptr<UIElement> element);
+    // UI要素の管理（毎フレーム使う場合は返されたハンドルを保持しておく）
+    UIHandle AddElement(std::unique_ptr<UIElement> element);
     void RemoveElement(const std::string& name);
+    void RemoveElement(UIHandle handle);
     UIElement* GetElement(const std::string& name);
+    UIElement* GetElement(UIHandle handle) const;
+    UIHandle FindHandle(const std::string& name) const;
+
+    // レイヤーへの登録（order の小さい順に描画。drawPos 指定時はその位置に描画する）
+    void AddToLayer(UILayer layer, UIHandle handle, int order = 0);
+    void AddToLayer(UILayer layer, UIHandle handle, int order, const Vector2& drawPos);
+    void SetLayerVisible(UILayer layer, bool visible);
+
+    // 表示切替（描画リストの作り直しが必要なのでこちらを使う）
+    void SetElementVisible(UIHandle handle, bool visible);
 
     // 既存のAPI互換性のため
     void SetPlayerHP(float ratio);
@@ -60,24 +100,84 @@ private:
     UIManager(const UIManager&) = delete;
     UIManager& operator=(const UIManager&) = delete;
 
+    // 要素の実体（削除されたスロットは再利用し、世代を進める）
+    struct ElementSlot {
+        std::unique_ptr<UIElement> element;
+        uint32_t generation = 0;
+    };
+
+    // レイヤーへの登録情報
+    struct LayerEntry {
+        UIHandle handle;
+        int order = 0;
+        bool hasDrawPos = false;
+        Vector2 drawPos = { 0.0f, 0.0f };
+    };
+
+    // 解決済みの描画項目
+    struct DrawEntry {
+        UIElement* element = nullptr;
+        bool hasDrawPos = false;
+        Vector2 drawPos = { 0.0f, 0.0f };
+    };
+
+    struct Layer {
+        std::vector<LayerEntry> entries;
+        std::vector<DrawEntry> drawList; // 表示中の要素だけを描画順に並べたもの
+        bool isVisible = true;
+        bool isDirty = true;             // 登録・表示状態が変わったら作り直す
+    };
+
     void InitializeGauges();
     void InitializeKeyGuides();
     void InitializeSkillIcons();
     void InitializePauseAndResult();
 
-    void UpdateKeyGuides();
-    void UpdateGamepadUI();
-    void UpdateKeyboardUI();
+    // 押されたボタンのキーガイドを潰す（指定レイヤーに入っている要素だけ）
+    void UpdateKeyGuides(UILayer keyLayer, UILayer padLayer);
+    void UpdateGamepadUI(UILayer layer);
+    void UpdateKeyboardUI(UILayer layer);
+
+    // 入力モードが変わった時だけ操作ガイドの表示を切り替える
+    void ApplyInputMode();
+
+    Layer& GetLayer(UILayer layer) { return layers_[static_cast<size_t>(layer)]; }
+    void MarkAllLayersDirty();
+    void RebuildDrawList(Layer& layer);
+
+    // 動きのある要素だけを更新する
+    void UpdateLayer(UILayer layer, float dt);
+    void DrawLayer(UILayer layer);
+
+    bool IsInLayer(UILayer layer, UIHandle handle);
+    void SquashKeyGuide(UILayer layer, UIHandle handle);
 
     // UI要素コンテナ
-    std::vector<std::unique_ptr<UIElement>> uiElements_;
-    std::unordered_map<std::string, UIElement*> elementMap_;
-
-    // グループ管理（カテゴリ別に描画順や表示切替を制御）
-    std::vector<std::string> gaugeElements_;
-    std::vector<std::string> keyGuideElements_;
-    std::vector<std::string> skillIconElements_;
-    std::vector<std::string> pauseElements_;
+    std::vector<ElementSlot> slots_;
+    std::vector<uint32_t> freeSlots_;
+    std::unordered_map<std::string, UIHandle> elementMap_; // 名前検索用（ツール・初期化時のみ）
+
+    // レイヤー（描画順は UILayer の列挙順）
+    std::array<Layer, static_cast<size_t>(UILayer::Count)> layers_;
+
+    // 毎フレーム参照する要素のハンドル
+    UIHandle playerHP_;
+    UIHandle bossHP_;
+    UIHandle dashIcon_;
+    UIHandle boomerangIcon_;
+    UIHandle pauseText_;
+    UIHandle resultImage_;
+    UIHandle padJump_;
+    UIHandle padStick_;
+    UIHandle padButtonA_;
+    UIHandle padButtonB_;
+    UIHandle padButtonX_;
+    UIHandle padButtonRT_;
+    std::vector<std::pair<int, UIHandle>> keyBindings_; // DIKコード → キーガイド
+
+    // 操作ガイドに反映済みの入力モード
+    InputMode appliedInputMode_ = InputMode::KeyboardMouse;
+    bool hasAppliedInputMode_ = false;
 
     // 状態フラグ
     bool isGamePlay_ = false;
@@ -3,13 +3,8 @@
 
 // 4頂点分のTransformを行う
 Vertex4 Transform(const Vertex4& vertex, const Matrix3x3& matrix) {
-	Vertex4 resultVertex;
-	resultVertex.leftTop = Matrix3x3::Transform(vertex.leftTop, matrix);
-	resultVertex.rightTop = Matrix3x3::Transform(vertex.rightTop, matrix);
-	resultVertex.leftBottom = Matrix3x3::Transform(vertex.leftBottom, matrix);
-	resultVertex.rightBottom = Matrix3x3::Transform(vertex.rightBottom, matrix);
-
-	return resultVertex;
+	Vertex4Component component;
+	return component.Transform(vertex, matrix);
 }
 
 /// <summary>
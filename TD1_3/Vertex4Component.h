@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "Vertex4.h"
 #include "Vertex4Component.h"
+#include "Affine2x3.h"
 
 class Vertex4Component {
 public:
@@ -16,26 +17,35 @@ public:
 	}
 
 	Vertex4 Transform(const Vertex4& v, const Matrix3x3& matrix) {
-		Vertex4 resultVertex;
-		resultVertex.leftTop = Matrix3x3::Transform(v.leftTop, matrix);
-		resultVertex.rightTop = Matrix3x3::Transform(v.rightTop, matrix);
-		resultVertex.leftBottom = Matrix3x3::Transform(v.leftBottom, matrix);
-		resultVertex.rightBottom = Matrix3x3::Transform(v.rightBottom, matrix);
-		return resultVertex;
+		const Vector2 src[4] = { v.leftTop, v.rightTop, v.leftBottom, v.rightBottom };
+		Vector2 dst[4];
+		TransformCorners(src, dst, matrix);
+		return Vertex4(dst[0], dst[1], dst[2], dst[3]);
 	}
 
 	Vertex4 TransformScreen(const Vertex4& v, const Matrix3x3& matrix) {
-		Vertex4 resultVertex;
-		resultVertex.leftTop = Matrix3x3::Transform(v.leftBottom, matrix);
-		resultVertex.rightTop = Matrix3x3::Transform(v.rightBottom, matrix);
-		resultVertex.leftBottom = Matrix3x3::Transform(v.leftTop, matrix);
-		resultVertex.rightBottom = Matrix3x3::Transform(v.rightTop, matrix);
-		return resultVertex;
+		// スクリーンは上下が逆なので、上下の頂点を入れ替えて変換する
+		const Vector2 src[4] = { v.leftBottom, v.rightBottom, v.leftTop, v.rightTop };
+		Vector2 dst[4];
+		TransformCorners(src, dst, matrix);
+		return Vertex4(dst[0], dst[1], dst[2], dst[3]);
 	}
 
 	// 四隅を使って画像を描画する
 	void DrawVertexQuad(const Vertex4& v, int grHandle, unsigned int grDrawWidth, unsigned int grDrawHeight, unsigned int color = 0xFFFFFFFF)const;
 
 	void DrawVertexQuadWH(const Vector2& center, const float width, const float height, int grHandle, unsigned int grDrawWidth, unsigned int grDrawHeight, unsigned int color) const;
+
+private:
+	// 4頂点の変換（アフィン行列なら 2x3 でまとめて、そうでなければ従来どおり）
+	static void TransformCorners(const Vector2 src[4], Vector2 dst[4], const Matrix3x3& matrix) {
+		if (Affine2x3::IsAffine(matrix)) {
+			Affine2x3::TransformPoints(src, dst, 4, Affine2x3::FromMatrix(matrix));
+			return;
+		}
+		for (int i = 0; i < 4; ++i) {
+			dst[i] = Matrix3x3::Transform(src[i], matrix);
+		}
+	}
 };
 
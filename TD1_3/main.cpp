@@ -7,12 +7,14 @@
 #include "SoundManager.h"
 #include "TextureManager.h"
 #include "ParticleManager.h"
+#include "EnemyBehaviorSystem.h"
 
 #include "Camera2D.h"
 
 #include "ParticleRegistry.h"
 #include "UIManager.h"
 #include "MapChip.h"
+#include "DebugStats.h"
 
 const char kWindowTitle[] = "1311_ルーナラン";
 
@@ -23,11 +25,14 @@ int WINAPI WinMain(HINSTANCE, HINSTANCE, LPSTR, int) {
 	Novice::Initialize(kWindowTitle, (int)kWindowWidth, (int)kWindowHeight);
 
 	const float kDeltaTime = 1.0f;
+
+	// 最初のシーンが音声を先読みするので、シーンより先に初期化する
+	SoundManager::GetInstance().Initialize();
+
 	SceneManager sceneManager;
 
 	//Novice::SetWindowMode(kFullscreen);
 
-	SoundManager::GetInstance().LoadResources();
 	Camera2D::GetInstance().SetIsWorldYUp(true);
 	TextureManager::GetInstance().LoadResources();
 
@@ -37,6 +42,9 @@ int WINAPI WinMain(HINSTANCE, HINSTANCE, LPSTR, int) {
 	ParticleRegistry::Initialize();
 	ParticleManager::GetInstance().Load();
 
+	// 敵の挙動定義の読み込み
+	EnemyBehaviorSystem::GetInstance().Load();
+
 	// シングルトンを使う
 	auto& mapData = MapData::GetInstance();
 	mapData.Load("./Resources/data/stage1.json");
@@ -49,16 +57,23 @@ int WINAPI WinMain(HINSTANCE, HINSTANCE, LPSTR, int) {
 	while (Novice::ProcessMessage() == 0) {
 		// フレームの開始
 		Novice::BeginFrame();
+		DebugStats::GetInstance().BeginFrame();
 
 		// キー入力を受け取る
 		memcpy(preKeys, keys, 256);
 		Novice::GetHitKeyStateAll(keys);
 
+		// SEボイスの回収とリスナー（カメラ）位置の更新
+		SoundManager::GetInstance().Update(Camera2D::GetInstance().GetPosition());
+
 		///
 		/// ↓更新処理ここから
 		///
 
-		sceneManager.Update(kDeltaTime, keys, preKeys);
+		{
+			DebugScopedTimer timer(DebugTimer::SceneUpdate);
+			sceneManager.Update(kDeltaTime, keys, preKeys);
+		}
 		SoundManager::GetInstance().ShowDebugWindow();
 
 		///
@@ -72,7 +87,10 @@ int WINAPI WinMain(HINSTANCE, HINSTANCE, LPSTR, int) {
 		DrawComponent2D::preDrawSetup();
 		MapChip::preDrawSetup();
 
-		sceneManager.Draw();
+		{
+			DebugScopedTimer timer(DebugTimer::SceneDraw);
+			sceneManager.Draw();
+		}
 
 		DrawComponent2D::postDrawCleanup();
 		MapChip::postDrawCleanup();
@@ -81,6 +99,11 @@ int WINAPI WinMain(HINSTANCE, HINSTANCE, LPSTR, int) {
 		/// ↑描画処理ここまで
 		///
 
+		// フレーム統計（デバッグ表示の前に締める）
+		DebugStats::GetInstance().EndFrame();
+		DebugStats::GetInstance().ShowDebugWindow();
+		DebugStats::GetInstance().DrawOverlay();
+
 		// フレームの終了
 		Novice::EndFrame();
 